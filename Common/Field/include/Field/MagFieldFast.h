@@ -21,6 +21,10 @@
 #ifndef GPUCA_GPUCODE_DEVICE
 #include <string>
 #endif
+#ifndef GPUCA_GPUCODE
+#include <array>
+#include <gsl/span>
+#endif
 
 namespace o2
 {
@@ -55,6 +59,13 @@ class MagFieldFast
   bool Field(const float xyz[3], float bxyz[3]) const;
   bool Field(const math_utils::Point3D<float> xyz, float bxyz[3]) const;
   bool Field(const math_utils::Point3D<double> xyz, double bxyz[3]) const;
+#ifndef GPUCA_GPUCODE
+  /// field for a set of points: the segments of a block of points are found first, then the polynomials are evaluated
+  /// for the whole block. As for a single point the field is not set for the points outside of the parameterization,
+  /// these are flagged in inside, if provided. Returns the number of points inside of the parameterization
+  int Field(gsl::span<const math_utils::Point3D<float>> xyz, gsl::span<std::array<float, 3>> bxyz, gsl::span<bool> inside = {}) const;
+  int Field(gsl::span<const math_utils::Point3D<double>> xyz, gsl::span<std::array<double, 3>> bxyz, gsl::span<bool> inside = {}) const;
+#endif
   bool GetBcomp(EDim comp, const double xyz[3], double& b) const;
   bool GetBcomp(EDim comp, const float xyz[3], float& b) const;
   bool GetBcomp(EDim comp, const math_utils::Point3D<float> xyz, double& b) const;
@@ -82,6 +93,11 @@ class MagFieldFast
 
   float CalcPol(const float* cf, float x, float y, float z) const;
 
+#ifndef GPUCA_GPUCODE
+  template <typename T>
+  int fieldBlocks(gsl::span<const math_utils::Point3D<T>> xyz, gsl::span<std::array<T, 3>> bxyz, gsl::span<bool> inside) const;
+#endif
+
  private:
   float mFactorSol; // scaling factor
   SolParam mSolPar[kNSolRRanges][kNSolZRanges][kNQuadrants];
@@ -114,6 +114,10 @@ class MagneticField : public FairField
   /// Main interface from TVirtualMagField used in simulation
   void Field(const Double_t* __restrict__ point, Double_t* __restrict__ bField) override;
 
+  /// Method to calculate the field for a set of points, equivalent to Field(point, bField) for each of them
+  /// but evaluating together the points falling in the same segment of the parameterization
+  void Field(gsl::span<const math_utils::Point3D<double>> points, gsl::span<std::array<double, 3>> bField);
+
   void field(const math_utils::Point3D<float> xyz, float bxyz[3])
   {
     double xyzd[3] = {xyz.X(), xyz.Y(), xyz.Z()}, bxyzd[3] = {0};
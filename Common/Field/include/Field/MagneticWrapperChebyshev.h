@@ -22,6 +22,9 @@
 #include "MathUtils/Chebyshev3D.h"     // for Chebyshev3D
 #include "MathUtils/Chebyshev3DCalc.h" // for _INC_CREATION_Chebyshev3D_
 #include "Rtypes.h"                    // for Double_t, Int_t, Float_t, etc
+#include "MathUtils/Cartesian.h"       // for Point3D
+#include <gsl/span>                    // for span
+#include <array>                       // for array
 
 namespace o2
 {
@@ -210,6 +213,10 @@ class MagneticWrapperChebyshev : public TNamed
   /// it gets it at closest valid point
   virtual void Field(const Double_t* xyz, Double_t* b) const;
 
+  /// Computes field in cartesian coordinates for a set of points, as Field(xyz, b) does for each of them.
+  /// The points are grouped by parameterization segment and those of the same segment are evaluated together
+  void Field(gsl::span<const math_utils::Point3D<double>> xyz, gsl::span<std::array<double, 3>> b) const;
+
   /// Computes Bz for the point in cartesian coordinates. If point is outside of the parameterized region
   /// it gets it at closest valid point
   Double_t getBz(const Double_t* xyz) const;
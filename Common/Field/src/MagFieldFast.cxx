@@ -234,6 +234,57 @@ bool MagFieldFast::Field(const math_utils::Point3D<double> xyz, double bxyz[3])
   return true;
 }
 
+#ifndef GPUCA_GPUCODE
+//_______________________________________________________________________
+int MagFieldFast::Field(gsl::span<const math_utils::Point3D<float>> xyz, gsl::span<std::array<float, 3>> bxyz, gsl::span<bool> inside) const
+{
+  return fieldBlocks(xyz, bxyz, inside);
+}
+
+//_______________________________________________________________________
+int MagFieldFast::Field(gsl::span<const math_utils::Point3D<double>> xyz, gsl::span<std::array<double, 3>> bxyz, gsl::span<bool> inside) const
+{
+  return fieldBlocks(xyz, bxyz, inside);
+}
+
+//_______________________________________________________________________
+template <typename T>
+int MagFieldFast::fieldBlocks(gsl::span<const math_utils::Point3D<T>> xyz, gsl::span<std::array<T, 3>> bxyz, gsl::span<bool> inside) const
+{
+  // get field for blocks of points
+  constexpr int BlockSize = 16;
+  const SolParam* params = &mSolPar[0][0][0];
+  float x[BlockSize], y[BlockSize], z[BlockSize], b[kNDim][BlockSize];
+  int seg[BlockSize];
+  int nInside = 0;
+  for (size_t ip = 0; ip < xyz.size(); ip += BlockSize) {
+    int np = xyz.size() - ip < BlockSize ? xyz.size() - ip : BlockSize;
+    for (int i = 0; i < np; i++) {
+      x[i] = xyz[ip + i].X();
+      y[i] = xyz[ip + i].Y();
+      z[i] = xyz[ip + i].Z();
+      int zSeg, rSeg, quadrant;
+      seg[i] = GetSegment(x[i], y[i], z[i], zSeg, rSeg, quadrant) ? (rSeg * kNSolZRanges + zSeg) * kNQuadrants + quadrant : -1;
+    }
+    for (int dim = 0; dim < kNDim; dim++) {
+      for (int i = 0; i < np; i++) {
+        b[dim][i] = seg[i] < 0 ? 0.f : CalcPol(params[seg[i]].parBxyz[dim], x[i], y[i], z[i]) * mFactorSol;
+      }
+    }
+    for (int i = 0; i < np; i++) {
+      if (seg[i] >= 0) {
+        bxyz[ip + i] = {b[kX][i], b[kY][i], b[kZ][i]};
+        nInside++;
+      }
+      if (!inside.empty()) {
+        inside[ip + i] = seg[i] >= 0;
+      }
+    }
+  }
+  return nInside;
+}
+#endif
+
 //_______________________________________________________________________
 bool MagFieldFast::GetSegment(float x, float y, float z, int& zSeg, int& rSeg, int& quadrant) const
 {
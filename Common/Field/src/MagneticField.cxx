@@ -18,6 +18,7 @@
 #include <TPRegexp.h>   // for TPRegexp
 #include <TSystem.h>    // for TSystem, gSystem
 #include <fairlogger/Logger.h> // for FairLogger
+#include <vector>      // for vector
 #include "FairParamList.h"
 #include "FairRun.h"
 #include "FairRuntimeDb.h"
@@ -286,6 +287,49 @@ void MagneticField::Field(const Double_t* __restrict__ xyz, Double_t* __restrict
   }
 }
 
+void MagneticField::Field(gsl::span<const math_utils::Point3D<double>> points, gsl::span<std::array<double, 3>> bField)
+{
+  /*
+   * query field values at a set of points
+   */
+
+  const int np = points.size();
+  std::unique_ptr<bool[]> done(new bool[np]());
+  if (mFastField) {
+    mFastField->Field(points, bField, {done.get(), (size_t)np});
+  }
+
+  std::vector<math_utils::Point3D<double>> mapPoints;
+  std::vector<int> mapIndex;
+  for (int i = 0; i < np; i++) {
+    if (done[i]) {
+      continue;
+    }
+    if (mMeasuredMap && points[i].Z() > mMeasuredMap->getMinZ() && points[i].Z() < mMeasuredMap->getMaxZ()) {
+      mapPoints.push_back(points[i]);
+      mapIndex.push_back(i);
+    } else {
+      const Double_t xyz[3] = {points[i].X(), points[i].Y(), points[i].Z()};
+      MachineField(xyz, bField[i].data());
+    }
+  }
+  if (mapPoints.empty()) {
+    return;
+  }
+  std::vector<std::array<double, 3>> mapField(mapPoints.size());
+  for (size_t k = 0; k < mapPoints.size(); k++) {
+    mapField[k] = bField[mapIndex[k]]; // as for a single point the map may leave the field untouched
+  }
+  mMeasuredMap->Field(mapPoints, mapField);
+  for (size_t k = 0; k < mapPoints.size(); k++) {
+    auto& b = bField[mapIndex[k]];
+    double factor = (mapPoints[k].Z() > sSolenoidToDipoleZ || mDipoleOnOffFlag) ? mMultipicativeFactorSolenoid : mMultipicativeFactorDipole;
+    for (int i = 3; i--;) {
+      b[i] = mapField[k][i] * factor;
+    }
+  }
+}
+
 Double_t MagneticField::getBz(const Double_t* xyz) const
 {
   /*
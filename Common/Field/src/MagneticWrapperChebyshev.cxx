@@ -25,6 +25,9 @@
 #include "TNamed.h"     // for TNamed
 #include "TObjArray.h"  // for TObjArray
 #include "TString.h"    // for TString
+#include <algorithm>    // for sort
+#include <utility>      // for pair
+#include <vector>       // for vector
 
 using namespace o2::field;
 using namespace o2::math_utils;
@@ -445,6 +448,74 @@ void MagneticWrapperChebyshev::Field(const Double_t* xyz, Double_t* b) const
   par->Eval(xyz, b);
 }
 
+void MagneticWrapperChebyshev::Field(gsl::span<const Point3D<double>> xyz, gsl::span<std::array<double, 3>> b) const
+{
+  const int np = xyz.size();
+  const int nSol = mNumberOfParameterizationSolenoid;
+  std::vector<std::array<double, 3>> args(np); // cylindrical coordinates for the solenoid, cartesian ones for the dipole
+  std::vector<std::pair<int, int>> segPoints;  // segment (dipole ones after the solenoid ones) and point
+  segPoints.reserve(np);
+
+  for (int i = 0; i < np; i++) {
+    auto& arg = args[i];
+#ifndef _BRING_TO_BOUNDARY_ // exact matching to fitted volume is requested
+    b[i] = {0., 0., 0.};
+#endif
+    int id = -1;
+    Chebyshev3D* par = nullptr;
+    if (xyz[i].Z() > mMinZSolenoid) {
+      const Double_t pnt[3] = {xyz[i].X(), xyz[i].Y(), xyz[i].Z()};
+      cartesianToCylindrical(pnt, arg.data());
+      if ((id = findSolenoidSegment(arg.data())) >= 0) {
+        par = getParameterSolenoid(id);
+      }
+    } else {
+      arg = {xyz[i].X(), xyz[i].Y(), xyz[i].Z()};
+      if ((id = findDipoleSegment(arg.data())) >= 0) {
+        par = getParameterDipole(id);
+        id += nSol;
+      }
+    }
+    if (!par) {
+      continue;
+    }
+#ifndef _BRING_TO_BOUNDARY_
+    if (!par->isInside(arg.data())) {
+      continue;
+    }
+#endif
+    segPoints.emplace_back(id, i);
+  }
+
+  // evaluate the points segment by segment
+  std::sort(segPoints.begin(), segPoints.end());
+  std::vector<Double_t> argSeg, bSeg;
+  for (size_t first = 0, last = 0; first < segPoints.size(); first = last) {
+    int id = segPoints[first].first;
+    while (last < segPoints.size() && segPoints[last].first == id) {
+      last++;
+    }
+    int n = last - first;
+    argSeg.resize(3 * n);
+    bSeg.resize(3 * n);
+    for (int k = 0; k < n; k++) {
+      std::copy(args[segPoints[first + k].second].begin(), args[segPoints[first + k].second].end(), &argSeg[3 * k]);
+    }
+    Chebyshev3D* par = id < nSol ? getParameterSolenoid(id) : getParameterDipole(id - nSol);
+    par->Eval(argSeg.data(), bSeg.data(), n);
+    for (int k = 0; k < n; k++) {
+      std::copy(&bSeg[3 * k], &bSeg[3 * k + 3], b[segPoints[first + k].second].begin());
+    }
+  }
+
+  // convert solenoid field to cartesian system
+  for (int i = 0; i < np; i++) {
+    if (xyz[i].Z() > mMinZSolenoid) {
+      cylindricalToCartesianCylB(args[i].data(), b[i].data(), b[i].data());
+    }
+  }
+}
+
 Double_t MagneticWrapperChebyshev::getBz(const Double_t* xyz) const
 {
   Double_t rphiz[3];
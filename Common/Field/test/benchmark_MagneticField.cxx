@@ -0,0 +1,78 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+#include "Field/MagneticField.h"
+
+using namespace o2::field;
+
+// points along straight tracks from the vertex through the barrel, as queried by the track propagation
+static std::vector<o2::math_utils::Point3D<double>> createPoints(int nPoints)
+{
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<double> phi(0., 2. * M_PI);
+  std::uniform_real_distribution<double> tgl(-1., 1.);
+  std::vector<o2::math_utils::Point3D<double>> points;
+  const int nSteps = 50;
+  while (points.size() < size_t(nPoints)) {
+    double trkPhi = phi(generator), trkTgl = tgl(generator);
+    for (int istep = 1; istep <= nSteps && points.size() < size_t(nPoints); istep++) {
+      double r = 400. * istep / nSteps;
+      points.emplace_back(r * std::cos(trkPhi), r * std::sin(trkPhi), r * trkTgl);
+    }
+  }
+  return points;
+}
+
+static MagneticField* getField(bool fast)
+{
+  static std::unique_ptr<MagneticField> field = std::make_unique<MagneticField>("Maps", "Maps", 1., 1., MagFieldParam::k5kG);
+  field->AllowFastField(fast);
+  return field.get();
+}
+
+static void BM_FieldSinglePoint(benchmark::State& state)
+{
+  auto field = getField(state.range(1));
+  auto points = createPoints(state.range(0));
+  std::vector<std::array<double, 3>> b(points.size());
+  for (auto _ : state) {
+    for (size_t i = 0; i < points.size(); i++) {
+      double xyz[3] = {points[i].X(), points[i].Y(), points[i].Z()};
+      field->Field(xyz, b[i].data());
+    }
+    benchmark::DoNotOptimize(b.data());
+  }
+  state.counters["points"] = benchmark::Counter(state.iterations() * points.size(), benchmark::Counter::kIsRate);
+}
+
+static void BM_FieldBatch(benchmark::State& state)
+{
+  auto field = getField(state.range(1));
+  auto points = createPoints(state.range(0));
+  std::vector<std::array<double, 3>> b(points.size());
+  for (auto _ : state) {
+    field->Field(points, b);
+    benchmark::DoNotOptimize(b.data());
+  }
+  state.counters["points"] = benchmark::Counter(state.iterations() * points.size(), benchmark::Counter::kIsRate);
+}
+
+// arguments: number of points, fast field
+BENCHMARK(BM_FieldSinglePoint)->Args({1000, 0})->Args({100000, 0})->Args({1000, 1})->Args({100000, 1});
+BENCHMARK(BM_FieldBatch)->Args({1000, 0})->Args({100000, 0})->Args({1000, 1})->Args({100000, 1});
+
+BENCHMARK_MAIN();
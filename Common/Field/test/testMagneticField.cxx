@@ -20,6 +20,8 @@
 #include <fairlogger/Logger.h> // for FairLogger
 #include <TStopwatch.h>
 #include <TRandom.h>
+#include <array>
+#include <vector>
 
 using namespace o2::field;
 
@@ -98,3 +100,35 @@ BOOST_AUTO_TEST_CASE(MagneticField_test)
     BOOST_CHECK(TMath::Abs(rms[i] / nomBz) < 1.e-3);
   }
 }
+
+BOOST_AUTO_TEST_CASE(MagneticFieldBatch_test)
+{
+  std::unique_ptr<MagneticField> fld = std::make_unique<MagneticField>("Maps", "Maps", 1., 1., o2::field::MagFieldParam::k5kG);
+
+  // points in the solenoid, in the dipole and outside of the parameterized regions
+  const int ntst = 10000;
+  float rnd[3];
+  std::vector<o2::math_utils::Point3D<double>> xyz(ntst);
+  for (int it = ntst; it--;) {
+    gRandom->RndmArray(3, rnd);
+    xyz[it].SetCoordinates(rnd[0] * 600. * TMath::Cos(rnd[1] * TMath::Pi() * 2), rnd[0] * 600. * TMath::Sin(rnd[1] * TMath::Pi() * 2), (rnd[2] - 0.5) * 3000.);
+  }
+
+  for (bool fast : {false, true}) {
+    fld->AllowFastField(fast);
+    std::vector<std::array<double, 3>> bxyz(ntst);
+    fld->Field(xyz, bxyz);
+    int nDiff = 0;
+    for (int it = ntst; it--;) {
+      double pnt[3] = {xyz[it].X(), xyz[it].Y(), xyz[it].Z()}, b[3] = {0., 0., 0.};
+      fld->Field(pnt, b);
+      for (int i = 0; i < 3; i++) {
+        if (TMath::Abs(b[i] - bxyz[it][i]) > 1.e-6 * (1. + TMath::Abs(b[i]))) {
+          nDiff++;
+        }
+      }
+    }
+    LOG(info) << "Batched " << (fast ? "fast" : "exact") << " field: " << nDiff << " components differing from single point queries";
+    BOOST_CHECK(nDiff == 0);
+  }
+}
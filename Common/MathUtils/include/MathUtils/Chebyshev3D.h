@@ -136,6 +136,10 @@ class Chebyshev3D : public TNamed
 
   Double_t Eval(const Double_t* par, int idim);
 
+  /// Evaluates the parameterization for np points, par[3 * i ... 3 * i + 2] being the i-th point, the result
+  /// for the i-th point being stored in res[DimOut * i ... DimOut * i + DimOut - 1]
+  void Eval(const Double_t* par, Double_t* res, int np) const;
+
   void evaluateDerivative(int dimd, const Float_t* par, Float_t* res);
 
   void evaluateDerivative2(int dimd1, int dimd2, const Float_t* par, Float_t* res);
@@ -169,6 +169,21 @@ class Chebyshev3DCalc : public TNamed
 
   Double_t Eval(const Double_t* par) const;
 
+  /// number of points evaluated together by the batched evaluation
+  static constexpr int BatchSize = 16;
+
+  /// Evaluates Chebyshev parameterization for np points of 3D function, par0[i], par1[i], par2[i] being the arguments
+  /// of the i-th point ALREADY MAPPED to [-1:1] interval. The points are processed in blocks of BatchSize, the
+  /// summations running over the points of the block in the innermost loop, so that they can be vectorized
+  void Eval(const Float_t* par0, const Float_t* par1, const Float_t* par2, Float_t* res, int np) const;
+
+  /// Evaluates 1D Chebyshev parameterization with the same coefficients for np <= BatchSize arguments
+  static void chebyshevEvaluation1D(const Float_t* x, const Float_t* array, int ncf, Float_t* res, int np);
+
+  /// Evaluates 1D Chebyshev parameterization for np <= BatchSize arguments, the coefficients of the i-th argument
+  /// being array[k * BatchSize + i]
+  static void chebyshevEvaluation1DBlock(const Float_t* x, const Float_t* array, int ncf, Float_t* res, int np);
+
  private:
   Int_t mNumberOfCoefficients;    ///< total number of coeeficients
   Int_t mNumberOfRows;            ///< number of significant rows in the 3D coeffs matrix
@@ -244,6 +259,56 @@ inline Double_t Chebyshev3DCalc::Eval(const Double_t* par) const
   }
   return chebyshevEvaluation1D(par[0], mTemporaryCoefficients1D, mNumberOfRows);
 }
+
+inline void Chebyshev3DCalc::chebyshevEvaluation1D(const Float_t* x, const Float_t* array, int ncf, Float_t* res, int np)
+{
+  if (ncf <= 0) {
+    for (int i = 0; i < np; i++) {
+      res[i] = 0;
+    }
+    return;
+  }
+  Float_t b0[BatchSize], b1[BatchSize];
+  for (int i = 0; i < np; i++) {
+    b0[i] = array[ncf - 1];
+    b1[i] = 0;
+  }
+  for (int k = ncf - 1; k--;) {
+    for (int i = 0; i < np; i++) {
+      Float_t b2 = b1[i];
+      b1[i] = b0[i];
+      b0[i] = array[k] + (x[i] + x[i]) * b1[i] - b2;
+    }
+  }
+  for (int i = 0; i < np; i++) {
+    res[i] = b0[i] - x[i] * b1[i];
+  }
+}
+
+inline void Chebyshev3DCalc::chebyshevEvaluation1DBlock(const Float_t* x, const Float_t* array, int ncf, Float_t* res, int np)
+{
+  if (ncf <= 0) {
+    for (int i = 0; i < np; i++) {
+      res[i] = 0;
+    }
+    return;
+  }
+  Float_t b0[BatchSize], b1[BatchSize];
+  for (int i = 0; i < np; i++) {
+    b0[i] = array[(ncf - 1) * BatchSize + i];
+    b1[i] = 0;
+  }
+  for (int k = ncf - 1; k--;) {
+    for (int i = 0; i < np; i++) {
+      Float_t b2 = b1[i];
+      b1[i] = b0[i];
+      b0[i] = array[k * BatchSize + i] + (x[i] + x[i]) * b1[i] - b2;
+    }
+  }
+  for (int i = 0; i < np; i++) {
+    res[i] = b0[i] - x[i] * b1[i];
+  }
+}
 } // namespace math_utils
 } // namespace o2
 
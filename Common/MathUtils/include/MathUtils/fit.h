@@ -449,6 +449,94 @@ double fitGaus(size_t nBins, const T* arr, const T xMin, const T xMax, std::arra
   return np > 3 ? chi2 / (np - 3.) : 0.;
 }
 
+/// Least squares fit of a gamma-like pulse shape, as produced by the shapers of the calorimeter front-ends
+///
+///   f(x) = amp * z^order * exp(order * (1 - z)), z = 1 + (x - peak) / tau, f(x) = 0 for z <= 0
+///
+/// with free amplitude and peak position and fixed order and shaping time tau.
+/// The samples y[i] are taken at x = i. The fit is done with Levenberg-Marquardt iterations,
+/// solving the 2x2 normal equations analytically, so that no allocation is done.
+/// The parameters are kept inside the given limits.
+///
+/// \param[in]      nSamples number of samples
+/// \param[in]      y        array with the samples
+/// \param[in]      order    order of the shaping
+/// \param[in]      tau      shaping time in units of the sampling interval
+/// \param[in,out]  param    amplitude and peak position, initial guess on input and fit result on output
+/// \param[in]      limits   allowed range of the parameters: min. amplitude, max. amplitude, min. peak, max. peak
+/// \param[in]      maxIter  maximum number of iterations
+/// \return sum of the squared residuals, negative in case the fit did not converge
+template <typename T>
+double fitGammaPulse(int nSamples, const T* y, double order, double tau, std::array<double, 2>& param,
+                     const std::array<double, 4>& limits, int maxIter = 30)
+{
+  if (nSamples < 3) {
+    return -1.;
+  }
+  // chi2, gradient and approximate hessian J^T J of the chi2 for the given parameters
+  auto evaluate = [nSamples, y, order, tau](double amp, double peak, double& h00, double& h01, double& h11, double& g0, double& g1) {
+    double chi2 = 0.;
+    h00 = h01 = h11 = g0 = g1 = 0.;
+    for (int i = 0; i < nSamples; i++) {
+      double z = 1. + (i - peak) / tau;
+      double dfda = 0., dfdp = 0.;
+      if (z > 0.) {
+        dfda = std::pow(z, order) * std::exp(order * (1. - z));
+        dfdp = amp * order * dfda * (z - 1.) / (z * tau);
+      }
+      double r = y[i] - amp * dfda;
+      chi2 += r * r;
+      h00 += dfda * dfda;
+      h01 += dfda * dfdp;
+      h11 += dfdp * dfdp;
+      g0 += dfda * r;
+      g1 += dfdp * r;
+    }
+    return chi2;
+  };
+  auto clamp = [](double v, double vmin, double vmax) { return v < vmin ? vmin : (v > vmax ? vmax : v); };
+
+  double amp = clamp(param[0], limits[0], limits[1]), peak = clamp(param[1], limits[2], limits[3]);
+  double h00, h01, h11, g0, g1;
+  double chi2 = evaluate(amp, peak, h00, h01, h11, g0, g1);
+  double lambda = 1.e-3;
+  for (int iter = 0; iter < maxIter; iter++) {
+    double a00 = h00 * (1. + lambda), a11 = h11 * (1. + lambda);
+    double det = a00 * a11 - h01 * h01;
+    if (det <= 0.) {
+      return -1.;
+    }
+    double newAmp = clamp(amp + (a11 * g0 - h01 * g1) / det, limits[0], limits[1]);
+    double newPeak = clamp(peak + (a00 * g1 - h01 * g0) / det, limits[2], limits[3]);
+    double n00, n01, n11, ng0, ng1;
+    double newChi2 = evaluate(newAmp, newPeak, n00, n01, n11, ng0, ng1);
+    if (newChi2 <= chi2) {
+      bool converged = std::abs(newAmp - amp) <= 1.e-5 * std::abs(amp) + 1.e-6 && std::abs(newPeak - peak) <= 1.e-5;
+      amp = newAmp;
+      peak = newPeak;
+      chi2 = newChi2;
+      h00 = n00;
+      h01 = n01;
+      h11 = n11;
+      g0 = ng0;
+      g1 = ng1;
+      lambda *= 0.1;
+      if (converged) {
+        param = {amp, peak};
+        return chi2;
+      }
+    } else {
+      lambda *= 10.;
+      if (lambda > 1.e10) { // no further improvement possible, we are at the minimum within the limits
+        param = {amp, peak};
+        return chi2;
+      }
+    }
+  }
+  param = {amp, peak};
+  return -1.;
+}
+
 /// struct for returning statistical parameters
 ///
 /// \todo make type templated?
@@ -27,6 +27,7 @@
 #include "TNamed.h"                    // for TNamed
 #include "TObjArray.h"                 // for TObjArray
 #include <fairlogger/Logger.h>         // for FairLogger
+#include <vector>                      // for vector
 
 using namespace o2::math_utils;
 
@@ -288,6 +289,22 @@ Chebyshev3D& Chebyshev3D::operator=(const Chebyshev3D& rhs)
   return *this;
 }
 
+void Chebyshev3D::Eval(const Double_t* par, Double_t* res, int np) const
+{
+  std::vector<Float_t> mapped(3 * np), calc(np);
+  for (int i = 0; i < np; i++) {
+    for (int j = 3; j--;) {
+      mapped[j * np + i] = mapToInternal(par[3 * i + j], j);
+    }
+  }
+  for (int j = mOutputArrayDimension; j--;) {
+    getChebyshevCalc(j)->Eval(mapped.data(), mapped.data() + np, mapped.data() + 2 * np, calc.data(), np);
+    for (int i = 0; i < np; i++) {
+      res[mOutputArrayDimension * i + j] = calc[i];
+    }
+  }
+}
+
 void Chebyshev3D::Clear(const Option_t*)
 {
   // clear all dynamic structures
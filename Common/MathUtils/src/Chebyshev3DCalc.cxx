@@ -17,6 +17,8 @@
 #include <TSystem.h> // for TSystem, gSystem
 #include "TNamed.h"  // for TNamed
 #include "TString.h" // for TString, TString::EStripType::kBoth
+#include <algorithm>
+#include <vector>
 
 using namespace o2::math_utils;
 
@@ -203,6 +205,24 @@ void Chebyshev3DCalc::Print(const Option_t*) const
   printf("%d coefficients in %dx%dx%d matrix\n", mNumberOfCoefficients, mNumberOfRows, mNumberOfColumns, nmax3d);
 }
 
+void Chebyshev3DCalc::Eval(const Float_t* par0, const Float_t* par1, const Float_t* par2, Float_t* res, int np) const
+{
+  std::vector<Float_t> coefs2D(mNumberOfColumns * BatchSize), coefs1D(mNumberOfRows * BatchSize);
+  for (int ip = 0; ip < np; ip += BatchSize) {
+    int nb = std::min(BatchSize, np - ip);
+    for (int id0 = mNumberOfRows; id0--;) {
+      int nCLoc = mNumberOfColumnsAtRow[id0]; // number of significant coefs on this row
+      int col0 = mColumnAtRowBeginning[id0];  // beginning of local column in the 2D boundary matrix
+      for (int id1 = nCLoc; id1--;) {
+        int id = id1 + col0;
+        chebyshevEvaluation1D(par2 + ip, mCoefficients + mCoefficientBound2D1[id], mCoefficientBound2D0[id], &coefs2D[id1 * BatchSize], nb);
+      }
+      chebyshevEvaluation1DBlock(par1 + ip, coefs2D.data(), nCLoc, &coefs1D[id0 * BatchSize], nb);
+    }
+    chebyshevEvaluation1DBlock(par0 + ip, coefs1D.data(), mNumberOfRows, res + ip, nb);
+  }
+}
+
 Float_t Chebyshev3DCalc::evaluateDerivative(int dim, const Float_t* par) const
 {
   int ncfRC;
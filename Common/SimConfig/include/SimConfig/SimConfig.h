@@ -72,6 +72,7 @@ struct SimConfigData {
   int mInternalChunkSize;                             //
   ULong_t mStartSeed;                                 // base for random number seeds
   int mSimWorkers = 1;                                // number of parallel sim workers (when it applies)
+  int mGenThreads = 1;                                // number of threads (generator instances) generating events in the primary server
   bool mFilterNoHitEvents = false;                    // whether to filter out events not leaving any response
   std::string mCCDBUrl;                               // the URL where to find CCDB
   uint64_t mTimestamp;                                // timestamp in ms to anchor transport simulation to
@@ -86,9 +87,10 @@ struct SimConfigData {
                                                       //
   bool mForwardKine = false;                          // true if tracks and event headers are to be published on a FairMQ channel (for reading by other consumers)
   bool mWriteToDisc = true;                           // whether we write simulation products (kine, hits) to disc
+  bool mWriteKineSidecar = false;                     // whether the kinematics is also written as flat file for memory mapped reading
   VertexMode mVertexMode = VertexMode::kDiamondParam; // by default we should use die InteractionDiamond parameter
 
-  ClassDefNV(SimConfigData, 4);
+  ClassDefNV(SimConfigData, 6);
 };
 
 // A singleton class which can be used
@@ -168,6 +170,7 @@ class SimConfig
   int getInternalChunkSize() const { return mConfigData.mInternalChunkSize; }
   ULong_t getStartSeed() const { return mConfigData.mStartSeed; }
   int getNSimWorkers() const { return mConfigData.mSimWorkers; }
+  int getNGenThreads() const { return mConfigData.mGenThreads; }
   bool isFilterOutNoHitEvents() const { return mConfigData.mFilterNoHitEvents; }
   bool asService() const { return mConfigData.mAsService; }
   uint64_t getTimestamp() const { return mConfigData.mTimestamp; }
@@ -176,6 +179,7 @@ class SimConfig
   void setRun5(bool value = true) { mConfigData.mIsUpgrade = value; }
   bool forwardKine() const { return mConfigData.mForwardKine; }
   bool writeToDisc() const { return mConfigData.mWriteToDisc; }
+  bool writeKineSidecar() const { return mConfigData.mWriteKineSidecar; }
   VertexMode getVertexMode() const { return mConfigData.mVertexMode; }
 
   // returns the pair of collision context filename as well as event prefix encoded
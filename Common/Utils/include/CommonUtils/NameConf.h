@@ -48,6 +48,12 @@ class NameConf : public o2::conf::ConfigurableParamHelper<NameConf>
     return o2::utils::Str::concat_string(prefix, "_", KINE_STRING, ".root");
   }
 
+  // Filename of the flat binary copy of the kinematics (for memory mapped access)
+  static std::string getMCKinematicsSidecarFileName(const std::string_view prefix = STANDARDSIMPREFIX)
+  {
+    return o2::utils::Str::concat_string(prefix, "_", KINE_STRING, ".flat");
+  }
+
   // Filename to store kinematics + TrackRefs
   static std::string getMCHeadersFileName(const std::string_view prefix = STANDARDSIMPREFIX)
   {
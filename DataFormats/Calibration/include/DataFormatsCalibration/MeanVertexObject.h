@@ -16,6 +16,8 @@
 #include "Framework/Logger.h"
 #include "ReconstructionDataFormats/Vertex.h"
 
+class TRandom;
+
 namespace o2
 {
 namespace dataformats
@@ -72,6 +74,9 @@ class MeanVertexObject : public VertexBase
   /// sample a vertex from the MeanVertex parameters
   math_utils::Point3D<float> sample() const;
 
+  /// sample a vertex from the MeanVertex parameters using the given random generator
+  math_utils::Point3D<float> sample(TRandom& rng) const;
+
   VertexBase getMeanVertex(float z) const
   {
     // set z-dependent x,z, assuming that the cov.matrix is already set
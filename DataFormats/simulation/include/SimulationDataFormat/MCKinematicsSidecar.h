@@ -0,0 +1,112 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file MCKinematicsSidecar.h
+/// \brief Flat binary copy of the MC kinematics, to be accessed via a memory mapping
+
+#ifndef ALICEO2_DATAFORMATS_MCKINEMATICSSIDECAR_H_
+#define ALICEO2_DATAFORMATS_MCKINEMATICSSIDECAR_H_
+
+#include "SimulationDataFormat/MCTrack.h"
+#include <gsl/span>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace o2
+{
+namespace dataformats
+{
+
+/// The sidecar file stores the tracks of the kinematics file without any ROOT serialization:
+///
+///   [MCTrack of event 0 ... event N-1][padding][uint64_t offsets[N + 1]][MCKinematicsSidecarTrailer]
+///
+/// where offsets[i] is the index of the first track of event i. Event i corresponds to entry i
+/// of the kinematics tree. The trailer is rewritten after every flush, so that a file is always
+/// readable up to the last flushed event.
+struct MCKinematicsSidecarTrailer {
+  static constexpr uint32_t VERSION = 1;
+
+  uint64_t nEvents = 0;       // number of events
+  uint64_t indexPosition = 0; // byte position of the offsets array
+  uint32_t sizeofTrack = sizeof(MCTrack);
+  uint32_t version = VERSION;
+  char magic[8] = {'O', '2', 'K', 'I', 'N', 'E', 'F', 'L'};
+};
+
+static_assert(std::is_trivially_copyable<MCTrack>::value, "MCTrack must be trivially copyable to be written as flat data");
+
+/// Writes the sidecar file event by event
+class MCKinematicsSidecarWriter
+{
+ public:
+  MCKinematicsSidecarWriter() = default;
+  ~MCKinematicsSidecarWriter() { close(); }
+
+  /// (re)creates the file; returns false if it can't be opened
+  bool open(std::string const& filename);
+  bool isOpen() const { return mFile.is_open(); }
+
+  /// appends the tracks of the next event
+  void addEvent(std::vector<MCTrack> const& tracks);
+
+  /// writes the event index and the trailer so that the file can be read
+  void flush();
+
+  /// flushes and closes the file
+  void close();
+
+ private:
+  std::ofstream mFile;
+  std::vector<uint64_t> mOffsets{0}; // index of the first track per event + total number of tracks
+  bool mFlushed = true;              // whether the index on file is up to date
+};
+
+/// Gives access to the tracks of a sidecar file mapped into memory.
+/// Lookups are O(1) and the tracks are only paged in when accessed.
+class MCKinematicsSidecarReader
+{
+ public:
+  MCKinematicsSidecarReader() = default;
+  ~MCKinematicsSidecarReader() { close(); }
+  MCKinematicsSidecarReader(MCKinematicsSidecarReader const&) = delete;
+  MCKinematicsSidecarReader& operator=(MCKinematicsSidecarReader const&) = delete;
+
+  /// maps the file; returns false if it doesn't exist or isn't a valid sidecar file
+  bool open(std::string const& filename);
+  void close();
+  bool isOpen() const { return mMapped != nullptr; }
+
+  size_t getNEvents() const { return mNEvents; }
+
+  /// all tracks of an event
+  gsl::span<const MCTrack> getTracks(int event) const
+  {
+    return gsl::span<const MCTrack>(mTracks + mOffsets[event], mOffsets[event + 1] - mOffsets[event]);
+  }
+
+  MCTrack const* getTrack(int event, int track) const { return mTracks + mOffsets[event] + track; }
+
+ private:
+  void* mMapped = nullptr;
+  size_t mMappedSize = 0;
+  MCTrack const* mTracks = nullptr;
+  uint64_t const* mOffsets = nullptr;
+  size_t mNEvents = 0;
+};
+
+} // namespace dataformats
+} // namespace o2
+
+#endif
@@ -0,0 +1,136 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file MCTruthContainerBuilder.h
+/// \brief Helper to fill a MCTruthContainer with labels arriving in arbitrary data index order
+
+#ifndef ALICEO2_DATAFORMATS_MCTRUTHBUILDER_H_
+#define ALICEO2_DATAFORMATS_MCTRUTHBUILDER_H_
+
+#include "SimulationDataFormat/MCTruthContainer.h"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace o2
+{
+namespace dataformats
+{
+
+/// @class MCTruthContainerBuilder
+/// @brief Collects (dataindex, label) pairs in any order and produces a MCTruthContainer
+///
+/// This is the append-only alternative to MCTruthContainer::addElementRandomAccess, which has
+/// to move all the labels and headers behind the insertion point for every label attached to a
+/// previous data index. Here the pairs are only appended to two buffers; the final container
+/// (or its flat ConstMCTruthContainer representation) is produced by one counting sort pass.
+/// Labels of the same data index keep the order in which they were added, so that the result
+/// is identical to the one obtained with addElementRandomAccess.
+template <typename TruthElement>
+class MCTruthContainerBuilder
+{
+ public:
+  using container_type = MCTruthContainer<TruthElement>;
+
+  void reserve(size_t nElements)
+  {
+    mDataIndices.reserve(nElements);
+    mElements.reserve(nElements);
+  }
+
+  /// add a label for the given dataindex; the data indices can come in any order
+  void addElement(uint32_t dataindex, TruthElement const& element)
+  {
+    mDataIndices.emplace_back(dataindex);
+    mElements.emplace_back(element);
+    mIndexedSize = std::max<size_t>(mIndexedSize, dataindex + 1);
+  }
+
+  /// declare a data index without adding a label to it
+  void addNoLabelIndex(uint32_t dataindex)
+  {
+    mIndexedSize = std::max<size_t>(mIndexedSize, dataindex + 1);
+  }
+
+  // return the number of data indices the final container will have
+  size_t getIndexedSize() const { return mIndexedSize; }
+  // return the number of labels added so far
+  size_t getNElements() const { return mElements.size(); }
+
+  void clear()
+  {
+    mDataIndices.clear();
+    mElements.clear();
+    mIndexedSize = 0;
+  }
+
+  /// Fill the container (its previous content is replaced) with the collected labels
+  void fill(container_type& container) const
+  {
+    std::vector<MCTruthHeaderElement> header(mIndexedSize);
+    std::vector<TruthElement> truthArray(mElements.size());
+    sortInto(header.data(), truthArray.data());
+    container.setFrom(header, truthArray);
+  }
+
+  container_type build() const
+  {
+    container_type container;
+    fill(container);
+    return container;
+  }
+
+  /// Write the collected labels directly in the flat format of MCTruthContainer::flatten_to,
+  /// e.g. into a ConstMCTruthContainer, without creating an intermediate MCTruthContainer
+  template <typename ContainerType>
+  size_t flatten_to(ContainerType& container) const
+  {
+    using FlatHeader = typename container_type::FlatHeader;
+    size_t bufferSize = sizeof(FlatHeader) + sizeof(MCTruthHeaderElement) * mIndexedSize + sizeof(TruthElement) * mElements.size();
+    container.resize((bufferSize / sizeof(typename ContainerType::value_type)) + ((bufferSize % sizeof(typename ContainerType::value_type)) > 0 ? 1 : 0));
+    char* target = reinterpret_cast<char*>(container.data());
+    auto& flatheader = *reinterpret_cast<FlatHeader*>(target);
+    flatheader = FlatHeader{};
+    flatheader.nofHeaderElements = mIndexedSize;
+    flatheader.nofTruthElements = mElements.size();
+    target += sizeof(FlatHeader);
+    auto header = reinterpret_cast<MCTruthHeaderElement*>(target);
+    target += sizeof(MCTruthHeaderElement) * mIndexedSize;
+    sortInto(header, reinterpret_cast<TruthElement*>(target));
+    return bufferSize;
+  }
+
+ private:
+  // counting sort of the labels by data index into the preallocated header and truth arrays
+  void sortInto(MCTruthHeaderElement* header, TruthElement* truthArray) const
+  {
+    std::vector<uint32_t> cursor(mIndexedSize + 1, 0);
+    for (auto dataindex : mDataIndices) {
+      cursor[dataindex + 1]++;
+    }
+    for (size_t i = 0; i < mIndexedSize; ++i) {
+      cursor[i + 1] += cursor[i];
+      header[i] = MCTruthHeaderElement(cursor[i]);
+    }
+    for (size_t i = 0; i < mElements.size(); ++i) {
+      truthArray[cursor[mDataIndices[i]]++] = mElements[i];
+    }
+  }
+
+  std::vector<uint32_t> mDataIndices;  // data index of each label
+  std::vector<TruthElement> mElements; // the labels in order of arrival
+  size_t mIndexedSize = 0;             // largest data index seen + 1
+};
+
+} // namespace dataformats
+} // namespace o2
+
+#endif
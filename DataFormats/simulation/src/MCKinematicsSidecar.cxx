@@ -0,0 +1,134 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#include "SimulationDataFormat/MCKinematicsSidecar.h"
+#include <fairlogger/Logger.h>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace o2::dataformats;
+
+namespace
+{
+// the offsets array starts at the first 8 byte aligned position after the tracks
+uint64_t indexPositionFor(uint64_t nTracks)
+{
+  const uint64_t dataSize = nTracks * sizeof(o2::MCTrack);
+  return (dataSize + alignof(uint64_t) - 1) / alignof(uint64_t) * alignof(uint64_t);
+}
+} // namespace
+
+bool MCKinematicsSidecarWriter::open(std::string const& filename)
+{
+  close();
+  mOffsets.assign(1, 0);
+  mFile.open(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!mFile.is_open()) {
+    LOG(error) << "Could not open MC kinematics sidecar file " << filename;
+    return false;
+  }
+  mFlushed = false;
+  flush();
+  return true;
+}
+
+void MCKinematicsSidecarWriter::addEvent(std::vector<MCTrack> const& tracks)
+{
+  if (!mFile.is_open()) {
+    return;
+  }
+  // the new tracks overwrite the index and trailer written by a previous flush
+  mFile.seekp(mOffsets.back() * sizeof(MCTrack));
+  mFile.write(reinterpret_cast<const char*>(tracks.data()), tracks.size() * sizeof(MCTrack));
+  mOffsets.push_back(mOffsets.back() + tracks.size());
+  mFlushed = false;
+}
+
+void MCKinematicsSidecarWriter::flush()
+{
+  if (!mFile.is_open() || mFlushed) {
+    return;
+  }
+  MCKinematicsSidecarTrailer trailer;
+  trailer.nEvents = mOffsets.size() - 1;
+  trailer.indexPosition = indexPositionFor(mOffsets.back());
+  const uint64_t padding = 0;
+  mFile.seekp(mOffsets.back() * sizeof(MCTrack));
+  mFile.write(reinterpret_cast<const char*>(&padding), trailer.indexPosition - mOffsets.back() * sizeof(MCTrack));
+  mFile.write(reinterpret_cast<const char*>(mOffsets.data()), mOffsets.size() * sizeof(uint64_t));
+  mFile.write(reinterpret_cast<const char*>(&trailer), sizeof(trailer));
+  mFile.flush();
+  mFlushed = true;
+}
+
+void MCKinematicsSidecarWriter::close()
+{
+  if (mFile.is_open()) {
+    flush();
+    mFile.close();
+  }
+}
+
+bool MCKinematicsSidecarReader::open(std::string const& filename)
+{
+  close();
+  int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat info;
+  if (fstat(fd, &info) != 0 || info.st_size < (off_t)sizeof(MCKinematicsSidecarTrailer)) {
+    ::close(fd);
+    return false;
+  }
+  void* mapped = mmap(nullptr, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd); // the mapping stays valid
+  if (mapped == MAP_FAILED) {
+    LOG(warn) << "Could not map MC kinematics sidecar file " << filename;
+    return false;
+  }
+  mMapped = mapped;
+  mMappedSize = info.st_size;
+
+  // the file may still be written to, in which case its size is not consistent with the trailer
+  MCKinematicsSidecarTrailer trailer;
+  const MCKinematicsSidecarTrailer expected;
+  std::memcpy(&trailer, static_cast<const char*>(mapped) + mMappedSize - sizeof(trailer), sizeof(trailer));
+  if (std::memcmp(trailer.magic, expected.magic, sizeof(trailer.magic)) != 0 || trailer.version != expected.version || trailer.sizeofTrack != expected.sizeofTrack || trailer.indexPosition + (trailer.nEvents + 1) * sizeof(uint64_t) + sizeof(trailer) != mMappedSize) {
+    LOG(warn) << "MC kinematics sidecar file " << filename << " is not valid; ignoring it";
+    close();
+    return false;
+  }
+  mTracks = static_cast<MCTrack const*>(mapped);
+  mOffsets = reinterpret_cast<uint64_t const*>(static_cast<const char*>(mapped) + trailer.indexPosition);
+  mNEvents = trailer.nEvents;
+  if (indexPositionFor(mOffsets[mNEvents]) != trailer.indexPosition) {
+    LOG(warn) << "MC kinematics sidecar file " << filename << " has an inconsistent index; ignoring it";
+    close();
+    return false;
+  }
+  return true;
+}
+
+void MCKinematicsSidecarReader::close()
+{
+  if (mMapped) {
+    munmap(mMapped, mMappedSize);
+  }
+  mMapped = nullptr;
+  mMappedSize = 0;
+  mTracks = nullptr;
+  mOffsets = nullptr;
+  mNEvents = 0;
+}
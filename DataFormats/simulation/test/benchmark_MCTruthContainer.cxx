@@ -0,0 +1,78 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <utility>
+#include <vector>
+#include "SimulationDataFormat/MCCompLabel.h"
+#include "SimulationDataFormat/ConstMCTruthContainer.h"
+#include "SimulationDataFormat/MCTruthContainerBuilder.h"
+
+using namespace o2::dataformats;
+
+// (dataindex, label) pairs as produced by a digitizer with pile-up: about 1.3 labels
+// per digit, where the additional labels come for digits created earlier
+static std::vector<std::pair<uint32_t, o2::MCCompLabel>> createLabels(int nLabels)
+{
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<float> flat(0., 1.);
+  std::vector<std::pair<uint32_t, o2::MCCompLabel>> labels;
+  labels.reserve(nLabels);
+  uint32_t nDigits = 0;
+  for (int i = 0; i < nLabels; ++i) {
+    uint32_t dataindex = nDigits;
+    if (nDigits > 0 && flat(generator) < 0.25) {
+      dataindex = std::uniform_int_distribution<uint32_t>(0, nDigits - 1)(generator);
+    } else {
+      nDigits++;
+    }
+    labels.emplace_back(dataindex, o2::MCCompLabel(i, i % 100, 0));
+  }
+  return labels;
+}
+
+static void BM_AddElementRandomAccess(benchmark::State& state)
+{
+  auto labels = createLabels(state.range(0));
+  for (auto _ : state) {
+    MCTruthContainer<o2::MCCompLabel> container;
+    for (auto& [dataindex, label] : labels) {
+      container.addElementRandomAccess(dataindex, label);
+    }
+    ConstMCTruthContainer<o2::MCCompLabel> flat;
+    container.flatten_to(flat);
+    benchmark::DoNotOptimize(flat.data());
+  }
+  state.counters["labels/s"] = benchmark::Counter(state.iterations() * labels.size(), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_AddElementRandomAccess)->Arg(1000)->Arg(10000)->Arg(50000);
+
+static void BM_MCTruthContainerBuilder(benchmark::State& state)
+{
+  auto labels = createLabels(state.range(0));
+  MCTruthContainerBuilder<o2::MCCompLabel> builder;
+  for (auto _ : state) {
+    builder.clear();
+    for (auto& [dataindex, label] : labels) {
+      builder.addElement(dataindex, label);
+    }
+    ConstMCTruthContainer<o2::MCCompLabel> flat;
+    builder.flatten_to(flat);
+    benchmark::DoNotOptimize(flat.data());
+  }
+  state.counters["labels/s"] = benchmark::Counter(state.iterations() * labels.size(), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_MCTruthContainerBuilder)->Arg(1000)->Arg(10000)->Arg(50000)->Arg(1000000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,79 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#define BOOST_TEST_MODULE Test MCKinematicsSidecar class
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "SimulationDataFormat/MCKinematicsSidecar.h"
+#include <fstream>
+#include <vector>
+
+using namespace o2;
+using namespace o2::dataformats;
+
+static std::vector<MCTrack> createTracks(int event, int ntracks)
+{
+  std::vector<MCTrack> tracks;
+  for (int i = 0; i < ntracks; ++i) {
+    tracks.emplace_back(211, i - 1, -1, -1, -1, 0.1 * i, 0.2 * event, 1., 0., 0., 0., 0., 0);
+  }
+  return tracks;
+}
+
+BOOST_AUTO_TEST_CASE(MCKinematicsSidecar_test)
+{
+  const std::string filename = "o2sidecartest_Kine.flat";
+  const std::vector<int> ntracks{3, 0, 7, 1};
+  MCKinematicsSidecarWriter writer;
+  BOOST_CHECK(writer.open(filename));
+
+  // an empty file is readable
+  MCKinematicsSidecarReader reader;
+  BOOST_CHECK(reader.open(filename));
+  BOOST_CHECK(reader.getNEvents() == 0);
+
+  // first part of the events
+  writer.addEvent(createTracks(0, ntracks[0]));
+  writer.addEvent(createTracks(1, ntracks[1]));
+  writer.flush();
+  BOOST_CHECK(reader.open(filename));
+  BOOST_CHECK(reader.getNEvents() == 2);
+
+  // the remaining events are appended
+  writer.addEvent(createTracks(2, ntracks[2]));
+  writer.addEvent(createTracks(3, ntracks[3]));
+  writer.close();
+
+  BOOST_CHECK(reader.open(filename));
+  BOOST_CHECK(reader.getNEvents() == ntracks.size());
+  for (int event = 0; event < ntracks.size(); ++event) {
+    auto expected = createTracks(event, ntracks[event]);
+    auto tracks = reader.getTracks(event);
+    BOOST_CHECK(tracks.size() == expected.size());
+    for (int i = 0; i < tracks.size(); ++i) {
+      BOOST_CHECK(tracks[i].GetPdgCode() == 211);
+      BOOST_CHECK(tracks[i].getMotherTrackId() == expected[i].getMotherTrackId());
+      BOOST_CHECK(tracks[i].Px() == expected[i].Px());
+      BOOST_CHECK(tracks[i].Py() == expected[i].Py());
+      BOOST_CHECK(reader.getTrack(event, i) == &tracks[i]);
+    }
+  }
+
+  // a truncated file is refused
+  {
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    out << "O2KINEFL";
+  }
+  BOOST_CHECK(!reader.open(filename));
+  BOOST_CHECK(!reader.isOpen());
+  BOOST_CHECK(!reader.open("nonexisting_Kine.flat"));
+}
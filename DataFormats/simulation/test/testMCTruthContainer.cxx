@@ -15,6 +15,7 @@
 #include <boost/test/unit_test.hpp>
 #include "SimulationDataFormat/MCCompLabel.h"
 #include "SimulationDataFormat/ConstMCTruthContainer.h"
+#include "SimulationDataFormat/MCTruthContainerBuilder.h"
 #include "SimulationDataFormat/LabelContainer.h"
 #include "SimulationDataFormat/IOMCTruthContainerView.h"
 #include <algorithm>
@@ -167,6 +168,54 @@ BOOST_AUTO_TEST_CASE(MCTruth_RandomAccess)
   }
 }
 
+BOOST_AUTO_TEST_CASE(MCTruthContainer_Builder)
+{
+  using TruthElement = o2::MCCompLabel;
+  dataformats::MCTruthContainer<TruthElement> container;
+  dataformats::MCTruthContainerBuilder<TruthElement> builder;
+  // labels arriving out of order for previous data indices, as from pile-up
+  const std::vector<std::pair<uint32_t, int>> input{{0, 1}, {0, 2}, {1, 1}, {2, 10}, {1, 5}, {0, 5}, {3, 20}, {2, 11}, {5, 30}, {3, 21}, {4, 40}, {0, 7}};
+  for (auto& [dataindex, track] : input) {
+    container.addElementRandomAccess(dataindex, TruthElement(track, 0, 0));
+    builder.addElement(dataindex, TruthElement(track, 0, 0));
+  }
+  BOOST_CHECK(builder.getIndexedSize() == container.getIndexedSize());
+  BOOST_CHECK(builder.getNElements() == container.getNElements());
+
+  auto built = builder.build();
+  BOOST_CHECK(built.getIndexedSize() == container.getIndexedSize());
+  BOOST_CHECK(built.getNElements() == container.getNElements());
+  for (uint32_t i = 0; i < container.getIndexedSize(); ++i) {
+    BOOST_CHECK(built.getMCTruthHeader(i).index == container.getMCTruthHeader(i).index);
+    auto expected = container.getLabels(i);
+    auto labels = built.getLabels(i);
+    BOOST_CHECK(std::equal(labels.begin(), labels.end(), expected.begin(), expected.end()));
+  }
+  BOOST_CHECK(built.getLabels(0).size() == 4);
+  BOOST_CHECK(built.getLabels(0)[3] == TruthElement(7, 0, 0));
+
+  // the flat representation is the same as the one of the container
+  dataformats::ConstMCTruthContainer<TruthElement> flatFromContainer;
+  dataformats::ConstMCTruthContainer<TruthElement> flatFromBuilder;
+  container.flatten_to(flatFromContainer);
+  builder.flatten_to(flatFromBuilder);
+  BOOST_CHECK(flatFromContainer == flatFromBuilder);
+
+  // data indices without labels
+  builder.clear();
+  builder.addElement(2, TruthElement(1, 0, 0));
+  builder.addNoLabelIndex(4);
+  builder.addElement(0, TruthElement(2, 0, 0));
+  built = builder.build();
+  BOOST_CHECK(built.getIndexedSize() == 5);
+  BOOST_CHECK(built.getNElements() == 2);
+  BOOST_CHECK(built.getLabels(0).size() == 1);
+  BOOST_CHECK(built.getLabels(1).size() == 0);
+  BOOST_CHECK(built.getLabels(2).size() == 1);
+  BOOST_CHECK(built.getLabels(2)[0] == TruthElement(1, 0, 0));
+  BOOST_CHECK(built.getLabels(4).size() == 0);
+}
+
 BOOST_AUTO_TEST_CASE(MCTruthContainer_flatten)
 {
   using TruthElement = long;
@@ -64,6 +64,7 @@ class MatLayerCylSet : public o2::gpu::FlatObject
   GPUd() const MatLayerCyl& getLayer(int i) const { return get()->mLayers[i]; }
 
   GPUd() bool getLayersRange(const Ray& ray, short& lmin, short& lmax) const;
+  GPUd() bool getLayersRange(int lmnInt, int lmxInt, short& lmin, short& lmax) const;
   GPUd() float getRMin() const { return get()->mRMin; }
   GPUd() float getRMax() const { return get()->mRMax; }
   GPUd() float getZMax() const { return get()->mZMax; }
@@ -101,6 +102,26 @@ class MatLayerCylSet : public o2::gpu::FlatObject
 #endif // !GPUCA_ALIGPUCODE
   GPUd() MatBudget getMatBudget(float x0, float y0, float z0, float x1, float y1, float z1) const;
 
+  /// accounts material of layers lmin:lmax crossed by the ray, rval must be default initialized
+  GPUd() void accountLayers(Ray& ray, short lmin, short lmax, MatBudget& rval) const;
+
+#ifndef GPUCA_ALIGPUCODE // this part is unvisible on GPU version
+  static constexpr int BatchSize = 16; ///< number of rays set up together by the batch getMatBudget
+
+  /// radial intervals of the last processed ray, to be kept by the caller (one per thread) between batches
+  struct MatBudgetCache {
+    int intervalMin = -1; ///< R2 interval of the ray point closest to the beam line
+    int intervalMax = -1; ///< R2 interval of the ray point farthest from the beam line
+  };
+
+  /// material budget for n rays given by the SoA arrays of their end points, the result is identical to the one of single ray query
+  void getMatBudget(const float* x0, const float* y0, const float* z0, const float* x1, const float* y1, const float* z1,
+                    MatBudget* res, int n, MatBudgetCache* cache = nullptr) const;
+
+  /// searches R2 interval, checking first the one used by the previous search
+  int searchSegmentCached(float r2, int high, int& cached) const;
+#endif // !GPUCA_ALIGPUCODE
+
   GPUd() int searchSegment(float val, int low = -1, int high = -1) const;
 
   /// searches a layer based on r2 input, using a lookup table
@@ -27,6 +27,9 @@
 #ifndef GPUCA_GPUCODE
 #include <string>
 #endif
+#ifndef GPUCA_ALIGPUCODE // this part is unvisible on GPU version
+#include <gsl/span>
+#endif // !GPUCA_ALIGPUCODE
 
 namespace o2
 {
@@ -88,6 +91,13 @@ class PropagatorImpl
                            value_type maxSnp = MAX_SIN_PHI, value_type maxStep = MAX_STEP, MatCorrType matCorr = MatCorrType::USEMatCorrLUT,
                            track::TrackLTIntegral* tofInfo = nullptr, int signCorr = 0) const;
 
+#ifndef GPUCA_ALIGPUCODE // this part is unvisible on GPU version
+  /// propagate tracks to the same X in the constant Bz field, same as propagateToX of every track (w/o tofInfo) but doing the steps of all tracks
+  /// together on SoA blocks. Returns the number of successfully propagated tracks, the status of every track is set in the status span if provided
+  int propagateToX(gsl::span<TrackParCov_t> tracks, value_type x, value_type bZ, value_type maxSnp = MAX_SIN_PHI, value_type maxStep = MAX_STEP,
+                   MatCorrType matCorr = MatCorrType::USEMatCorrLUT, int signCorr = 0, gsl::span<bool> status = {}) const;
+#endif // !GPUCA_ALIGPUCODE
+
   template <typename track_T>
   GPUd() bool propagateTo(track_T& track, value_type x, bool bzOnly = false, value_type maxSnp = MAX_SIN_PHI, value_type maxStep = MAX_STEP,
                           MatCorrType matCorr = MatCorrType::USEMatCorrLUT, track::TrackLTIntegral* tofInfo = nullptr, int signCorr = 0) const
@@ -286,6 +286,14 @@ GPUd() MatBudget MatLayerCylSet::getMatBudget(float x0, float y0, float z0, floa
     rval.length = ray.getDist();
     return rval;
   }
+  accountLayers(ray, lmin, lmax, rval);
+  return rval;
+}
+
+//_________________________________________________________________________________________________
+GPUd() void MatLayerCylSet::accountLayers(Ray& ray, short lmin, short lmax, MatBudget& rval) const
+{
+  // accumulate material of the layers lmin:lmax crossed by the ray
   short lrID = lmax;
   while (lrID >= lmin) { // go from outside to inside
     const auto& lr = getLayer(lrID);
@@ -399,7 +407,6 @@ GPUd() MatBudget MatLayerCylSet::getMatBudget(float x0, float y0, float z0, floa
 #ifdef _DBG_LOC_
   printf("<rho> = %e, x2X0 = %e  | step = %e\n", rval.meanRho, rval.meanX2X0, rval.length);
 #endif
-  return rval;
 }
 
 //_________________________________________________________________________________________________
@@ -422,7 +429,13 @@ GPUd() bool MatLayerCylSet::getLayersRange(const Ray& ray, short& lmin, short& l
     lmxInt = rmax2 < getRMax2() ? searchLayerFast(rmax2, 0) : get()->mNRIntervals - 2;
     lmnInt = rmin2 >= getRMin2() ? searchLayerFast(rmin2, 0, lmxInt + 1) : 0;
   }
+  return getLayersRange(lmnInt, lmxInt, lmin, lmax);
+}
 
+//_________________________________________________________________________________________________
+GPUd() bool MatLayerCylSet::getLayersRange(int lmnInt, int lmxInt, short& lmin, short& lmax) const
+{
+  // get range of layers corresponding to R2 intervals of rmin/rmax
   const auto* interval2LrID = get()->mInterval2LrID;
   lmax = interval2LrID[lmxInt];
   lmin = interval2LrID[lmnInt];
@@ -474,6 +487,68 @@ GPUd() int MatLayerCylSet::searchSegment(float val, int low, int high) const
 
 #ifndef GPUCA_ALIGPUCODE // this part is unvisible on GPU version
 
+//_________________________________________________________________________________________________
+void MatLayerCylSet::getMatBudget(const float* x0, const float* y0, const float* z0, const float* x1, const float* y1, const float* z1,
+                                  MatBudget* res, int n, MatBudgetCache* cache) const
+{
+  // get material budget for n rays given by SoA arrays of their end points.
+  // The rays are processed in blocks: the length and min/max R2 needed for the layers selection are evaluated in
+  // branch-free (vectorizable) loops over the block, the R2 intervals are looked up starting from those of the previous
+  // ray, which for consecutive steps of the same track are usually the same, and only the rays crossing the material
+  // are traversed cell by cell, with the same code as the single ray query.
+  MatBudgetCache localCache;
+  auto& hint = cache ? *cache : localCache;
+  float dist[BatchSize], rmin2[BatchSize], rmax2[BatchSize];
+  for (int i0 = 0; i0 < n; i0 += BatchSize) {
+    const int nb = n - i0 < BatchSize ? n - i0 : BatchSize;
+    const float *bx0 = x0 + i0, *by0 = y0 + i0, *bz0 = z0 + i0, *bx1 = x1 + i0, *by1 = y1 + i0, *bz1 = z1 + i0;
+    for (int i = 0; i < nb; i++) { // same as Ray constructor and Ray::getMinMaxR2
+      float dx = bx1[i] - bx0[i], dy = by1[i] - by0[i], dz = bz1[i] - bz0[i];
+      float distXY2 = dx * dx + dy * dy;
+      float distXY2i = distXY2 > Ray::Tiny ? 1.f / distXY2 : 0.f;
+      dist[i] = o2::gpu::CAMath::Sqrt(distXY2 + dz * dz);
+      float tMin = -(bx0[i] * dx + by0[i] * dy) * distXY2i; // closest approach to the beam line
+      float r02 = bx0[i] * bx0[i] + by0[i] * by0[i], r12 = bx1[i] * bx1[i] + by1[i] * by1[i];
+      float xMin = bx0[i] + tMin * dx, yMin = by0[i] + tMin * dy;
+      rmax2[i] = r02 > r12 ? r02 : r12;
+      rmin2[i] = (tMin > 0.f && tMin < 1.f) ? xMin * xMin + yMin * yMin : (r02 > r12 ? r12 : r02);
+    }
+    for (int i = 0; i < nb; i++) {
+      auto& rval = res[i0 + i];
+      rval = MatBudget();
+      if (dist[i] < Ray::MinDistToConsider || rmin2[i] >= getRMax2() || rmax2[i] <= getRMin2()) {
+        rval.length = dist[i];
+        continue;
+      }
+      int lmxInt = rmax2[i] < getRMax2() ? searchSegmentCached(rmax2[i], get()->mNRIntervals, hint.intervalMax) : get()->mNRIntervals - 2;
+      int lmnInt = rmin2[i] >= getRMin2() ? searchSegmentCached(rmin2[i], lmxInt + 1, hint.intervalMin) : 0;
+      short lmin, lmax;
+      if (!getLayersRange(lmnInt, lmxInt, lmin, lmax)) {
+        rval.length = dist[i];
+        continue;
+      }
+      Ray ray(bx0[i], by0[i], bz0[i], bx1[i], by1[i], bz1[i]);
+      accountLayers(ray, lmin, lmax, rval);
+    }
+  }
+}
+
+//_________________________________________________________________________________________________
+int MatLayerCylSet::searchSegmentCached(float r2, int high, int& cached) const
+{
+  // search R2 interval r2 belongs to (r2 MUST be within the boundaries) among the 0:high-1 ones, starting from the cached one.
+  // The upper boundary of the 1st interval is not ordered wrt the following ones (set to the max R2 of the whole set),
+  // so the cached interval is used only if it is followed by the ordered boundaries, to give the same result as the search.
+  const auto* r2Intervals = get()->mR2Intervals;
+  const int nb = get()->mNRIntervals;
+  if (cached >= 0 && cached < high && r2 >= r2Intervals[cached] && r2 < r2Intervals[cached + 1] &&
+      (cached + 2 < nb ? r2Intervals[cached + 1] <= r2Intervals[cached + 2] : cached + 2 == nb)) {
+    return cached;
+  }
+  cached = mInitializedLayerVoxelLU ? searchLayerFast(r2, 0, high) : searchSegment(r2, 0, high);
+  return cached;
+}
+
 void MatLayerCylSet::flatten()
 {
   // make object flat: move all content to single internally allocated buffer
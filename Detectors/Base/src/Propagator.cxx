@@ -721,6 +721,348 @@ GPUd() value_T PropagatorImpl<value_T>::estimateLTFast(o2::track::TrackLTIntegra
   return dcaT;
 }
 
+#ifndef GPUCA_ALIGPUCODE // this part is unvisible on GPU version
+namespace
+{
+/// SoA block of track parameters and covariances, lanes are loaded from / stored to the tracks being propagated
+template <typename value_T, int N>
+struct TrackParCovBlock {
+  using TrackParCov_t = o2::track::TrackParametrizationWithError<value_T>;
+  value_T x[N];                           ///< X of the lane track
+  value_T cosA[N];                        ///< cos of the lane track alpha
+  value_T sinA[N];                        ///< sin of the lane track alpha
+  value_T par[o2::track::kNParams][N];    ///< parameters
+  value_T cov[o2::track::kCovMatSize][N]; ///< covariance matrix elements
+  bool charged[N];                        ///< track has non-0 charge
+  int dir[N];                             ///< propagation direction
+  size_t id[N];                           ///< index of the lane track
+  void load(int lane, const TrackParCov_t& trc)
+  {
+    x[lane] = trc.getX();
+    math_utils::Rotation2D<value_T> rot(trc.getAlpha()); // same as in TrackParametrization::getXYZGlo
+    cosA[lane] = rot.getCos();
+    sinA[lane] = rot.getSin();
+    charged[lane] = trc.getAbsCharge() != 0;
+    for (int i = 0; i < o2::track::kNParams; i++) {
+      par[i][lane] = trc.getParam(i);
+    }
+    for (int i = 0; i < o2::track::kCovMatSize; i++) {
+      cov[i][lane] = trc.getCov()[i];
+    }
+  }
+  void store(int lane, TrackParCov_t& trc) const
+  {
+    trc.setX(x[lane]);
+    for (int i = 0; i < o2::track::kNParams; i++) {
+      trc.setParam(par[i][lane], i);
+    }
+    for (int i = 0; i < o2::track::kCovMatSize; i++) {
+      trc.setCov(cov[i][lane], i);
+    }
+  }
+  // the parameters modified by TrackParametrizationWithError::correctForMaterial, the covariance is loaded in full since
+  // the checkCovariance at the end of the correction may rescale any of its elements
+  void loadMatCorr(int lane, const TrackParCov_t& trc)
+  {
+    par[o2::track::kQ2Pt][lane] = trc.getQ2Pt();
+    for (int i = 0; i < o2::track::kCovMatSize; i++) {
+      cov[i][lane] = trc.getCov()[i];
+    }
+  }
+  void copyLane(int dst, int src)
+  {
+    x[dst] = x[src];
+    cosA[dst] = cosA[src];
+    sinA[dst] = sinA[src];
+    for (int i = 0; i < o2::track::kNParams; i++) {
+      par[i][dst] = par[i][src];
+    }
+    for (int i = 0; i < o2::track::kCovMatSize; i++) {
+      cov[i][dst] = cov[i][src];
+    }
+    charged[dst] = charged[src];
+    dir[dst] = dir[src];
+    id[dst] = id[src];
+  }
+  // global coordinates of the lane track
+  void getXYZGlo(int lane, value_T& gx, value_T& gy, value_T& gz) const
+  {
+    gx = x[lane] * cosA[lane] - par[o2::track::kY][lane] * sinA[lane];
+    gy = x[lane] * sinA[lane] + par[o2::track::kY][lane] * cosA[lane];
+    gz = par[o2::track::kZ][lane];
+  }
+  // same as TrackParametrizationWithError::checkCovariance for the lane tracks selected by the mask among the first n
+  void checkCovariance(const bool* mask, int n)
+  {
+    using namespace o2::track;
+    constexpr int Diag[kNParams] = {kSigY2, kSigZ2, kSigSnp2, kSigTgl2, kSigQ2Pt2};
+    constexpr float DiagMax[kNParams] = {kCY2max, kCZ2max, kCSnp2max, kCTgl2max, kC1Pt2max};
+    constexpr int OffDiag[kNParams][kNParams - 1] = {{kSigZY, kSigSnpY, kSigTglY, kSigQ2PtY},
+                                                     {kSigZY, kSigSnpZ, kSigTglZ, kSigQ2PtZ},
+                                                     {kSigSnpY, kSigSnpZ, kSigTglSnp, kSigQ2PtSnp},
+                                                     {kSigTglY, kSigTglZ, kSigTglSnp, kSigQ2PtTgl},
+                                                     {kSigQ2PtY, kSigQ2PtZ, kSigQ2PtSnp, kSigQ2PtTgl}};
+    for (int ip = 0; ip < kNParams; ip++) {
+      auto* cd = cov[Diag[ip]];
+      bool exceeds = false;
+      for (int il = 0; il < n; il++) { // branchless, the diagonal elements exceeding the limit are rare
+        cd[il] = mask[il] ? gpu::CAMath::Abs(cd[il]) : cd[il];
+        exceeds |= mask[il] & (cd[il] > DiagMax[ip]);
+      }
+      if (!exceeds) {
+        continue;
+      }
+      for (int il = 0; il < n; il++) {
+        if (mask[il] && cd[il] > DiagMax[ip]) {
+          value_T scl = gpu::CAMath::Sqrt(DiagMax[ip] / cd[il]);
+          cd[il] = DiagMax[ip];
+          for (int io = 0; io < kNParams - 1; io++) {
+            cov[OffDiag[ip][io]][il] *= scl;
+          }
+        }
+      }
+    }
+  }
+};
+} // namespace
+
+//_______________________________________________________________________
+template <typename value_T>
+int PropagatorImpl<value_T>::propagateToX(gsl::span<TrackParCov_t> tracks, value_type xToGo, value_type bZ, value_type maxSnp, value_type maxStep,
+                                          PropagatorImpl<value_T>::MatCorrType matCorr, int signCorr, gsl::span<bool> status) const
+{
+  //----------------------------------------------------------------
+  //
+  // Propagates the tracks to the plane X=xToGo (cm) in the constant Bz field, correcting for the crossed material.
+  // The tracks are loaded to the lanes of a SoA block and the same step is done for all lanes: the helix transport of
+  // the parameters and covariance is done in the loops over the lanes and the material of all steps is obtained from
+  // a single batch query of the LUT. The lane of the finished track is refilled by the next one, so that the block stays full.
+  // The arithmetics is the same as in the single track propagateToX, hence the same results.
+  //
+  //----------------------------------------------------------------
+  using namespace o2::track;
+  constexpr int BlockSize = 32;
+  TrackParCovBlock<value_type, BlockSize> blk;
+  value_type xNew[BlockSize], gx0[BlockSize], gy0[BlockSize], gz0[BlockSize], dxs[BlockSize], crvs[BlockSize], x2rs[BlockSize];
+  value_type f1s[BlockSize], f2s[BlockSize], r1s[BlockSize], r2s[BlockSize], dzs[BlockSize];
+  double dy2dxs[BlockSize];
+  float rx0[BlockSize], ry0[BlockSize], rz0[BlockSize], rx1[BlockSize], ry1[BlockSize], rz1[BlockSize];
+  MatBudget mbs[BlockSize];
+  bool moved[BlockSize], done[BlockSize], res[BlockSize];
+  int arcLanes[BlockSize], matLanes[BlockSize];
+  MatLayerCylSet::MatBudgetCache matCache;
+  const bool useLUTBatch = matCorr == MatCorrType::USEMatCorrLUT && mMatLUT;
+  int nOK = 0;
+  size_t next = 0;
+
+  auto finishTrack = [&](size_t id, bool ok) {
+    if (status.size()) {
+      status[id] = ok;
+    }
+    nOK += ok;
+  };
+  // load to the lane the next track to propagate, the tracks which are already at xToGo are finished right away
+  auto loadNext = [&](int il) {
+    while (next < tracks.size()) {
+      auto& trc = tracks[next];
+      if (math_utils::detail::abs<value_type>(xToGo - trc.getX()) > Epsilon) {
+        blk.load(il, trc);
+        blk.id[il] = next++;
+        blk.dir[il] = xToGo - blk.x[il] > 0.f ? 1 : -1;
+        done[il] = false;
+        return true;
+      }
+      trc.setX(xToGo);
+      finishTrack(next++, true);
+    }
+    return false;
+  };
+  auto finishLane = [&](int il, bool ok) {
+    done[il] = true;
+    res[il] = ok;
+  };
+
+  int nLanes = 0;
+  while (nLanes < BlockSize && loadNext(nLanes)) {
+    nLanes++;
+  }
+  while (nLanes) {
+    // transport of the parameters to the new X, same as TrackParametrizationWithError::propagateTo(x, bZ). The lanes are not
+    // in sync, hence the lane-dependent conditions are evaluated w/o branches and the lanes needing the arc length are listed
+    int nArc = 0;
+    for (int il = 0; il < nLanes; il++) {
+      auto dx = xToGo - blk.x[il];
+      auto step = math_utils::detail::min<value_type>(math_utils::detail::abs<value_type>(dx), maxStep);
+      xNew[il] = blk.x[il] + (blk.dir[il] < 0 ? -step : step);
+      blk.getXYZGlo(il, gx0[il], gy0[il], gz0[il]);
+      value_type dxk = xNew[il] - blk.x[il];
+      value_type crv = blk.charged[il] ? blk.par[kQ2Pt][il] * bZ * o2::constants::math::B2C : 0.f;
+      value_type x2r = crv * dxk;
+      value_type f1 = blk.par[kSnp][il], f2 = f1 + x2r;
+      bool valid = !(gpu::CAMath::Abs(f1) > constants::math::Almost1) & !(gpu::CAMath::Abs(f2) > constants::math::Almost1);
+      value_type r1 = gpu::CAMath::Sqrt(valid ? (1.f - f1) * (1.f + f1) : 1.f); // invalid lanes must not raise FP exceptions
+      value_type r2 = gpu::CAMath::Sqrt(valid ? (1.f - f2) * (1.f + f2) : 1.f);
+      valid &= !(gpu::CAMath::Abs(r1) < constants::math::Almost0) & !(gpu::CAMath::Abs(r2) < constants::math::Almost0);
+      double dy2dx = (f1 + f2) / (valid ? r1 + r2 : 1.f);
+      dxs[il] = dxk;
+      crvs[il] = crv;
+      x2rs[il] = x2r;
+      f1s[il] = f1;
+      f2s[il] = f2;
+      r1s[il] = r1;
+      r2s[il] = r2;
+      dy2dxs[il] = dy2dx;
+      dzs[il] = dxk * (r2 + f2 * dy2dx) * blk.par[kTgl][il];
+      moved[il] = valid & !(gpu::CAMath::Abs(dxk) < constants::math::Almost0);
+      arcLanes[nArc] = il;
+      nArc += moved[il] & (gpu::CAMath::Abs(x2r) > 0.05f);
+    }
+    for (int ia = 0; ia < nArc; ia++) { // for large dx/R the Z is propagated along the arc
+      int il = arcLanes[ia];
+      value_type f1 = f1s[il], f2 = f2s[il];
+      auto arg = r1s[il] * f2 - r2s[il] * f1;
+      if (gpu::CAMath::Abs(arg) > constants::math::Almost1) {
+        moved[il] = false;
+        continue;
+      }
+      value_type rot = gpu::CAMath::ASin(arg);
+      if (f1 * f1 + f2 * f2 > 1.f && f1 * f2 < 0.f) {
+        if (f2 > 0.f) {
+          rot = constants::math::PI - rot;
+        } else {
+          rot = -constants::math::PI - rot;
+        }
+      }
+      dzs[il] = blk.par[kTgl][il] / crvs[il] * rot;
+    }
+    for (int il = 0; il < nLanes; il++) {
+      if (!moved[il]) {
+        if (!(gpu::CAMath::Abs(dxs[il]) < constants::math::Almost0)) {
+          finishLane(il, false);
+        }
+        continue;
+      }
+      value_type dx = dxs[il], f1 = f1s[il], r1 = r1s[il], tgl = blk.par[kTgl][il];
+      value_type dy = dx * dy2dxs[il];
+      blk.x[il] = xNew[il];
+      blk.par[kZ][il] += dzs[il];
+      blk.par[kY][il] += dy;
+      auto& snp = blk.par[kSnp][il];
+      snp += x2rs[il];
+      if (snp > constants::math::Almost1) {
+        snp = constants::math::Almost1;
+      } else if (snp < -constants::math::Almost1) {
+        snp = -constants::math::Almost1;
+      }
+      value_type &c00 = blk.cov[kSigY2][il], &c10 = blk.cov[kSigZY][il], &c11 = blk.cov[kSigZ2][il], &c20 = blk.cov[kSigSnpY][il], &c21 = blk.cov[kSigSnpZ][il],
+                 &c22 = blk.cov[kSigSnp2][il], &c30 = blk.cov[kSigTglY][il], &c31 = blk.cov[kSigTglZ][il], &c32 = blk.cov[kSigTglSnp][il], &c33 = blk.cov[kSigTgl2][il],
+                 &c40 = blk.cov[kSigQ2PtY][il], &c41 = blk.cov[kSigQ2PtZ][il], &c42 = blk.cov[kSigQ2PtSnp][il], &c43 = blk.cov[kSigQ2PtTgl][il],
+                 &c44 = blk.cov[kSigQ2Pt2][il];
+      double rinv = 1. / r1;
+      double r3inv = rinv * rinv * rinv;
+      double f24 = dx * bZ * constants::math::B2C;
+      double f02 = dx * r3inv;
+      double f04 = 0.5 * f24 * f02;
+      double f12 = f02 * tgl * f1;
+      double f14 = 0.5 * f24 * f12;
+      double f13 = dx * rinv;
+      double b00 = f02 * c20 + f04 * c40, b01 = f12 * c20 + f14 * c40 + f13 * c30;
+      double b02 = f24 * c40;
+      double b10 = f02 * c21 + f04 * c41, b11 = f12 * c21 + f14 * c41 + f13 * c31;
+      double b12 = f24 * c41;
+      double b20 = f02 * c22 + f04 * c42, b21 = f12 * c22 + f14 * c42 + f13 * c32;
+      double b22 = f24 * c42;
+      double b40 = f02 * c42 + f04 * c44, b41 = f12 * c42 + f14 * c44 + f13 * c43;
+      double b42 = f24 * c44;
+      double b30 = f02 * c32 + f04 * c43, b31 = f12 * c32 + f14 * c43 + f13 * c33;
+      double b32 = f24 * c43;
+      double a00 = f02 * b20 + f04 * b40, a01 = f02 * b21 + f04 * b41, a02 = f02 * b22 + f04 * b42;
+      double a11 = f12 * b21 + f14 * b41 + f13 * b31, a12 = f12 * b22 + f14 * b42 + f13 * b32;
+      double a22 = f24 * b42;
+      c00 += b00 + b00 + a00;
+      c10 += b10 + b01 + a01;
+      c20 += b20 + b02 + a02;
+      c30 += b30;
+      c40 += b40;
+      c11 += b11 + b11 + a11;
+      c21 += b21 + b12 + a12;
+      c31 += b31;
+      c41 += b41;
+      c22 += b22 + b22 + a22;
+      c32 += b32;
+      c42 += b42;
+    }
+    blk.checkCovariance(moved, nLanes);
+    // material of the steps, the correction itself is applied via the tracks
+    int nMat = 0;
+    for (int il = 0; matCorr != MatCorrType::USEMatCorrNONE && il < nLanes; il++) {
+      if (moved[il]) {
+        value_type gx1, gy1, gz1;
+        blk.getXYZGlo(il, gx1, gy1, gz1);
+        if (useLUTBatch) {
+          rx0[nMat] = gx0[il];
+          ry0[nMat] = gy0[il];
+          rz0[nMat] = gz0[il];
+          rx1[nMat] = gx1;
+          ry1[nMat] = gy1;
+          rz1[nMat] = gz1;
+        } else {
+          mbs[nMat] = this->getMatBudget(matCorr, math_utils::Point3D<value_type>(gx0[il], gy0[il], gz0[il]), math_utils::Point3D<value_type>(gx1, gy1, gz1));
+        }
+        matLanes[nMat++] = il;
+      }
+    }
+    if (useLUTBatch && nMat) {
+      mMatLUT->getMatBudget(rx0, ry0, rz0, rx1, ry1, rz1, mbs, nMat, &matCache);
+    }
+    for (int im = 0; im < nMat; im++) {
+      int il = matLanes[im];
+      auto& trc = tracks[blk.id[il]];
+      blk.store(il, trc);
+      int sgn = signCorr ? signCorr : -blk.dir[il];
+      bool corrOK = trc.correctForMaterial(mbs[im].meanX2X0, mbs[im].getXRho(sgn));
+      blk.loadMatCorr(il, trc);
+      if (maxSnp > 0 && math_utils::detail::abs<value_type>(blk.par[kSnp][il]) >= maxSnp) {
+        corrOK = false;
+      }
+      if (!corrOK) {
+        finishLane(il, false);
+      }
+    }
+    for (int il = 0; il < nLanes; il++) {
+      if (done[il]) {
+        continue;
+      }
+      if (matCorr == MatCorrType::USEMatCorrNONE && maxSnp > 0 && math_utils::detail::abs<value_type>(blk.par[kSnp][il]) >= maxSnp) {
+        finishLane(il, false);
+        continue;
+      }
+      if (math_utils::detail::abs<value_type>(xToGo - blk.x[il]) <= Epsilon) {
+        blk.x[il] = xToGo;
+        finishLane(il, true);
+      }
+    }
+    // finished lanes are refilled by the next tracks or, when there are no more tracks, replaced by the last lane
+    for (int il = 0; il < nLanes;) {
+      if (!done[il]) {
+        il++;
+        continue;
+      }
+      blk.store(il, tracks[blk.id[il]]);
+      finishTrack(blk.id[il], res[il]);
+      if (loadNext(il)) {
+        il++;
+      } else if (il < --nLanes) {
+        blk.copyLane(il, nLanes);
+        done[il] = done[nLanes];
+        res[il] = res[nLanes];
+      }
+    }
+  }
+  return nOK;
+}
+#endif // !GPUCA_ALIGPUCODE
+
 //____________________________________________________________
 template <typename value_T>
 GPUd() MatBudget PropagatorImpl<value_T>::getMatBudget(PropagatorImpl<value_type>::MatCorrType corrType, const math_utils::Point3D<value_type>& p0, const math_utils::Point3D<value_type>& p1) const
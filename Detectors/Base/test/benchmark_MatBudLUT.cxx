@@ -0,0 +1,110 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+#include "DetectorsBase/MatLayerCylSet.h"
+
+using namespace o2::base;
+
+// rays in SoA layout
+struct Rays {
+  std::vector<float> x0, y0, z0, x1, y1, z1;
+  void add(float xa, float ya, float za, float xb, float yb, float zb)
+  {
+    x0.push_back(xa);
+    y0.push_back(ya);
+    z0.push_back(za);
+    x1.push_back(xb);
+    y1.push_back(yb);
+    z1.push_back(zb);
+  }
+  int size() const { return x0.size(); }
+};
+
+// steps of helical tracks from the vertex to the TPC inner radius in the nominal field,
+// as done by the propagation with material corrections in the ITS-TPC matching and refits
+static Rays createRays(int nRays)
+{
+  constexpr float RMax = 85.f, MaxStep = 2.f, B = 0.5f;
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<float> phi(0., 2. * M_PI);
+  std::uniform_real_distribution<float> eta(-0.9, 0.9);
+  std::uniform_real_distribution<float> invPt(0.2, 5.);
+  std::normal_distribution<float> vtxZ(0., 5.);
+  Rays rays;
+  while (rays.size() < nRays) {
+    float phi0 = phi(generator), tgl = std::sinh(eta(generator)), z0 = vtxZ(generator);
+    float radius = 100.f / (0.3f * B * invPt(generator)) * (generator() % 2 ? 1.f : -1.f); // signed curvature radius in cm
+    float xp = 0.f, yp = 0.f, zp = z0;
+    for (float s = MaxStep; xp * xp + yp * yp < RMax * RMax && rays.size() < nRays; s += MaxStep) {
+      float phis = phi0 + s / radius;
+      float x = radius * (std::sin(phis) - std::sin(phi0)), y = -radius * (std::cos(phis) - std::cos(phi0)), z = z0 + s * tgl;
+      rays.add(xp, yp, zp, x, y, z);
+      xp = x;
+      yp = y;
+      zp = z;
+    }
+  }
+  return rays;
+}
+
+static const MatLayerCylSet* getLUT()
+{
+  // LUT file can be provided via O2_MATBUD_LUT env. variable, by default matbud.root from the current directory is used
+  static const MatLayerCylSet* lut = MatLayerCylSet::loadFromFile(std::getenv("O2_MATBUD_LUT") ? std::getenv("O2_MATBUD_LUT") : "matbud.root");
+  return lut;
+}
+
+static void BM_MatBudSingleRay(benchmark::State& state)
+{
+  auto lut = getLUT();
+  if (!lut) {
+    state.SkipWithError("material LUT is not available");
+    return;
+  }
+  auto rays = createRays(state.range(0));
+  std::vector<MatBudget> res(rays.size());
+  for (auto _ : state) {
+    for (int i = 0; i < rays.size(); i++) {
+      res[i] = lut->getMatBudget(rays.x0[i], rays.y0[i], rays.z0[i], rays.x1[i], rays.y1[i], rays.z1[i]);
+    }
+    benchmark::DoNotOptimize(res.data());
+  }
+  state.counters["rays"] = benchmark::Counter(state.iterations() * rays.size(), benchmark::Counter::kIsRate);
+}
+
+static void BM_MatBudBatch(benchmark::State& state)
+{
+  auto lut = getLUT();
+  if (!lut) {
+    state.SkipWithError("material LUT is not available");
+    return;
+  }
+  auto rays = createRays(state.range(0));
+  std::vector<MatBudget> res(rays.size());
+  MatLayerCylSet::MatBudgetCache cache;
+  for (auto _ : state) {
+    lut->getMatBudget(rays.x0.data(), rays.y0.data(), rays.z0.data(), rays.x1.data(), rays.y1.data(), rays.z1.data(), res.data(), rays.size(), &cache);
+    benchmark::DoNotOptimize(res.data());
+  }
+  state.counters["rays"] = benchmark::Counter(state.iterations() * rays.size(), benchmark::Counter::kIsRate);
+}
+
+// arguments: number of rays
+BENCHMARK(BM_MatBudSingleRay)->Arg(1000)->Arg(100000);
+BENCHMARK(BM_MatBudBatch)->Arg(1000)->Arg(100000);
+
+BENCHMARK_MAIN();
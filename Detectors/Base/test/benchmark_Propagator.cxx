@@ -0,0 +1,92 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "DetectorsBase/Propagator.h"
+#include "DetectorsBase/MatLayerCylSet.h"
+
+using namespace o2::base;
+using TrackParCov = o2::track::TrackParCov;
+
+constexpr float XTo = 85.f, Bz = -5.f;
+
+// tracks at the ITS outer layers to be propagated to the TPC inner radius, as in the ITS-TPC matching
+static std::vector<TrackParCov> createTracks(int nTracks)
+{
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<float> xStart(3., 45.);
+  std::uniform_real_distribution<float> alpha(-M_PI, M_PI);
+  std::uniform_real_distribution<float> snp(-0.3, 0.3);
+  std::uniform_real_distribution<float> eta(-0.9, 0.9);
+  std::uniform_real_distribution<float> invPt(0.2, 5.);
+  std::normal_distribution<float> yz(0., 1.);
+  std::vector<TrackParCov> tracks;
+  for (int i = 0; i < nTracks; i++) {
+    std::array<float, o2::track::kNParams> par{yz(generator), 10.f * yz(generator), snp(generator), std::sinh(eta(generator)), (generator() % 2 ? 1.f : -1.f) * invPt(generator)};
+    std::array<float, o2::track::kCovMatSize> cov{1e-4, 0., 1e-4, 0., 0., 1e-5, 0., 0., 0., 1e-5, 0., 0., 0., 0., 1e-3};
+    tracks.emplace_back(xStart(generator), alpha(generator), par, cov);
+  }
+  return tracks;
+}
+
+static Propagator::MatCorrType setMaterial(benchmark::State& state, Propagator* prop)
+{
+  if (!state.range(1)) {
+    return Propagator::MatCorrType::USEMatCorrNONE;
+  }
+  // LUT file can be provided via O2_MATBUD_LUT env. variable, by default matbud.root from the current directory is used
+  static const MatLayerCylSet* lut = MatLayerCylSet::loadFromFile(std::getenv("O2_MATBUD_LUT") ? std::getenv("O2_MATBUD_LUT") : "matbud.root");
+  if (!lut) {
+    state.SkipWithError("material LUT is not available");
+  }
+  prop->setMatLUT(lut);
+  return Propagator::MatCorrType::USEMatCorrLUT;
+}
+
+static void BM_PropagateSingle(benchmark::State& state)
+{
+  auto prop = Propagator::Instance(true);
+  auto matCorr = setMaterial(state, prop);
+  const auto tracksIni = createTracks(state.range(0));
+  std::vector<TrackParCov> tracks;
+  for (auto _ : state) {
+    tracks = tracksIni;
+    for (auto& trc : tracks) {
+      prop->propagateToX(trc, XTo, Bz, Propagator::MAX_SIN_PHI, Propagator::MAX_STEP, matCorr);
+    }
+    benchmark::DoNotOptimize(tracks.data());
+  }
+  state.counters["tracks"] = benchmark::Counter(state.iterations() * tracks.size(), benchmark::Counter::kIsRate);
+}
+
+static void BM_PropagateBatch(benchmark::State& state)
+{
+  auto prop = Propagator::Instance(true);
+  auto matCorr = setMaterial(state, prop);
+  const auto tracksIni = createTracks(state.range(0));
+  std::vector<TrackParCov> tracks;
+  for (auto _ : state) {
+    tracks = tracksIni;
+    prop->propagateToX(tracks, XTo, Bz, Propagator::MAX_SIN_PHI, Propagator::MAX_STEP, matCorr);
+    benchmark::DoNotOptimize(tracks.data());
+  }
+  state.counters["tracks"] = benchmark::Counter(state.iterations() * tracks.size(), benchmark::Counter::kIsRate);
+}
+
+// arguments: number of tracks, use of material LUT
+BENCHMARK(BM_PropagateSingle)->Args({1000, 0})->Args({100000, 0})->Args({100000, 1});
+BENCHMARK(BM_PropagateBatch)->Args({1000, 0})->Args({100000, 0})->Args({100000, 1});
+
+BENCHMARK_MAIN();
@@ -14,11 +14,119 @@
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 #include <unistd.h>
+#include <memory>
+#include <random>
+#include <vector>
 
 #include "buildMatBudLUT.C"
+#include "CommonConstants/MathConstants.h"
+#include "DetectorsBase/Propagator.h"
 
 namespace o2
 {
+#ifndef GPUCA_ALIGPUCODE // this part is unvisible on GPU version
+// compare batch material budget query with the single ray one
+bool testMBLUTBatch(const std::string& lutFile)
+{
+  auto* mbr = o2::base::MatLayerCylSet::loadFromFile(lutFile);
+  if (!mbr) {
+    return false;
+  }
+  const int n = 10000;
+  std::vector<float> x0(n), y0(n), z0(n), x1(n), y1(n), z1(n);
+  std::mt19937 gen(1234);
+  std::uniform_real_distribution<float> rnd(-1.f, 1.f);
+  for (int i = 0; i < n;) {
+    if (i % 10 == 0) { // random ray
+      x0[i] = 50.f * rnd(gen);
+      y0[i] = 50.f * rnd(gen);
+      z0[i] = 50.f * rnd(gen);
+      x1[i] = 50.f * rnd(gen);
+      y1[i] = 50.f * rnd(gen);
+      z1[i] = 50.f * rnd(gen);
+      i++;
+      continue;
+    }
+    // consecutive steps of the straight track from the vertex
+    float phi = o2::constants::math::PI * rnd(gen), tgl = rnd(gen), step = 1.5f + rnd(gen), r = 0.f;
+    for (int j = 0; j < 20 && i < n; j++, i++) {
+      x0[i] = r * std::cos(phi);
+      y0[i] = r * std::sin(phi);
+      z0[i] = r * tgl;
+      r += step;
+      x1[i] = r * std::cos(phi);
+      y1[i] = r * std::sin(phi);
+      z1[i] = r * tgl;
+    }
+  }
+  std::vector<o2::base::MatBudget> res(n);
+  o2::base::MatLayerCylSet::MatBudgetCache cache;
+  mbr->getMatBudget(x0.data(), y0.data(), z0.data(), x1.data(), y1.data(), z1.data(), res.data(), n, &cache);
+  int nDiff = 0;
+  for (int i = 0; i < n; i++) {
+    auto ref = mbr->getMatBudget(x0[i], y0[i], z0[i], x1[i], y1[i], z1[i]);
+    if (ref.meanRho != res[i].meanRho || ref.meanX2X0 != res[i].meanX2X0 || ref.length != res[i].length) {
+      nDiff++;
+    }
+  }
+  if (nDiff) {
+    LOG(error) << nDiff << " out of " << n << " rays differ between batch and single ray material budget queries";
+  }
+  return nDiff == 0;
+}
+
+// compare the batch propagation of tracks with material correction to the propagation of every track
+bool testPropagatorBatch(const std::string& lutFile)
+{
+  auto* mbr = o2::base::MatLayerCylSet::loadFromFile(lutFile);
+  if (!mbr) {
+    return false;
+  }
+  using Propagator = o2::base::Propagator;
+  auto prop = Propagator::Instance(true);
+  prop->setMatLUT(mbr);
+  const int n = 1000;
+  std::vector<o2::track::TrackParCov> tracksIni;
+  std::mt19937 gen(1234);
+  std::uniform_real_distribution<float> rnd(-1.f, 1.f);
+  for (int i = 0; i < n; i++) {
+    std::array<float, o2::track::kNParams> par{rnd(gen), 10.f * rnd(gen), 0.8f * rnd(gen), rnd(gen), 10.f * rnd(gen)};
+    std::array<float, o2::track::kCovMatSize> cov{1e-4, 0., 1e-4, 0., 0., 1e-5, 0., 0., 0., 1e-5, 0., 0., 0., 0., 1e-3};
+    auto& trc = tracksIni.emplace_back(45.f + 40.f * rnd(gen), o2::constants::math::PI * rnd(gen), par, cov);
+    if (i % 20 == 0) { // large covariance, to be limited by checkCovariance also after the material correction
+      trc.setCov(10.f, o2::track::kSigSnp2);
+    }
+  }
+  int nDiff = 0;
+  for (auto matCorr : {Propagator::MatCorrType::USEMatCorrLUT, Propagator::MatCorrType::USEMatCorrTGeo}) {
+    for (int signCorr : {0, 1}) {
+      auto tracks = tracksIni, tracksRef = tracksIni;
+      std::vector<bool> statusRef(n);
+      std::unique_ptr<bool[]> status(new bool[n]);
+      for (int i = 0; i < n; i++) {
+        statusRef[i] = prop->propagateToX(tracksRef[i], 3.f, -5.f, Propagator::MAX_SIN_PHI, Propagator::MAX_STEP, matCorr, nullptr, signCorr);
+      }
+      prop->propagateToX(tracks, 3.f, -5.f, Propagator::MAX_SIN_PHI, Propagator::MAX_STEP, matCorr, signCorr, gsl::span<bool>(status.get(), n));
+      for (int i = 0; i < n; i++) {
+        bool same = status[i] == statusRef[i] && tracks[i].getX() == tracksRef[i].getX();
+        for (int ip = 0; ip < o2::track::kNParams; ip++) {
+          same &= tracks[i].getParam(ip) == tracksRef[i].getParam(ip);
+        }
+        for (int ic = 0; ic < o2::track::kCovMatSize; ic++) {
+          same &= tracks[i].getCov()[ic] == tracksRef[i].getCov()[ic];
+        }
+        nDiff += !same;
+      }
+    }
+  }
+  prop->setMatLUT(nullptr);
+  if (nDiff) {
+    LOG(error) << nDiff << " tracks differ between batch and single track propagation with material";
+  }
+  return nDiff == 0;
+}
+#endif //!GPUCA_ALIGPUCODE
+
 BOOST_AUTO_TEST_CASE(MatBudLUT)
 {
 #ifndef GPUCA_ALIGPUCODE // this part is unvisible on GPU version
@@ -30,6 +138,8 @@ BOOST_AUTO_TEST_CASE(MatBudLUT)
   matBudFile += std::to_string(getpid()) + ".root";
   BOOST_CHECK(buildMatBudLUT(2, 20, matBudFile, geomPrefix + std::to_string(getpid()), "align-geom.mDetectors=none")); // generate LUT
   BOOST_CHECK(testMBLUT(matBudFile));                                                    // test LUT manipulations
+  BOOST_CHECK(testMBLUTBatch(matBudFile));                                               // test batch query
+  BOOST_CHECK(testPropagatorBatch(matBudFile));                                          // test batch propagation with material
 
 #endif //!GPUCA_ALIGPUCODE
 }
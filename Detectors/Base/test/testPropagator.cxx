@@ -0,0 +1,100 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file testPropagator.cxx
+/// \brief check that the batch propagateToX gives the same tracks as propagateToX of every track
+
+#define BOOST_TEST_MODULE Test Propagator
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+#include "DetectorsBase/Propagator.h"
+
+namespace o2
+{
+namespace base
+{
+
+/// tracks to be propagated to X=85: outward and inward, already at the destination, neutral, curling before reaching
+/// the destination and exceeding maxSnp on the way
+template <typename value_T>
+std::vector<track::TrackParametrizationWithError<value_T>> createTracks(int nTracks)
+{
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<value_T> xStart(3., 150.);
+  std::uniform_real_distribution<value_T> alpha(-M_PI, M_PI);
+  std::uniform_real_distribution<value_T> snp(-0.8, 0.8);
+  std::uniform_real_distribution<value_T> tgl(-1., 1.);
+  std::uniform_real_distribution<value_T> invPt(0.1, 20.);
+  std::normal_distribution<value_T> yz(0., 1.);
+  std::vector<track::TrackParametrizationWithError<value_T>> tracks;
+  for (int i = 0; i < nTracks; i++) {
+    std::array<value_T, track::kNParams> par{yz(generator), 10 * yz(generator), snp(generator), tgl(generator), (generator() % 2 ? 1 : -1) * invPt(generator)};
+    std::array<value_T, track::kCovMatSize> cov{1e-4, 0., 1e-4, 0., 0., 1e-5, 0., 0., 0., 1e-5, 0., 0., 0., 0., 1e-3};
+    auto& trc = tracks.emplace_back(i % 50 ? xStart(generator) : 85., alpha(generator), par, cov);
+    if (i % 30 == 0) {
+      trc.setAbsCharge(0);
+    }
+    if (i % 20 == 0) { // large covariance, to be limited by checkCovariance
+      trc.setCov(10., track::kSigSnp2);
+    }
+  }
+  return tracks;
+}
+
+template <typename value_T>
+void compareBatch(value_T maxSnp, value_T maxStep, typename PropagatorImpl<value_T>::MatCorrType matCorr, int signCorr)
+{
+  const value_T xTo = 85, bZ = -5;
+  auto prop = PropagatorImpl<value_T>::Instance(true);
+  const auto tracksIni = createTracks<value_T>(1000);
+  auto tracksRef = tracksIni, tracks = tracksIni;
+  std::vector<char> statusRef(tracks.size());
+  int nOKRef = 0;
+  for (size_t i = 0; i < tracksRef.size(); i++) {
+    statusRef[i] = prop->propagateToX(tracksRef[i], xTo, bZ, maxSnp, maxStep, matCorr, nullptr, signCorr);
+    nOKRef += statusRef[i];
+  }
+  // make sure that the tracks exercise both the success and the failure of the propagation
+  BOOST_REQUIRE_GT(nOKRef, 0);
+  BOOST_REQUIRE_LT(nOKRef, tracks.size());
+
+  std::unique_ptr<bool[]> status(new bool[tracks.size()]);
+  int nOK = prop->propagateToX(tracks, xTo, bZ, maxSnp, maxStep, matCorr, signCorr, gsl::span<bool>(status.get(), tracks.size()));
+  BOOST_CHECK_EQUAL(nOK, nOKRef);
+  for (size_t i = 0; i < tracks.size(); i++) {
+    BOOST_CHECK_EQUAL(status[i], bool(statusRef[i]));
+    BOOST_CHECK_EQUAL(tracks[i].getX(), tracksRef[i].getX());
+    for (int ip = 0; ip < track::kNParams; ip++) {
+      BOOST_CHECK_EQUAL(tracks[i].getParam(ip), tracksRef[i].getParam(ip));
+    }
+    for (int ic = 0; ic < track::kCovMatSize; ic++) {
+      BOOST_CHECK_EQUAL(tracks[i].getCov()[ic], tracksRef[i].getCov()[ic]);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Propagator_batch_noMaterial)
+{
+  for (auto maxSnp : {0.f, PropagatorF::MAX_SIN_PHI}) {
+    for (auto maxStep : {PropagatorF::MAX_STEP, 10.f}) {
+      compareBatch<float>(maxSnp, maxStep, PropagatorF::MatCorrType::USEMatCorrNONE, 0);
+      compareBatch<double>(maxSnp, maxStep, PropagatorD::MatCorrType::USEMatCorrNONE, 0);
+    }
+  }
+}
+
+} // namespace base
+} // namespace o2
@@ -0,0 +1,129 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file HistogramShards.h
+/// \brief Per-thread copies of a boost::histogram which are filled in parallel and merged on request
+
+#ifndef O2_CALIBRATION_HISTOGRAMSHARDS_H
+#define O2_CALIBRATION_HISTOGRAMSHARDS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+#include <gsl/span>
+
+namespace o2
+{
+namespace calibration
+{
+
+/// \brief Container of thread-local histogram shards.
+///
+/// The input span is split into one contiguous chunk per thread and every thread fills only its own
+/// shard, so no locking or atomic bin updates are needed. The shards keep their entries over many fill calls
+/// and are added to the target histogram with mergeTo() only when the full content is needed, e.g. when the
+/// time slot is finalized, as merging adds all bins of every shard independent of how many were filled.
+/// The assignment of chunks to shards only depends on the number of threads, so the merged result is
+/// reproducible for a given configuration.
+///
+/// The histogram type must provide copy construction, reset() and operator+= (as boost::histogram does).
+/// The parallel loop uses OpenMP and is only active if the including target is compiled with
+/// OpenMP and defines WITH_OPENMP, otherwise all input is filled into a single shard.
+template <typename Hist>
+class HistogramShards
+{
+ public:
+  HistogramShards() = default;
+  explicit HistogramShards(int nThreads) { setNThreads(nThreads); }
+
+  /// \param nThreads number of threads (and shards) used for filling
+  void setNThreads(int nThreads)
+  {
+    mNThreads = std::max(1, nThreads);
+    mShards.clear();
+    mHasData = false;
+  }
+  int getNThreads() const { return mNThreads; }
+
+  /// \return true if the shards contain entries which were not merged yet
+  bool hasData() const { return mHasData; }
+
+  /// \brief Fill the shards from the input data
+  /// \param prototype histogram used to define the binning of the shards when they are created
+  /// \param input data to be filled
+  /// \param fillFunc callable with signature fillFunc(Hist&, const T&), must only modify the histogram passed
+  template <typename T, typename FillFunc>
+  void fill(const Hist& prototype, gsl::span<const T> input, FillFunc&& fillFunc)
+  {
+    if (input.empty()) {
+      return;
+    }
+    initShards(prototype);
+    const size_t nInput = input.size();
+    const int nThreads = static_cast<int>(std::min<size_t>(mNThreads, nInput));
+
+#ifdef WITH_OPENMP
+#pragma omp parallel for num_threads(nThreads) schedule(static, 1)
+#endif
+    for (int ithread = 0; ithread < nThreads; ++ithread) {
+      const size_t first = nInput * ithread / nThreads;
+      const size_t last = nInput * (ithread + 1) / nThreads;
+      auto& shard = mShards[ithread];
+      for (size_t i = first; i < last; ++i) {
+        fillFunc(shard, input[i]);
+      }
+    }
+    mHasData = true;
+  }
+
+  /// add the content of all shards to the target histogram and reset the shards
+  void mergeTo(Hist& target)
+  {
+    if (!mHasData) {
+      return;
+    }
+    for (auto& shard : mShards) {
+      target += shard;
+      shard.reset();
+    }
+    mHasData = false;
+  }
+
+  /// drop all entries of the shards without merging them
+  void reset()
+  {
+    for (auto& shard : mShards) {
+      shard.reset();
+    }
+    mHasData = false;
+  }
+
+ private:
+  int mNThreads{1};          ///< number of threads used for filling
+  bool mHasData{false};      ///< shards contain entries which are not yet merged
+  std::vector<Hist> mShards; ///< one histogram per thread
+
+  void initShards(const Hist& prototype)
+  {
+    if (mShards.size() == static_cast<size_t>(mNThreads)) {
+      return;
+    }
+    mShards.assign(mNThreads, prototype);
+    for (auto& shard : mShards) {
+      shard.reset();
+    }
+  }
+};
+
+} // namespace calibration
+} // namespace o2
+
+#endif
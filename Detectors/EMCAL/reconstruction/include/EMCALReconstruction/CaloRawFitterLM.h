@@ -0,0 +1,76 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#ifndef EMCALRAWFITTERLM_H_
+#define EMCALRAWFITTERLM_H_
+
+#include <iosfwd>
+#include <array>
+#include <optional>
+#include <Rtypes.h>
+#include "EMCALReconstruction/CaloFitResults.h"
+#include "DataFormatsEMCAL/Constants.h"
+#include "EMCALReconstruction/Bunch.h"
+#include "EMCALReconstruction/CaloRawFitter.h"
+
+namespace o2
+{
+
+namespace emcal
+{
+
+/// \class CaloRawFitterLM
+/// \brief  Raw data fitting: Levenberg-Marquardt fit of the standard response function
+/// \ingroup EMCALreconstruction
+///
+/// Extraction of amplitude and peak position from CALO raw data
+/// fitting the same response function and using the same parameter
+/// limits as CaloRawFitterStandard. Instead of a TMinuit fit
+/// the chi2 is minimized with Levenberg-Marquardt iterations on the
+/// samples of the bunch, without any allocation per channel.
+class CaloRawFitterLM final : public CaloRawFitter
+{
+
+ public:
+  /// \brief Constructor
+  CaloRawFitterLM();
+
+  /// \brief Destructor
+  ~CaloRawFitterLM() final = default;
+
+  void setNiterationsMax(int n) { mNiterationsMax = n; }
+  int getNiterationsMax() const { return mNiterationsMax; }
+
+  /// \brief Evaluation Amplitude and TOF
+  /// \param bunchvector Calo bunches for the tower and event
+  /// \return Container with the fit results (amp, time, chi2, ...)
+  /// \throw RawFitterError_t in case the fit failed (including all possible errors from upstream)
+  CaloFitResults evaluate(const gsl::span<const Bunch> bunchvector) final;
+
+  /// \brief Fits the raw signal time distribution
+  /// \param firstTimeBin First timebin of the ALTRO bunch
+  /// \param lastTimeBin Last timebin of the ALTRO bunch
+  /// \param ampEstimate Initial guess of the amplitude
+  /// \param timeEstimate Initial guess of the peak position
+  /// \return the fit parameters: amplitude, time, chi2
+  /// \throw RawFitter_t::FIT_ERROR in case the fit failed (insufficient number of samples or no convergence)
+  std::tuple<float, float, float> fitRaw(int firstTimeBin, int lastTimeBin, float ampEstimate, float timeEstimate) const;
+
+ private:
+  int mNiterationsMax = 30; ///< max number of iterations
+
+  ClassDefNV(CaloRawFitterLM, 1);
+}; // End of CaloRawFitterLM
+
+} // namespace emcal
+
+} // namespace o2
+#endif
@@ -15,6 +15,7 @@
 #define ALICEO2_EMCAL_CLUSTERIZER_H
 
 #include <array>
+#include <vector>
 #include <gsl/span>
 #include "Rtypes.h"
 #include "DataFormatsEMCAL/Cluster.h"
@@ -31,6 +32,8 @@ namespace emcal
 // Define numbers rows/columns for topological representation of cells
 constexpr unsigned int NROWS = (24 + 1) * (6 + 4); // 10x supermodule rows (6 for EMCAL, 4 for DCAL). +1 accounts for topological gap between two supermodules
 constexpr unsigned int NCOLS = 48 * 2 + 1;         // 2x  supermodule columns + 1 empty space in between for DCAL (not used for EMCAL)
+constexpr unsigned int NROWSSM = 24 + 1;           // rows of a pair of supermodules (A- and C-side) including the topological gap
+constexpr unsigned int NSMROWS = NROWS / NROWSSM;  // number of supermodule pairs in phi, clusters never extend over two of them
 
 using ClusterIndex = int;
 
@@ -81,6 +84,38 @@ class Clusterizer
     ClusterIndex mIndex;     ///< index of the cluster
   };
 
+  /// \struct NeighbourSearchStep
+  /// \brief Position in the neighbour search of a cell/digit
+  struct NeighbourSearchStep {
+    int row;       ///< Row number
+    int column;    ///< Column number
+    int direction; ///< Next neighbour direction to be checked
+  };
+
+  /// \struct ProtoCluster
+  /// \brief Cluster found in a supermodule row, before merging in seed order
+  struct ProtoCluster {
+    int seed;                ///< Position of the seed in the seed list
+    float time;              ///< Time of the seed cell/digit
+    ClusterIndex indexStart; ///< First cell/digit index in the workspace
+    ClusterIndex indexSize;  ///< Number of cells/digits
+  };
+
+  /// \struct Workspace
+  /// \brief Buffers used in the cluster search of one supermodule row
+  struct Workspace {
+    std::vector<InputwithIndex> clusterInputs; ///< Cells/digits of the current cluster
+    std::vector<NeighbourSearchStep> steps;    ///< Stack of the neighbour search
+    std::vector<ProtoCluster> clusters;        ///< Found clusters
+    std::vector<ClusterIndex> inputIndices;    ///< Cell/digit indices of the found clusters
+
+    void clear()
+    {
+      clusters.clear();
+      inputIndices.clear();
+    }
+  };
+
  public:
   /// \brief Main constructor
   /// \param timeCut Max. time difference of cells in cluster in ns
@@ -138,12 +173,39 @@ class Clusterizer
   /// \return EMCAL geometry
   Geometry* getGeometry() { return mEMCALGeometry; }
 
+  /// \brief Set number of threads used to search clusters in different supermodules
+  /// \param nThreads Number of threads (only used if compiled with OpenMP)
+  void setNThreads(int nThreads) { mNThreads = nThreads > 0 ? nThreads : 1; }
+
+  /// \brief Get number of threads used to search clusters in different supermodules
+  /// \return Number of threads
+  int getNThreads() const { return mNThreads; }
+
+  /// \brief Get number of threads which searched the clusters in the last call of findClusters
+  ///
+  /// Smaller than the requested number of threads when the search is called from inside
+  /// another parallel region, where nested parallelism is disabled by default.
+  /// \return Number of threads
+  int getNThreadsUsed() const { return mNThreadsUsed; }
+
  private:
-  /// \brief Recursively search for neighbours (EMCAL)
+  /// \brief Search for neighbours (EMCAL)
+  ///
+  /// Iterative version of the recursive neighbour search, the cells/digits are
+  /// added in the same order as in the recursion (seed first, each neighbour
+  /// after its own neighbours).
+  ///
   /// \param[in,out] clusterInputs Cells/digits of prototype cluster
-  /// \param row Row number from neighbor search in recursion step
-  /// \param column Column number for neighbor search in recursion step
-  void getClusterFromNeighbours(std::vector<InputwithIndex>& clusterInputs, int row, int column);
+  /// \param[in,out] steps Buffer for the stack of the neighbour search
+  /// \param row Row number of the seed
+  /// \param column Column number of the seed
+  void getClusterFromNeighbours(std::vector<InputwithIndex>& clusterInputs, std::vector<NeighbourSearchStep>& steps, int row, int column);
+
+  /// \brief Form clusters from the seeds in the seed list
+  /// \param nSeeds Number of entries in the seed list
+  /// \param smRow Supermodule row to which the seeds are restricted, -1 for all
+  /// \param workspace Buffers for the found clusters
+  void findClustersFromSeeds(int nSeeds, int smRow, Workspace& workspace);
 
   /// \brief Get row (phi) and column (eta) of a cell/digit, values corresponding to topology
   /// \param input Input object (cell/digit)
@@ -155,6 +217,7 @@ class Clusterizer
   std::array<cellWithE, NROWS * NCOLS> mSeedList;                 //!<! seed array
   std::array<std::array<InputwithIndex, NCOLS>, NROWS> mInputMap; //!<! topology arrays
   std::array<std::array<bool, NCOLS>, NROWS> mCellMask;           //!<! topology arrays
+  std::array<Workspace, NSMROWS> mWorkspaces;                     //!<! buffers of the cluster search per supermodule row
 
   std::vector<Cluster> mFoundClusters;     ///<  vector of cluster objects
   std::vector<ClusterIndex> mInputIndices; ///<  vector of associated cell/digit tower ID, ordered by cluster
@@ -166,7 +229,9 @@ class Clusterizer
   bool mDoEnergyGradientCut;   ///<  cut on energy gradient
   double mThresholdSeedEnergy; ///<  minimum energy to seed a EC digit/cell in a cluster
   double mThresholdCellEnergy; ///<  minimum energy for a digit/cell to be a member of a cluster
-  ClassDefNV(Clusterizer, 1);
+  int mNThreads = 1;           ///<  number of threads used in the cluster search
+  int mNThreadsUsed = 1;       //!<! number of threads which searched the clusters in the last event
+  ClassDefNV(Clusterizer, 2);
 };
 
 using ClusterizerDigits = Clusterizer<Digit>;
@@ -0,0 +1,101 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file CaloRawFitterLM.cxx
+
+#include <random>
+
+// ROOT sytem
+#include "TMath.h"
+
+#include "MathUtils/fit.h"
+#include "EMCALReconstruction/Bunch.h"
+#include "EMCALReconstruction/CaloFitResults.h"
+#include "DataFormatsEMCAL/Constants.h"
+
+#include "EMCALReconstruction/CaloRawFitterLM.h"
+
+using namespace o2::emcal;
+
+CaloRawFitterLM::CaloRawFitterLM() : CaloRawFitter("Chi Square ( Levenberg-Marquardt )", "LM")
+{
+  mAlgo = FitAlgorithm::LevenbergMarquardt;
+}
+
+CaloFitResults CaloRawFitterLM::evaluate(const gsl::span<const Bunch> bunchlist)
+{
+  float time = 0;
+  float amp = 0;
+  float chi2 = 0;
+  int ndf = 0;
+  bool fitDone = false;
+
+  auto [nsamples, bunchIndex, ampEstimate,
+        maxADC, timeEstimate, pedEstimate, first, last] = preFitEvaluateSamples(bunchlist, mAmpCut);
+
+  if (bunchIndex >= 0 && ampEstimate >= mAmpCut) {
+    time = timeEstimate;
+    int timebinOffset = bunchlist[bunchIndex].getStartTime() - (bunchlist[bunchIndex].getBunchLength() - 1);
+    amp = ampEstimate;
+
+    if (nsamples > 1 && maxADC < constants::OVERFLOWCUT) {
+      try {
+        std::tie(amp, time, chi2) = fitRaw(first, last, ampEstimate, timeEstimate);
+        time += timebinOffset;
+        timeEstimate += timebinOffset;
+        ndf = nsamples - 2;
+        fitDone = true;
+      } catch (RawFitterError_t& error) {
+      }
+    }
+  }
+  if (fitDone) {
+    float ampAsymm = (amp - ampEstimate) / (amp + ampEstimate);
+    float timeDiff = time - timeEstimate;
+
+    if ((TMath::Abs(ampAsymm) > 0.1) || (TMath::Abs(timeDiff) > 2)) {
+      amp = ampEstimate;
+      time = timeEstimate;
+      fitDone = false;
+    }
+  }
+  if (amp >= mAmpCut) {
+    if (!fitDone) {
+      std::default_random_engine generator;
+      std::uniform_real_distribution<float> distribution(0.0, 1.0);
+      amp += (0.5 - distribution(generator));
+    }
+    time = time * constants::EMCAL_TIMESAMPLE;
+    time -= mL1Phase;
+
+    return CaloFitResults(maxADC, pedEstimate, 0, amp, time, (int)time, chi2, ndf);
+  }
+  throw RawFitterError_t::FIT_ERROR;
+}
+
+std::tuple<float, float, float> CaloRawFitterLM::fitRaw(int firstTimeBin, int lastTimeBin, float ampEstimate, float timeEstimate) const
+{
+  int nsamples = lastTimeBin - firstTimeBin + 1;
+  if (nsamples < 3) {
+    throw RawFitterError_t::FIT_ERROR;
+  }
+
+  // same parameter limits as in the TMinuit fit of CaloRawFitterStandard, time relative to the first time bin
+  float peak = timeEstimate - firstTimeBin;
+  std::array<double, 2> param{ampEstimate, peak};
+  std::array<double, 4> limits{0.5 * ampEstimate, 2. * ampEstimate, peak - 4., peak + 4.};
+  double chi2 = o2::math_utils::fitGammaPulse(nsamples, mReversed.data() + firstTimeBin, constants::ORDER, constants::TAU, param, limits, mNiterationsMax);
+  if (chi2 < 0) {
+    throw RawFitterError_t::FIT_ERROR;
+  }
+
+  return std::make_tuple(param[0], param[1] + firstTimeBin, chi2);
+}
@@ -13,6 +13,9 @@
 /// \brief Implementation of the EMCAL clusterizer
 #include <cstring>
 #include <gsl/span>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
 #include <fairlogger/Logger.h> // for LOG
 #include "EMCALReconstruction/Clusterizer.h"
 
@@ -45,36 +48,46 @@ void Clusterizer<InputType>::initialize(double timeCut, double timeMin, double t
 
 //____________________________________________________________________________
 template <class InputType>
-void Clusterizer<InputType>::getClusterFromNeighbours(std::vector<InputwithIndex>& clusterInputs, int row, int column)
+void Clusterizer<InputType>::getClusterFromNeighbours(std::vector<InputwithIndex>& clusterInputs, std::vector<NeighbourSearchStep>& steps, int row, int column)
 {
-  // Recursion 0, add seed cell/digit to cluster
-  if (!clusterInputs.size()) {
-    clusterInputs.emplace_back(mInputMap[row][column]);
-  }
-
-  // Mark the current cell as clustered
+  // Add seed cell/digit to cluster and mark it as clustered
+  clusterInputs.emplace_back(mInputMap[row][column]);
   mCellMask[row][column] = kTRUE;
 
-  // Now go recursively to the next 4 neighbours and add them to the cluster if they fulfill the conditions
+  // Go to the next 4 neighbours and add them to the cluster if they fulfill the conditions.
+  // The neighbours are searched depth first using an explicit stack instead of recursion.
   constexpr int rowDiffs[4] = {-1, 0, 0, 1};
   constexpr int colDiffs[4] = {0, -1, 1, 0};
-  for (int dir = 0; dir < 4; dir++) {
-    if ((row + rowDiffs[dir] < 0) || (row + rowDiffs[dir] >= NROWS)) {
+  steps.clear();
+  steps.push_back({row, column, 0});
+  while (!steps.empty()) {
+    auto current = steps.back();
+    if (current.direction == 4) {
+      // All neighbours done, add the cell/digit to the current cluster -- if we end up here, the selected cluster fulfills the condition
+      steps.pop_back();
+      if (!steps.empty()) {
+        clusterInputs.emplace_back(mInputMap[current.row][current.column]);
+      }
+      continue;
+    }
+    int dir = steps.back().direction++;
+    int nextRow = current.row + rowDiffs[dir], nextColumn = current.column + colDiffs[dir];
+    if ((nextRow < 0) || (nextRow >= NROWS)) {
       continue;
     }
-    if ((column + colDiffs[dir] < 0) || (column + colDiffs[dir] >= NCOLS)) {
+    if ((nextColumn < 0) || (nextColumn >= NCOLS)) {
       continue;
     }
 
-    if (mInputMap[row + rowDiffs[dir]][column + colDiffs[dir]].mInput) {
-      if (!mCellMask[row + rowDiffs[dir]][column + colDiffs[dir]]) {
-        if (mDoEnergyGradientCut && (mInputMap[row + rowDiffs[dir]][column + colDiffs[dir]].mInput->getEnergy() > mInputMap[row][column].mInput->getEnergy() + mGradientCut)) {
+    if (mInputMap[nextRow][nextColumn].mInput) {
+      if (!mCellMask[nextRow][nextColumn]) {
+        if (mDoEnergyGradientCut && (mInputMap[nextRow][nextColumn].mInput->getEnergy() > mInputMap[current.row][current.column].mInput->getEnergy() + mGradientCut)) {
           continue;
         }
-        if (not(TMath::Abs(mInputMap[row + rowDiffs[dir]][column + colDiffs[dir]].mInput->getTimeStamp() - mInputMap[row][column].mInput->getTimeStamp()) > mTimeCut)) {
-          getClusterFromNeighbours(clusterInputs, row + rowDiffs[dir], column + colDiffs[dir]);
-          // Add the cell/digit to the current cluster -- if we end up here, the selected cluster fulfills the condition
-          clusterInputs.emplace_back(mInputMap[row + rowDiffs[dir]][column + colDiffs[dir]]);
+        if (not(TMath::Abs(mInputMap[nextRow][nextColumn].mInput->getTimeStamp() - mInputMap[current.row][current.column].mInput->getTimeStamp()) > mTimeCut)) {
+          // Mark the cell as clustered and continue with its neighbours
+          mCellMask[nextRow][nextColumn] = kTRUE;
+          steps.push_back({nextRow, nextColumn, 0});
         }
       }
     }
@@ -124,7 +137,7 @@ void Clusterizer<InputType>::findClusters(const gsl::span<InputType const>& inpu
   // - Loop over arrays:
   // --> Check 2D bitmap (don't use cell/digit which are already clustered)
   // --> Take valid cell/digit with highest energy as seed (they are already sorted)
-  // --> Recursive to neighboughs and create cluster
+  // --> Search neighbours and create cluster
   // --> Seed cell and all neighbours belonging to cluster will be put in 2D bitmap
 
   // Reset cell/digit maps and cell masks
@@ -168,9 +181,69 @@ void Clusterizer<InputType>::findClusters(const gsl::span<InputType const>& inpu
   // Sort struct arrays with ascending energy
   std::sort(mSeedList.begin(), std::next(std::begin(mSeedList), nCells));
 
+  // Form clusters. Clusters cannot extend over the gap between two supermodule rows,
+  // so the rows can be processed in parallel. Each row only accesses its own part
+  // of the topology arrays. The clusters of all rows are merged in seed order,
+  // which gives the same result as the sequential processing.
+  mNThreadsUsed = 1;
+  if (mNThreads > 1) {
+#ifdef WITH_OPENMP
+#pragma omp parallel num_threads(mNThreads)
+#endif
+    {
+#ifdef WITH_OPENMP
+#pragma omp single nowait
+      mNThreadsUsed = omp_get_num_threads();
+#pragma omp for schedule(dynamic)
+#endif
+      for (int smRow = 0; smRow < NSMROWS; smRow++) {
+        findClustersFromSeeds(nCells, smRow, mWorkspaces[smRow]);
+      }
+    }
+  } else {
+    findClustersFromSeeds(nCells, -1, mWorkspaces[0]);
+  }
+
+  // Merge found clusters in descending seed energy
+  std::array<size_t, NSMROWS> nextCluster{};
+  int nRows = mNThreads > 1 ? NSMROWS : 1;
+  while (true) {
+    int selectedRow = -1;
+    for (int smRow = 0; smRow < nRows; smRow++) {
+      auto& clusters = mWorkspaces[smRow].clusters;
+      if (nextCluster[smRow] < clusters.size() && (selectedRow < 0 || clusters[nextCluster[smRow]].seed > mWorkspaces[selectedRow].clusters[nextCluster[selectedRow]].seed)) {
+        selectedRow = smRow;
+      }
+    }
+    if (selectedRow < 0) {
+      break;
+    }
+    auto& workspace = mWorkspaces[selectedRow];
+    auto& protoCluster = workspace.clusters[nextCluster[selectedRow]++];
+
+    // Add cells/digits for current cluster to cell/digit index vector
+    int inputIndexStart = mInputIndices.size();
+    mInputIndices.insert(mInputIndices.end(), workspace.inputIndices.begin() + protoCluster.indexStart, workspace.inputIndices.begin() + protoCluster.indexStart + protoCluster.indexSize);
+
+    // Now form cluster object from cells/digits
+    mFoundClusters.emplace_back(protoCluster.time, inputIndexStart, protoCluster.indexSize); // Cluster object initialized w/ time of seed cell, start + size of associated cells
+  }
+  LOG(debug) << mFoundClusters.size() << "clusters found from " << nCells << " cells/digits (total=" << inputArray.size() << ")-> ehs " << ehs << " (minE " << mThresholdCellEnergy << ")";
+}
+
+//____________________________________________________________________________
+template <class InputType>
+void Clusterizer<InputType>::findClustersFromSeeds(int nSeeds, int smRow, Workspace& workspace)
+{
+  workspace.clear();
+
   // Take next valid cell/digit in calorimeter as seed (in descending energy order)
-  for (int i = nCells - 1; i >= 0; i--) {
+  for (int i = nSeeds - 1; i >= 0; i--) {
     int row = mSeedList[i].row, column = mSeedList[i].column;
+    // Continue if the cell is in a different supermodule row
+    if (smRow >= 0 && row / NROWSSM != smRow) {
+      continue;
+    }
     // Continue if the cell is already masked (i.e. was already clustered)
     if (mCellMask[row][column]) {
       continue;
@@ -180,21 +253,18 @@ void Clusterizer<InputType>::findClusters(const gsl::span<InputType const>& inpu
       continue;
     }
 
-    // Seed is found, form cluster recursively
-    std::vector<InputwithIndex> clusterInputs;
-    getClusterFromNeighbours(clusterInputs, row, column);
+    // Seed is found, form cluster from its neighbours
+    workspace.clusterInputs.clear();
+    getClusterFromNeighbours(workspace.clusterInputs, workspace.steps, row, column);
 
     // Add cells/digits for current cluster to cell/digit index vector
-    int inputIndexStart = mInputIndices.size();
-    for (auto dig : clusterInputs) {
-      mInputIndices.emplace_back(dig.mIndex);
+    int inputIndexStart = workspace.inputIndices.size();
+    for (auto dig : workspace.clusterInputs) {
+      workspace.inputIndices.emplace_back(dig.mIndex);
     }
-    int inputIndexSize = mInputIndices.size() - inputIndexStart;
-
-    // Now form cluster object from cells/digits
-    mFoundClusters.emplace_back(mInputMap[row][column].mInput->getTimeStamp(), inputIndexStart, inputIndexSize); // Cluster object initialized w/ time of seed cell, start + size of associated cells
+    int inputIndexSize = workspace.inputIndices.size() - inputIndexStart;
+    workspace.clusters.push_back({i, mInputMap[row][column].mInput->getTimeStamp(), inputIndexStart, inputIndexSize});
   }
-  LOG(debug) << mFoundClusters.size() << "clusters found from " << nCells << " cells/digits (total=" << inputArray.size() << ")-> ehs " << ehs << " (minE " << mThresholdCellEnergy << ")";
 }
 
 template class o2::emcal::Clusterizer<o2::emcal::Cell>;
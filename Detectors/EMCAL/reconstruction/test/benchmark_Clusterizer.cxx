@@ -0,0 +1,58 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+#include "DataFormatsEMCAL/Cell.h"
+#include "EMCALBase/Geometry.h"
+#include "EMCALReconstruction/Clusterizer.h"
+
+using namespace o2::emcal;
+
+// Cells in random towers with exponential energy spectrum, each tower at most once
+static std::vector<Cell> createCells(Geometry* geometry, int nCells)
+{
+  std::mt19937 generator(1);
+  std::uniform_int_distribution<int> towerdist(0, geometry->GetNCells() - 1);
+  std::exponential_distribution<float> energydist(3.);
+  std::normal_distribution<float> timedist(600., 10.);
+  std::vector<bool> used(geometry->GetNCells(), false);
+  std::vector<Cell> cells;
+  while (static_cast<int>(cells.size()) < nCells) {
+    auto tower = towerdist(generator);
+    if (used[tower]) {
+      continue;
+    }
+    used[tower] = true;
+    cells.emplace_back(tower, energydist(generator), timedist(generator));
+  }
+  return cells;
+}
+
+// Arguments: number of cells, number of threads
+static void BM_Clusterizer(benchmark::State& state)
+{
+  auto geometry = Geometry::GetInstanceFromRunNumber(300000);
+  auto cells = createCells(geometry, state.range(0));
+  Clusterizer<Cell> clusterizer(10000, 0, 10000, 0.03, true, 0.1, 0.05);
+  clusterizer.setGeometry(geometry);
+  clusterizer.setNThreads(state.range(1));
+  for (auto _ : state) {
+    clusterizer.findClusters(cells);
+    benchmark::DoNotOptimize(clusterizer.getFoundClusters()->size());
+  }
+  state.counters["cells/s"] = benchmark::Counter(state.iterations() * cells.size(), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_Clusterizer)->ArgsProduct({{100, 1000, 5000}, {1, 2, 4, 8}})->UseRealTime();
+
+BENCHMARK_MAIN();
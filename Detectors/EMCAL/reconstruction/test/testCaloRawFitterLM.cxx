@@ -0,0 +1,101 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#define BOOST_TEST_MODULE Test EMCAL Reconstruction
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <initializer_list>
+#include <random>
+#include <vector>
+#include <EMCALReconstruction/Bunch.h>
+#include <EMCALReconstruction/CaloRawFitterLM.h>
+#include <EMCALReconstruction/CaloRawFitterStandard.h>
+
+namespace o2
+{
+namespace emcal
+{
+
+/// Create a bunch with the response function of the electronics
+/// \param amp Amplitude of the pulse
+/// \param peak Peak position in time bins, relative to the first sample of the bunch
+/// \param noise Gaussian noise added to each sample
+Bunch createPulse(double amp, double peak, double noise, std::mt19937& generator)
+{
+  const int bunchlength = 10, starttime = 20;
+  std::normal_distribution<double> noisedist(0., noise);
+  std::vector<uint16_t> samples(bunchlength);
+  for (int i = 0; i < bunchlength; i++) {
+    double x = i, par[5] = {amp, peak, constants::TAU, constants::ORDER, 0.};
+    double adc = CaloRawFitterStandard::rawResponseFunction(&x, par) + (noise > 0 ? noisedist(generator) : 0.);
+    samples[i] = static_cast<uint16_t>(std::max(std::lround(adc), 0l));
+  }
+  // ADC values are stored in reversed time order
+  Bunch bunch(bunchlength, starttime);
+  for (int i = bunchlength - 1; i >= 0; i--) {
+    bunch.addADC(samples[i]);
+  }
+  return bunch;
+}
+
+BOOST_AUTO_TEST_CASE(CaloRawFitterLM_pulse_test)
+{
+  std::mt19937 generator(1);
+  CaloRawFitterLM fitter;
+  fitter.setIsZeroSuppressed(true);
+  fitter.setAmpCut(3.);
+  fitter.setL1Phase(0.);
+  BOOST_CHECK_EQUAL(fitter.getAlgo(), FitAlgorithm::LevenbergMarquardt);
+  for (auto amp : {50., 100., 500., 900.}) {
+    for (auto peak : {3.5, 4., 4.3, 4.8}) {
+      std::vector<Bunch> bunches{createPulse(amp, peak, 0., generator)};
+      auto result = fitter.evaluate(bunches);
+      // time of the first sample of the bunch: starttime - (bunchlength - 1)
+      double timeExpected = (peak + 11) * constants::EMCAL_TIMESAMPLE;
+      BOOST_CHECK_CLOSE(result.getAmp(), amp, 1.);
+      BOOST_CHECK_SMALL(result.getTime() - timeExpected, 0.1 * constants::EMCAL_TIMESAMPLE);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(CaloRawFitterLM_compare_standard_test)
+{
+  // compare with the TMinuit fit of the same response function
+  std::mt19937 generator(2);
+  std::uniform_real_distribution<double> ampdist(50., 900.), peakdist(3.5, 5.);
+  CaloRawFitterLM fitterLM;
+  CaloRawFitterStandard fitterStandard;
+  for (auto fitter : std::initializer_list<CaloRawFitter*>{&fitterLM, &fitterStandard}) {
+    fitter->setIsZeroSuppressed(true);
+    fitter->setAmpCut(3.);
+    fitter->setL1Phase(0.);
+  }
+  const int npulses = 200;
+  int ncompared = 0;
+  for (int ipulse = 0; ipulse < npulses; ipulse++) {
+    std::vector<Bunch> bunches{createPulse(ampdist(generator), peakdist(generator), 2., generator)};
+    auto resultLM = fitterLM.evaluate(bunches);
+    auto resultStandard = fitterStandard.evaluate(bunches);
+    // ndf is only set if the fit was done, otherwise the estimates are used
+    if (!resultLM.getNdf() || !resultStandard.getNdf()) {
+      continue;
+    }
+    ncompared++;
+    BOOST_CHECK_CLOSE(resultLM.getAmp(), resultStandard.getAmp(), 1.);
+    BOOST_CHECK_SMALL(resultLM.getTime() - resultStandard.getTime(), 0.05 * constants::EMCAL_TIMESAMPLE);
+  }
+  BOOST_CHECK_GT(ncompared, 0.9 * npulses);
+}
+
+} // namespace emcal
+} // namespace o2
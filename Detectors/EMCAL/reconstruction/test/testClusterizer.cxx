@@ -0,0 +1,280 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#define BOOST_TEST_MODULE Test EMCAL Clusterizer
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "DataFormatsEMCAL/Cell.h"
+#include "EMCALBase/Geometry.h"
+#include "EMCALReconstruction/Clusterizer.h"
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+
+namespace o2
+{
+namespace emcal
+{
+
+namespace
+{
+constexpr double TimeCut = 20., TimeMin = 0., TimeMax = 10000., GradientCut = 0.03, SeedThreshold = 0.1, CellThreshold = 0.05;
+
+struct ClusterResult {
+  std::vector<Cluster> clusters;
+  std::vector<ClusterIndex> indices;
+};
+
+/// Clusters and cell indices found by the Clusterizer
+ClusterResult runClusterizer(Geometry* geometry, const std::vector<Cell>& cells, int nThreads)
+{
+  Clusterizer<Cell> clusterizer(TimeCut, TimeMin, TimeMax, GradientCut, true, SeedThreshold, CellThreshold);
+  clusterizer.setGeometry(geometry);
+  clusterizer.setNThreads(nThreads);
+  clusterizer.findClusters(cells);
+  return {*clusterizer.getFoundClusters(), *clusterizer.getFoundClustersInputIndices()};
+}
+
+/// Reference with the recursive neighbour search the Clusterizer used before the iterative one
+class RecursiveClusterizer
+{
+ public:
+  RecursiveClusterizer(Geometry* geometry) : mGeometry(geometry) {}
+
+  ClusterResult findClusters(const std::vector<Cell>& cells)
+  {
+    ClusterResult result;
+    for (auto& row : mInputMap) {
+      row.fill({nullptr, -1});
+    }
+    for (auto& row : mCellMask) {
+      row.fill(false);
+    }
+    std::vector<Seed> seeds;
+    for (int index = 0; index < int(cells.size()); index++) {
+      const auto& cell = cells[index];
+      if (cell.getEnergy() < CellThreshold || cell.getTimeStamp() > TimeMax || cell.getTimeStamp() < TimeMin || !mGeometry->CheckAbsCellId(cell.getTower())) {
+        continue;
+      }
+      auto [row, column] = getTopologicalRowColumn(cell);
+      mInputMap[row][column] = {&cell, index};
+      seeds.push_back({cell.getEnergy(), row, column});
+    }
+    std::sort(seeds.begin(), seeds.end());
+    for (int i = int(seeds.size()) - 1; i >= 0; i--) {
+      int row = seeds[i].row, column = seeds[i].column;
+      if (mCellMask[row][column] || seeds[i].energy <= SeedThreshold) {
+        continue;
+      }
+      std::vector<Input> clusterInputs;
+      getClusterFromNeighbours(clusterInputs, row, column);
+      int indexStart = result.indices.size();
+      for (const auto& input : clusterInputs) {
+        result.indices.push_back(input.index);
+      }
+      result.clusters.emplace_back(mInputMap[row][column].cell->getTimeStamp(), indexStart, int(result.indices.size()) - indexStart);
+    }
+    return result;
+  }
+
+ private:
+  struct Input {
+    const Cell* cell;
+    int index;
+  };
+  struct Seed {
+    float energy;
+    int row;
+    int column;
+    bool operator<(const Seed& rhs) const { return energy < rhs.energy; }
+  };
+
+  std::pair<int, int> getTopologicalRowColumn(const Cell& cell) const
+  {
+    auto [supermodule, module, phiInModule, etaInModule] = mGeometry->GetCellIndex(cell.getTower());
+    auto [row, column] = mGeometry->GetCellPhiEtaIndexInSModule(supermodule, module, phiInModule, etaInModule);
+    row += supermodule / 2 * (24 + 1);
+    column += supermodule % 2 * (mGeometry->IsDCALSM(supermodule) ? 48 + 1 : 48);
+    return {row, column};
+  }
+
+  void getClusterFromNeighbours(std::vector<Input>& clusterInputs, int row, int column)
+  {
+    if (!clusterInputs.size()) {
+      clusterInputs.emplace_back(mInputMap[row][column]);
+    }
+    mCellMask[row][column] = true;
+    constexpr int rowDiffs[4] = {-1, 0, 0, 1};
+    constexpr int colDiffs[4] = {0, -1, 1, 0};
+    for (int dir = 0; dir < 4; dir++) {
+      int nextRow = row + rowDiffs[dir], nextColumn = column + colDiffs[dir];
+      if (nextRow < 0 || nextRow >= NROWS || nextColumn < 0 || nextColumn >= NCOLS) {
+        continue;
+      }
+      const auto& next = mInputMap[nextRow][nextColumn];
+      if (!next.cell || mCellMask[nextRow][nextColumn]) {
+        continue;
+      }
+      if (next.cell->getEnergy() > mInputMap[row][column].cell->getEnergy() + GradientCut) {
+        continue;
+      }
+      if (!(std::abs(next.cell->getTimeStamp() - mInputMap[row][column].cell->getTimeStamp()) > TimeCut)) {
+        getClusterFromNeighbours(clusterInputs, nextRow, nextColumn);
+        clusterInputs.emplace_back(next);
+      }
+    }
+  }
+
+  Geometry* mGeometry;
+  std::array<std::array<Input, NCOLS>, NROWS> mInputMap;
+  std::array<std::array<bool, NCOLS>, NROWS> mCellMask;
+};
+
+void compareResults(const ClusterResult& result, const ClusterResult& reference)
+{
+  BOOST_REQUIRE_EQUAL(result.clusters.size(), reference.clusters.size());
+  for (size_t icl = 0; icl < result.clusters.size(); icl++) {
+    const auto& cluster = result.clusters[icl];
+    const auto& refCluster = reference.clusters[icl];
+    BOOST_CHECK_EQUAL(cluster.getCellIndexFirst(), refCluster.getCellIndexFirst());
+    BOOST_CHECK_EQUAL(cluster.getNCells(), refCluster.getNCells());
+    BOOST_CHECK_EQUAL(float(cluster.getTimeStamp()), float(refCluster.getTimeStamp()));
+  }
+  BOOST_CHECK_EQUAL_COLLECTIONS(result.indices.begin(), result.indices.end(), reference.indices.begin(), reference.indices.end());
+}
+
+/// Cells in random towers with exponential energy spectrum, each tower at most once
+std::vector<Cell> createRandomCells(Geometry* geometry, int nCells, unsigned int seed)
+{
+  std::mt19937 generator(seed);
+  std::uniform_int_distribution<int> towerdist(0, geometry->GetNCells() - 1);
+  std::exponential_distribution<float> energydist(3.);
+  std::normal_distribution<float> timedist(600., 10.);
+  std::vector<bool> used(geometry->GetNCells(), false);
+  std::vector<Cell> cells;
+  while (static_cast<int>(cells.size()) < nCells) {
+    auto tower = towerdist(generator);
+    if (used[tower]) {
+      continue;
+    }
+    used[tower] = true;
+    cells.emplace_back(tower, energydist(generator), timedist(generator));
+  }
+  return cells;
+}
+
+/// Hand made clusters: touching clusters separated by an energy valley, a cluster split by the
+/// time cut, and cells on both sides of the gap between supermodules in phi and of DCAL in eta
+std::vector<Cell> createFixtureCells(Geometry* geometry)
+{
+  std::vector<Cell> cells;
+  auto add = [&cells, geometry](int supermodule, int iphi, int ieta, float energy, float time = 600.) {
+    cells.emplace_back(geometry->GetAbsCellIdFromCellIndexes(supermodule, iphi, ieta), energy, time);
+  };
+  // two touching showers in SM 0: peaks at eta 10 and 14, valley at eta 12
+  const float showerA[] = {0.3, 1.5, 3.0, 0.8, 0.4, 0.9, 2.0, 0.7};
+  for (int ieta = 0; ieta < 8; ieta++) {
+    add(0, 5, 8 + ieta, showerA[ieta]);
+    add(0, 6, 8 + ieta, 0.5f * showerA[ieta] + 0.01f * ieta);
+  }
+  // shower in SM 1 with a tail out of time, split into two clusters by the time cut
+  add(1, 10, 20, 4.0);
+  add(1, 10, 21, 1.0);
+  add(1, 11, 20, 0.9);
+  add(1, 10, 22, 0.6, 660.);
+  add(1, 10, 23, 0.5, 661.);
+  // cells touching across the gap between the phi rows of SM 0/2 and across SM 0/1 in eta
+  add(0, 23, 47, 2.5);
+  add(2, 0, 47, 2.2);
+  add(1, 23, 0, 1.8);
+  // cells on both sides of the DCAL gap in eta (SM 12 and 13)
+  add(12, 7, 31, 1.2);
+  add(13, 7, 0, 1.1);
+  // long chain of decreasing energies in the last supermodule row, deep in the neighbour search
+  for (int ieta = 0; ieta < 32; ieta++) {
+    add(18, 3, ieta, 3.f - 0.05f * ieta);
+    add(18, 4, ieta, 2.9f - 0.05f * ieta);
+  }
+  return cells;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(Clusterizer_RecursiveReference)
+{
+  auto geometry = Geometry::GetInstanceFromRunNumber(300000);
+  RecursiveClusterizer reference(geometry);
+  auto fixture = createFixtureCells(geometry);
+  auto referenceFixture = reference.findClusters(fixture);
+  // at least the touching showers, the prompt and late parts of the SM 1 shower, the cells on both sides of the gaps and the chain
+  BOOST_CHECK(referenceFixture.clusters.size() >= 2 + 2 + 2 + 2 + 1);
+  compareResults(runClusterizer(geometry, fixture, 1), referenceFixture);
+
+  for (unsigned int seed = 1; seed <= 3; seed++) {
+    auto cells = createRandomCells(geometry, 3000, seed);
+    compareResults(runClusterizer(geometry, cells, 1), reference.findClusters(cells));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Clusterizer_Threads)
+{
+  auto geometry = Geometry::GetInstanceFromRunNumber(300000);
+  std::vector<std::vector<Cell>> inputs{createFixtureCells(geometry)};
+  for (unsigned int seed = 1; seed <= 3; seed++) {
+    inputs.push_back(createRandomCells(geometry, 5000, seed));
+  }
+  for (const auto& cells : inputs) {
+    auto sequential = runClusterizer(geometry, cells, 1);
+    BOOST_CHECK(sequential.clusters.size() > 0);
+    for (int nThreads : {2, 4, 10}) {
+      compareResults(runClusterizer(geometry, cells, nThreads), sequential);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Clusterizer_ThreadsUsed)
+{
+  auto geometry = Geometry::GetInstanceFromRunNumber(300000);
+  auto cells = createRandomCells(geometry, 5000, 1);
+  auto sequential = runClusterizer(geometry, cells, 1);
+  Clusterizer<Cell> clusterizer(TimeCut, TimeMin, TimeMax, GradientCut, true, SeedThreshold, CellThreshold);
+  clusterizer.setGeometry(geometry);
+  clusterizer.setNThreads(4);
+  clusterizer.findClusters(cells);
+  compareResults({*clusterizer.getFoundClusters(), *clusterizer.getFoundClustersInputIndices()}, sequential);
+#ifdef WITH_OPENMP
+  // the supermodule rows are searched by several threads when the clusterizer is not called from a parallel region
+  BOOST_CHECK_EQUAL(clusterizer.getNThreadsUsed(), 4);
+
+  // from a parallel region without nested parallelism, as with the trigger records distributed
+  // among threads, the search of the rows falls back to a single thread with the same result
+  omp_set_max_active_levels(1);
+  std::vector<Clusterizer<Cell>> clusterizers(2, clusterizer);
+#pragma omp parallel for num_threads(2)
+  for (int ithread = 0; ithread < 2; ithread++) {
+    clusterizers[ithread].findClusters(cells);
+  }
+  for (const auto& clusterizerNested : clusterizers) {
+    BOOST_CHECK_EQUAL(clusterizerNested.getNThreadsUsed(), 1);
+    compareResults({*clusterizerNested.getFoundClusters(), *clusterizerNested.getFoundClustersInputIndices()}, sequential);
+  }
+#else
+  BOOST_CHECK_EQUAL(clusterizer.getNThreadsUsed(), 1);
+#endif
+}
+
+} // namespace emcal
+} // namespace o2
@@ -41,6 +41,13 @@ namespace reco_workflow
 /// The resulting cluster objects contain a range of digits
 /// that can be found in output digit indices object
 ///
+/// With --nthreads the trigger records of a timeframe are
+/// distributed among threads, each with its own clusterizer.
+/// If there are fewer trigger records than threads, the
+/// trigger records are processed one after the other and
+/// the threads are used inside the clusterizer to process
+/// the supermodule rows in parallel.
+///
 template <class InputType>
 class ClusterizerSpec : public framework::Task
 {
@@ -68,7 +75,8 @@ class ClusterizerSpec : public framework::Task
   void endOfStream(framework::EndOfStreamContext& ec) final;
 
  private:
-  o2::emcal::Clusterizer<InputType> mClusterizer;                               ///< Clusterizer object
+  std::vector<o2::emcal::Clusterizer<InputType>> mClusterizers;                 ///< Clusterizer objects, one per thread
+  int mNThreads = 1;                                                            ///< Number of threads
   o2::emcal::Geometry* mGeometry = nullptr;                                     ///< Pointer to geometry object
   std::vector<o2::emcal::Cluster>* mOutputClusters = nullptr;                   ///< Container with output clusters (pointer)
   std::vector<o2::emcal::ClusterIndex>* mOutputCellDigitIndices = nullptr;      ///< Container with indices of cluster digits (pointer)
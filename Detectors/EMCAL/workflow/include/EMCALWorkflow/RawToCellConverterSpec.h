@@ -102,14 +102,14 @@ namespace reco_workflow
 /// | EMC/FASTORSTRGR      | 1                 | yes       | Trigger reconrds related to L0 timesums            |
 ///
 /// Workflow options (via --EMCALRawToCellConverterSpec ...):
-/// | Option              | Default | Possible values | Purpose                                        |
-/// |---------------------|---------|-----------------|------------------------------------------------|
-/// | fitmethod           | gamma2  | gamma2,standard | Raw fit method                                 |
-/// | maxmessage          | 100     | any int         | Max. amount of error messages on infoLogger    |
-/// | printtrailer        | false   | set (bool)      | Print RCU trailer (for debugging)              |
-/// | no-mergeHGLG        | false   | set (bool)      | Do not merge HG and LG channels for same tower |
-/// | no-checkactivelinks | false   | set (bool)      | Do not check for active links per BC           |
-/// | no-evalpedestal     | false   | set (bool)      | Disable pedestal evaluation                    |
+/// | Option              | Default | Possible values    | Purpose                                        |
+/// |---------------------|---------|--------------------|------------------------------------------------|
+/// | fitmethod           | gamma2  | gamma2,standard,lm | Raw fit method                                 |
+/// | maxmessage          | 100     | any int            | Max. amount of error messages on infoLogger    |
+/// | printtrailer        | false   | set (bool)         | Print RCU trailer (for debugging)              |
+/// | no-mergeHGLG        | false   | set (bool)         | Do not merge HG and LG channels for same tower |
+/// | no-checkactivelinks | false   | set (bool)         | Do not check for active links per BC           |
+/// | no-evalpedestal     | false   | set (bool)         | Disable pedestal evaluation                    |
 ///
 /// Global switches of the EMCAL reco workflow related to the RawToCellConverter:
 /// | Option                         | Default | Purpose                                       |
@@ -22,6 +22,7 @@
 #include "SimulationDataFormat/MCTruthContainer.h"
 #include "EMCALReconstruction/CaloRawFitterStandard.h"
 #include "EMCALReconstruction/CaloRawFitterGamma2.h"
+#include "EMCALReconstruction/CaloRawFitterLM.h"
 #include "EMCALReconstruction/RecoParam.h"
 
 using namespace o2::emcal::reco_workflow;
@@ -44,6 +45,9 @@ void CellConverterSpec::init(framework::InitContext& ctx)
   } else if (fitmethod == "gamma2") {
     LOG(info) << "Using gamma2 raw fitter";
     mRawFitter = std::unique_ptr<o2::emcal::CaloRawFitter>(new o2::emcal::CaloRawFitterGamma2);
+  } else if (fitmethod == "lm") {
+    LOG(info) << "Using Levenberg-Marquardt raw fitter";
+    mRawFitter = std::unique_ptr<o2::emcal::CaloRawFitter>(new o2::emcal::CaloRawFitterLM);
   }
   mRawFitter->setAmpCut(0.);
   mRawFitter->setL1Phase(0.);
@@ -474,5 +478,5 @@ o2::framework::DataProcessorSpec o2::emcal::reco_workflow::getCellConverterSpec(
                                           outputs,
                                           o2::framework::adaptFromTask<o2::emcal::reco_workflow::CellConverterSpec>(propagateMC, inputSubspec, outputSubspec, calibhandler),
                                           o2::framework::Options{
-                                            {"fitmethod", o2::framework::VariantType::String, "gamma2", {"Fit method (standard or gamma2)"}}}};
+                                            {"fitmethod", o2::framework::VariantType::String, "gamma2", {"Fit method (standard, gamma2 or lm)"}}}};
 }
@@ -8,6 +8,7 @@
 // In applying this license CERN does not waive the privileges and immunities
 // granted to it by virtue of its status as an Intergovernmental Organization
 // or submit itself to any jurisdiction.
+#include <algorithm>
 #include <gsl/span>
 
 #include <InfoLogger/InfoLogger.hxx>
@@ -43,9 +44,20 @@ void ClusterizerSpec<InputType>::init(framework::InitContext& ctx)
     LOG(error) << "Failure accessing geometry";
   }
 
-  // Initialize clusterizer and link geometry
-  mClusterizer.initialize(timeCut, timeMin, timeMax, gradientCut, doEnergyGradientCut, thresholdSeedEnergy, thresholdCellEnergy);
-  mClusterizer.setGeometry(mGeometry);
+  mNThreads = std::max(1, ctx.options().get<int>("nthreads"));
+#ifndef WITH_OPENMP
+  if (mNThreads > 1) {
+    LOG(warning) << "[EMCALClusterizer - init] Compiled without OpenMP support, ignoring nthreads " << mNThreads;
+    mNThreads = 1;
+  }
+#endif
+
+  // Initialize clusterizers and link geometry
+  mClusterizers.resize(mNThreads);
+  for (auto& clusterizer : mClusterizers) {
+    clusterizer.initialize(timeCut, timeMin, timeMax, gradientCut, doEnergyGradientCut, thresholdSeedEnergy, thresholdCellEnergy);
+    clusterizer.setGeometry(mGeometry);
+  }
 
   mOutputClusters = new std::vector<o2::emcal::Cluster>();
   mOutputCellDigitIndices = new std::vector<o2::emcal::ClusterIndex>();
@@ -82,29 +94,56 @@ void ClusterizerSpec<InputType>::run(framework::ProcessingContext& ctx)
   mOutputTriggerRecord->clear();
   mOutputTriggerRecordIndices->clear();
 
-  int currentStartClusters = mOutputClusters->size();
-  int currentStartIndices = mOutputCellDigitIndices->size();
-  for (auto iTrgRcrd : InputTriggerRecord) {
-    if (Inputs.size() && iTrgRcrd.getNumberOfObjects()) {
-      mClusterizer.findClusters(gsl::span<const InputType>(&Inputs[iTrgRcrd.getFirstEntry()], iTrgRcrd.getNumberOfObjects())); // Find clusters on cells/digits (pass by ref)
-    } else {
-      mClusterizer.clear();
+  // The threads are used at one level only, as nested parallel regions are serialized by default:
+  // with at least as many trigger records as threads, each thread clusterizes a contiguous range of
+  // trigger records with its own clusterizer, otherwise the trigger records are processed one after
+  // the other and the threads search the clusters of the supermodule rows in parallel.
+  // The output of the threads is concatenated in trigger record order afterwards
+  int nTriggers = InputTriggerRecord.size();
+  int nThreadsTrigger = nTriggers >= mNThreads ? mNThreads : 1;
+  int nThreadsRows = nThreadsTrigger > 1 ? 1 : mNThreads;
+  std::vector<std::vector<o2::emcal::Cluster>> threadClusters(nThreadsTrigger);
+  std::vector<std::vector<o2::emcal::ClusterIndex>> threadCellDigitIndices(nThreadsTrigger);
+  std::vector<int> nClusters(nTriggers), nCellDigitIndices(nTriggers);
+#ifdef WITH_OPENMP
+#pragma omp parallel for num_threads(nThreadsTrigger) if (nThreadsTrigger > 1)
+#endif
+  for (int ithread = 0; ithread < nThreadsTrigger; ithread++) {
+    auto& clusterizer = mClusterizers[ithread];
+    clusterizer.setNThreads(nThreadsRows);
+    for (int itrg = ithread * nTriggers / nThreadsTrigger; itrg < (ithread + 1) * nTriggers / nThreadsTrigger; itrg++) {
+      auto& iTrgRcrd = InputTriggerRecord[itrg];
+      if (Inputs.size() && iTrgRcrd.getNumberOfObjects()) {
+        clusterizer.findClusters(gsl::span<const InputType>(&Inputs[iTrgRcrd.getFirstEntry()], iTrgRcrd.getNumberOfObjects())); // Find clusters on cells/digits (pass by ref)
+      } else {
+        clusterizer.clear();
+      }
+      // Get found clusters + cell/digit indices for output
+      // * A cluster contains a range that correspond to the vector of cell/digit indices
+      // * The cell/digit index vector contains the indices of the clusterized cells/digits wrt to the original cell/digit array
+
+      auto outputClustersTemp = clusterizer.getFoundClusters();
+      auto outputCellDigitIndicesTemp = clusterizer.getFoundClustersInputIndices();
+
+      std::copy(outputClustersTemp->begin(), outputClustersTemp->end(), std::back_inserter(threadClusters[ithread]));
+      std::copy(outputCellDigitIndicesTemp->begin(), outputCellDigitIndicesTemp->end(), std::back_inserter(threadCellDigitIndices[ithread]));
+      nClusters[itrg] = outputClustersTemp->size();
+      nCellDigitIndices[itrg] = outputCellDigitIndicesTemp->size();
     }
-    // Get found clusters + cell/digit indices for output
-    // * A cluster contains a range that correspond to the vector of cell/digit indices
-    // * The cell/digit index vector contains the indices of the clusterized cells/digits wrt to the original cell/digit array
-
-    auto outputClustersTemp = mClusterizer.getFoundClusters();
-    auto outputCellDigitIndicesTemp = mClusterizer.getFoundClustersInputIndices();
-
-    std::copy(outputClustersTemp->begin(), outputClustersTemp->end(), std::back_inserter(*mOutputClusters));
-    std::copy(outputCellDigitIndicesTemp->begin(), outputCellDigitIndicesTemp->end(), std::back_inserter(*mOutputCellDigitIndices));
-
-    mOutputTriggerRecord->emplace_back(iTrgRcrd.getBCData(), currentStartClusters, outputClustersTemp->size());
-    mOutputTriggerRecordIndices->emplace_back(iTrgRcrd.getBCData(), currentStartIndices, outputCellDigitIndicesTemp->size());
+  }
 
-    currentStartClusters = mOutputClusters->size();
-    currentStartIndices = mOutputCellDigitIndices->size();
+  for (int ithread = 0; ithread < nThreadsTrigger; ithread++) {
+    std::copy(threadClusters[ithread].begin(), threadClusters[ithread].end(), std::back_inserter(*mOutputClusters));
+    std::copy(threadCellDigitIndices[ithread].begin(), threadCellDigitIndices[ithread].end(), std::back_inserter(*mOutputCellDigitIndices));
+  }
+  int currentStartClusters = 0;
+  int currentStartIndices = 0;
+  for (int itrg = 0; itrg < nTriggers; itrg++) {
+    mOutputTriggerRecord->emplace_back(InputTriggerRecord[itrg].getBCData(), currentStartClusters, nClusters[itrg]);
+    mOutputTriggerRecordIndices->emplace_back(InputTriggerRecord[itrg].getBCData(), currentStartIndices, nCellDigitIndices[itrg]);
+
+    currentStartClusters += nClusters[itrg];
+    currentStartIndices += nCellDigitIndices[itrg];
   }
   LOG(debug) << "[EMCALClusterizer - run] Writing " << mOutputClusters->size() << " clusters ...";
   ctx.outputs().snapshot(o2::framework::Output{o2::header::gDataOriginEMC, "CLUSTERS", 0}, *mOutputClusters);
@@ -143,11 +182,13 @@ o2::framework::DataProcessorSpec o2::emcal::reco_workflow::getClusterizerSpec(bo
     return o2::framework::DataProcessorSpec{"EMCALClusterizerSpec",
                                             inputs,
                                             outputs,
-                                            o2::framework::adaptFromTask<o2::emcal::reco_workflow::ClusterizerSpec<o2::emcal::Digit>>()};
+                                            o2::framework::adaptFromTask<o2::emcal::reco_workflow::ClusterizerSpec<o2::emcal::Digit>>(),
+                                            o2::framework::Options{{"nthreads", o2::framework::VariantType::Int, 1, {"Number of threads used in the clusterization"}}}};
   } else {
     return o2::framework::DataProcessorSpec{"EMCALClusterizerSpec",
                                             inputs,
                                             outputs,
-                                            o2::framework::adaptFromTask<o2::emcal::reco_workflow::ClusterizerSpec<o2::emcal::Cell>>()};
+                                            o2::framework::adaptFromTask<o2::emcal::reco_workflow::ClusterizerSpec<o2::emcal::Cell>>(),
+                                            o2::framework::Options{{"nthreads", o2::framework::VariantType::Int, 1, {"Number of threads used in the clusterization"}}}};
   }
 }
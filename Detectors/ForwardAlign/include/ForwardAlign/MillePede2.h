@@ -20,6 +20,8 @@
 #define ALICEO2_FWDALIGN_MILLEPEDE2_H
 
 #include <vector>
+#include <memory>
+#include <functional>
 #include <TString.h>
 #include <TTree.h>
 #include "ForwardAlign/MinResSolve.h"
@@ -49,6 +51,7 @@ class MillePede2
          kInvert,
          kNoInversion };   // used global matrix solution methods
   enum { kFixParID = -1 }; // dummy id for fixed param
+  enum { kNRecPerThread = 500 }; // records fitted by each thread before their contributions are added to the global matrix
 
   MillePede2();
   MillePede2(const MillePede2& src);
@@ -97,7 +100,7 @@ class MillePede2
   }
 
   MatrixSq* GetGlobalMatrix() const { return fMatCGlo; }
-  SymMatrix* GetLocalMatrix() const { return fMatCLoc; }
+  SymMatrix* GetLocalMatrix() const { return fLocFitBuf.empty() ? nullptr : &fLocFitBuf[0]->matCLoc; }
   std::vector<double> GetGlobals() const { return fVecBGlo; }
   std::vector<double> GetDeltaPars() const { return fDeltaPar; }
   std::vector<double> GetInitPars() const { return fInitPar; }
@@ -206,6 +209,10 @@ class MillePede2
   static int GetIterSolverType() { return fgIterSol; }
   static int GetNKrylovV() { return fgNKrylovV; }
 
+  /// \brief set the number of threads used for the local fits of the data records and for the global matrix solution
+  static void SetNThreads(const int n = 1);
+  static int GetNThreads() { return fgNThreads; }
+
   /// \brief return error for parameter iPar
   double GetParError(int iPar) const;
 
@@ -290,6 +297,44 @@ class MillePede2
   void DisableRecordWriter() { fDisableRecordWriter = true; }
 
  protected:
+  /// \brief buffers of the local fit of the data records processed by one thread
+  ///
+  /// The contributions of the records to the global matrix and vector are not added directly but stored
+  /// in the order in which they are computed and added later by AddLocalFits(), such that the global system
+  /// does not depend on the number of threads used for the local fits
+  struct LocFitBuffer {
+    LocFitBuffer(const int nGlo, const int nLoc);
+
+    /// \brief reset the stored contributions
+    void Clear();
+
+    // local fit
+    o2::fwdalign::SymMatrix matCLoc;     ///< Matrix C local
+    o2::fwdalign::RectMatrix matCGloLoc; ///< Rectangular matrix C g*l
+    std::vector<double> vecBLoc;         ///< [fNGloPar] Vector B local (parameters)
+    std::vector<int> glo2CGlo;           ///< [fNGloPar] global ID to compressed ID buffer
+    std::vector<int> cGlo2Glo;           ///< [fNGloPar] compressed ID to global ID buffer
+    std::vector<int> refLoc;             ///< position of the local derivatives of each point in the record
+    std::vector<int> refGlo;             ///< position of the global derivatives of each point in the record
+    std::vector<int> nrefLoc;            ///< number of local derivatives of each point
+    std::vector<int> nrefGlo;            ///< number of global derivatives of each point
+
+    // contributions to the global system
+    std::vector<int> rowMatCGlo;      ///< rows of the global matrix filled by MatrixSq::AddToRow
+    std::vector<int> nFillMatCGlo;    ///< number of elements added to each of these rows
+    std::vector<int> fillIndex;       ///< column indices of the added elements
+    std::vector<double> fillValue;    ///< values of the added elements
+    std::vector<int> indexVecBGlo;    ///< indices of the updated elements of the global vector
+    std::vector<double> valueVecBGlo; ///< values added to these elements
+    std::vector<int> procPnt;         ///< global parameters of the processed points
+    std::vector<float> sumChi2;         ///< chi2/ndf of the records to store in the chi2 tree
+    std::vector<bool> isChi2BelowLimit; ///< are these records accepted by the chi2 cut
+    std::vector<int> recNDoF;           ///< number of degrees of freedom of these records
+    long nLocFits = 0;                  ///< change of the number of local fits
+    long nLocFitsRejected = 0;          ///< number of rejected local fits
+    long nLocEquations = 0;             ///< change of the number of local equations
+  };
+
   /// \brief read data record (if any) at entry recID
   void ReadRecordData(const long recID, const bool doPrint = false);
 
@@ -301,6 +346,20 @@ class MillePede2
   /// localParams = (if !=0) will contain the fitted track parameters and related errors
   int LocalFit(std::vector<double>& localParams);
 
+  /// \brief Perform the local fit of a record with the given buffers
+  ///
+  /// The contribution of the record to the global system is stored in the buffer, see AddLocalFits()
+  int LocalFit(o2::fwdalign::MillePedeRecord& record, const long recID, const double runWgh,
+               LocFitBuffer& buf, std::vector<double>& localParams) const;
+
+  /// \brief add (or remove, see fLocFitAdd) the contributions stored in the buffer to the global system
+  void AddLocalFits(LocFitBuffer& buf);
+
+  /// \brief fit the acceptable data records in [first, first + nRec) for which select (if any) is true
+  ///        and add their contributions to the global system, using fgNThreads threads
+  void ProcessDataRecords(const long first, const long nRec,
+                          const std::function<bool(const o2::fwdalign::MillePedeRecord&)>& select = nullptr);
+
   bool IsZero(const double v, const double eps = 1e-16) const { return TMath::Abs(v) < eps; }
 
  protected:
@@ -329,7 +388,6 @@ class MillePede2
   int fNGroupsSet;               ///< number of groups set
   std::vector<int> fParamGrID;   ///< [fNGloPar] group id for the every parameter
   std::vector<int> fProcPnt;     ///< [fNGloPar] N of processed points per global variable
-  std::vector<double> fVecBLoc;  ///< [fNLocPar] Vector B local (parameters)
   std::vector<double> fDiagCGlo; ///< [fNGloPar] Initial diagonal elements of C global matrix
   std::vector<double> fVecBGlo;  //! Vector B global (parameters)
 
@@ -340,15 +398,9 @@ class MillePede2
   std::vector<bool> fIsLinear;   ///< [fNGloPar] Flag for linear parameters
   std::vector<bool> fConstrUsed; //! Flag for used constraints
 
-  std::vector<int> fGlo2CGlo; ///< [fNGloPar] global ID to compressed ID buffer
-  std::vector<int> fCGlo2Glo; ///< [fNGloPar] compressed ID to global ID buffer
-
   // Matrices
-  o2::fwdalign::SymMatrix* fMatCLoc;     ///< Matrix C local
-  o2::fwdalign::MatrixSq* fMatCGlo;      ///< Matrix C global
-  o2::fwdalign::RectMatrix* fMatCGloLoc; ///< Rectangular matrix C g*l
-  std::vector<int> fFillIndex;           ///< [fNGloPar] auxilary index array for fast matrix fill
-  std::vector<double> fFillValue;        ///< [fNGloPar] auxilary value array for fast matrix fill
+  o2::fwdalign::MatrixSq* fMatCGlo;                       ///< Matrix C global
+  std::vector<std::unique_ptr<LocFitBuffer>> fLocFitBuf; //! local fit buffers, one per thread
 
   TFile* fRecChi2File;
   TString fRecChi2FName;
@@ -383,6 +435,7 @@ class MillePede2
   static int fgMinResMaxIter;   ///< Max number of iterations for the MinRes method
   static int fgIterSol;         ///< type of iterative solution: MinRes or FGMRES
   static int fgNKrylovV;        ///< size of Krylov vectors buffer in FGMRES
+  static int fgNThreads;        ///< number of threads for the local fits and the global matrix solution
 
   // processed data record bufferization
   o2::fwdalign::MilleRecordWriter* fRecordWriter;         ///< data record writer
@@ -16,6 +16,7 @@
 #ifndef ALICEO2_FWDALIGN_SYMMATRIX_H
 #define ALICEO2_FWDALIGN_SYMMATRIX_H
 
+#include <atomic>
 #include <TVectorD.h>
 #include <TString.h>
 
@@ -203,7 +204,16 @@ class SymMatrix : public MatrixSq
   /// Solution a la MP1: gaussian eliminations
   int SolveSpmInv(double* vecB, Bool_t stabilize = kTRUE);
 
+  /// \brief set the number of threads for the Choleski decomposition and inversion, the gaussian eliminations
+  ///        and the multiplication by vector of matrices with at least kMinSizeMT used rows
+  static void SetNThreads(Int_t n) { fgNThreads = n > 0 ? n : 1; }
+  static Int_t GetNThreads() { return fgNThreads; }
+
+  enum { kMinSizeMT = 100 }; ///< smaller matrices are always processed in a single thread
+
  protected:
+  Bool_t IsMultiThreaded() const { return fgNThreads > 1 && GetSizeUsed() >= kMinSizeMT; }
+
   virtual Int_t GetIndex(Int_t row, Int_t col) const;
   Double_t GetEl(Int_t row, Int_t col) const { return operator()(row, col); }
   void SetEl(Int_t row, Int_t col, Double_t val) { operator()(row, col) = val; }
@@ -212,8 +222,9 @@ class SymMatrix : public MatrixSq
   Double_t* fElems;     ///<   Elements booked by constructor
   Double_t** fElemsAdd; ///<   Elements (rows) added dynamicaly
 
-  static SymMatrix* fgBuffer; ///< buffer for fast solution
-  static Int_t fgCopyCnt;     ///< matrix copy counter
+  static thread_local SymMatrix* fgBuffer; ///< buffer for fast solution, one per thread
+  static std::atomic<Int_t> fgCopyCnt;      ///< matrix copy counter
+  static Int_t fgNThreads;                  ///< number of threads for the operations on large matrices
 
   ClassDefOverride(SymMatrix, 0);
 };
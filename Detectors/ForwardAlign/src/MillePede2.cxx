@@ -26,6 +26,7 @@
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <fstream>
+#include <algorithm>
 
 // #define _DUMP_EQ_BEFORE_
 // #define _DUMP_EQ_AFTER_
@@ -46,6 +47,7 @@ double MillePede2::fgMinResTol = 1.e-11;             // default tolerance
 int MillePede2::fgMinResMaxIter = 10000;             // default max number of iterations
 int MillePede2::fgIterSol = MinResSolve::kSolMinRes; // default iterative solver
 int MillePede2::fgNKrylovV = 240;                    // default number of Krylov vectors to keep
+int MillePede2::fgNThreads = 1;                      // single-threaded by default
 
 //_____________________________________________________________________________
 MillePede2::MillePede2()
@@ -69,9 +71,7 @@ MillePede2::MillePede2()
     fResCut(100.),
     fMinPntValid(1),
     fNGroupsSet(0),
-    fMatCLoc(nullptr),
     fMatCGlo(nullptr),
-    fMatCGloLoc(nullptr),
     fRecChi2File(nullptr),
     fRecChi2FName("chi2_records.root"),
     fRecChi2TreeName("chi2Records"),
@@ -122,9 +122,7 @@ MillePede2::MillePede2(const MillePede2& src)
     fResCut(100.),
     fMinPntValid(1),
     fNGroupsSet(0),
-    fMatCLoc(nullptr),
     fMatCGlo(nullptr),
-    fMatCGloLoc(nullptr),
     fRecChi2File(nullptr),
     fRecChi2FName("chi2_records.root"),
     fRecChi2TreeName("chi2Records"),
@@ -158,15 +156,9 @@ MillePede2::MillePede2(const MillePede2& src)
 //_____________________________________________________________________________
 MillePede2::~MillePede2()
 {
-  if (fMatCLoc) {
-    delete fMatCLoc;
-  }
   if (fMatCGlo) {
     delete fMatCGlo;
   }
-  if (fMatCGloLoc) {
-    delete fMatCGloLoc;
-  }
 
   if (fRejRunList) {
     delete fRejRunList;
@@ -236,15 +228,11 @@ int MillePede2::InitMille(int nGlo, const int nLoc,
     fMatCGlo = new SymMatrix(fNGloPar);
   }
 
-  fFillIndex = std::vector<int>(fNGloPar);
-  fFillValue = std::vector<double>(fNGloPar);
-
-  fMatCLoc = new SymMatrix(fNLocPar);
-  fMatCGloLoc = new RectMatrix(fNGloPar, fNLocPar);
+  fLocFitBuf.clear();
+  fLocFitBuf.push_back(std::make_unique<LocFitBuffer>(fNGloPar, fNLocPar));
 
   fParamGrID = std::vector<int>(fNGloPar);
   fProcPnt = std::vector<int>(fNGloPar);
-  fVecBLoc = std::vector<double>(fNGloPar);
   fDiagCGlo = std::vector<double>(fNGloPar);
 
   fInitPar = std::vector<double>(fNGloPar);
@@ -252,11 +240,7 @@ int MillePede2::InitMille(int nGlo, const int nLoc,
   fSigmaPar = std::vector<double>(fNGloPar);
   fIsLinear = std::vector<bool>(fNGloPar);
 
-  fGlo2CGlo = std::vector<int>(fNGloPar);
-  fCGlo2Glo = std::vector<int>(fNGloPar);
-
   for (int i = fNGloPar; i--;) {
-    fGlo2CGlo[i] = fCGlo2Glo[i] = -1;
     fIsLinear[i] = true;
     fParamGrID[i] = -1;
   }
@@ -500,67 +484,85 @@ void MillePede2::ReadRecordConstraint(const long recID, bool doPrint)
   fCurrRecConstrID = recID;
 }
 
+//_____________________________________________________________________________
+MillePede2::LocFitBuffer::LocFitBuffer(const int nGlo, const int nLoc)
+  : matCLoc(nLoc),
+    matCGloLoc(nGlo, nLoc),
+    vecBLoc(nGlo),
+    glo2CGlo(nGlo, -1),
+    cGlo2Glo(nGlo, -1)
+{
+}
+
+//_____________________________________________________________________________
+void MillePede2::LocFitBuffer::Clear()
+{
+  rowMatCGlo.clear();
+  nFillMatCGlo.clear();
+  fillIndex.clear();
+  fillValue.clear();
+  indexVecBGlo.clear();
+  valueVecBGlo.clear();
+  procPnt.clear();
+  sumChi2.clear();
+  isChi2BelowLimit.clear();
+  recNDoF.clear();
+  nLocFits = 0;
+  nLocFitsRejected = 0;
+  nLocEquations = 0;
+}
+
 //_____________________________________________________________________________
 int MillePede2::LocalFit(std::vector<double>& localParams)
 {
-  static int nrefSize = 0;
-  //  static TArrayI refLoc,refGlo,nrefLoc,nrefGlo;
-  static int *refLoc = nullptr, *refGlo = nullptr, *nrefLoc = nullptr, *nrefGlo = nullptr;
+  LocFitBuffer& buf = *fLocFitBuf[0];
+  int res = LocalFit(*fRecord, fCurrRecDataID, fRunWgh, buf, localParams);
+  AddLocalFits(buf);
+  return res;
+}
+
+//_____________________________________________________________________________
+int MillePede2::LocalFit(MillePedeRecord& record, const long recID, const double runWgh,
+                         LocFitBuffer& buf, std::vector<double>& localParams) const
+{
+  std::vector<int>& refLoc = buf.refLoc;
+  std::vector<int>& refGlo = buf.refGlo;
+  std::vector<int>& nrefLoc = buf.nrefLoc;
+  std::vector<int>& nrefGlo = buf.nrefGlo;
   int nPoints = 0;
-  fIsChi2BelowLimit = true;
+  const bool storeChi2 = GetCurrentIteration() == 1 && fTreeChi2;
 
-  SymMatrix& matCLoc = *fMatCLoc;
-  MatrixSq& matCGlo = *fMatCGlo;
-  RectMatrix& matCGloLoc = *fMatCGloLoc;
+  SymMatrix& matCLoc = buf.matCLoc;
+  RectMatrix& matCGloLoc = buf.matCGloLoc;
+  std::vector<double>& vecBLoc = buf.vecBLoc;
 
-  std::fill(fVecBLoc.begin(), fVecBLoc.end(), 0.);
+  std::fill(vecBLoc.begin(), vecBLoc.end(), 0.);
   matCLoc.Reset();
 
   int cnt = 0;
-  int recSz = fRecord->GetSize();
+  int recSz = record.GetSize();
+  refLoc.clear();
+  refGlo.clear();
+  nrefLoc.clear();
+  nrefGlo.clear();
 
   while (cnt < recSz) { // Transfer the measurement records to matrices
     // extract addresses of residual, weight and pointers on local and global derivatives for each point
-    if (nrefSize <= nPoints) {
-      int* tmpA = nullptr;
-      nrefSize = 2 * (nPoints + 1);
-      tmpA = refLoc;
-      refLoc = new int[nrefSize];
-      if (tmpA) {
-        memcpy(refLoc, tmpA, nPoints * sizeof(int));
-      }
-      tmpA = refGlo;
-      refGlo = new int[nrefSize];
-      if (tmpA) {
-        memcpy(refGlo, tmpA, nPoints * sizeof(int));
-      }
-      tmpA = nrefLoc;
-      nrefLoc = new int[nrefSize];
-      if (tmpA) {
-        memcpy(nrefLoc, tmpA, nPoints * sizeof(int));
-      }
-      tmpA = nrefGlo;
-      nrefGlo = new int[nrefSize];
-      if (tmpA) {
-        memcpy(nrefGlo, tmpA, nPoints * sizeof(int));
-      }
-    }
-
-    refLoc[nPoints] = ++cnt;
+    refLoc.push_back(++cnt);
     int nLoc = 0;
-    while (!fRecord->IsWeight(cnt)) {
+    while (!record.IsWeight(cnt)) {
       nLoc++;
       cnt++;
     }
-    nrefLoc[nPoints] = nLoc;
+    nrefLoc.push_back(nLoc);
 
-    refGlo[nPoints] = ++cnt;
+    refGlo.push_back(++cnt);
     int nGlo = 0;
-    while (!fRecord->IsResidual(cnt) && cnt < recSz) {
+    while (!record.IsResidual(cnt) && cnt < recSz) {
       nGlo++;
       cnt++;
     }
-    nrefGlo[nPoints] = nGlo;
+    nrefGlo.push_back(nGlo);
 
     nPoints++;
   }
@@ -570,23 +572,23 @@ int MillePede2::LocalFit(std::vector<double>& localParams)
 
   double vl;
 
-  double gloWgh = fRunWgh;
+  double gloWgh = runWgh;
   if (fUseRecordWeight) {
-    gloWgh *= fRecord->GetWeight(); // global weight for this set
+    gloWgh *= record.GetWeight(); // global weight for this set
   }
   int maxLocUsed = 0;
 
   for (int ip = nPoints; ip--;) { // Transfer the measurement records to matrices
-    double resid = fRecord->GetValue(refLoc[ip] - 1);
-    double weight = fRecord->GetValue(refGlo[ip] - 1) * gloWgh;
+    double resid = record.GetValue(refLoc[ip] - 1);
+    double weight = record.GetValue(refGlo[ip] - 1) * gloWgh;
     int odd = (ip & 0x1);
     if (fWghScl[odd] > 0) {
       weight *= fWghScl[odd];
     }
-    double* derLoc = fRecord->GetValue() + refLoc[ip];
-    double* derGlo = fRecord->GetValue() + refGlo[ip];
-    int* indLoc = fRecord->GetIndex() + refLoc[ip];
-    int* indGlo = fRecord->GetIndex() + refGlo[ip];
+    double* derLoc = record.GetValue() + refLoc[ip];
+    double* derGlo = record.GetValue() + refGlo[ip];
+    int* indLoc = record.GetIndex() + refLoc[ip];
+    int* indGlo = record.GetIndex() + refGlo[ip];
 
     for (int i = nrefGlo[ip]; i--;) { // suppress the global part (only relevant with iterations)
 
@@ -613,7 +615,7 @@ int MillePede2::LocalFit(std::vector<double>& localParams)
 
     // Symmetric matrix, don't bother j>i coeffs
     for (int i = nrefLoc[ip]; i--;) { // Fill local matrix and vector
-      fVecBLoc[indLoc[i]] += weight * resid * derLoc[i];
+      vecBLoc[indLoc[i]] += weight * resid * derLoc[i];
       if (indLoc[i] > maxLocUsed) {
         maxLocUsed = indLoc[i];
       }
@@ -627,12 +629,12 @@ int MillePede2::LocalFit(std::vector<double>& localParams)
   matCLoc.SetSizeUsed(++maxLocUsed); // data with B=0 may use less than declared nLocals
 
   /* //RRR
-  fRecord->Print("l");
+  record.Print("l");
   printf("\nBefore\nLocalMatrix: "); matCLoc.Print("l");
-  printf("RHSLoc: "); for (int i=0;i<fNLocPar;i++) printf("%+e |",fVecBLoc[i]); printf("\n");
+  printf("RHSLoc: "); for (int i=0;i<fNLocPar;i++) printf("%+e |",vecBLoc[i]); printf("\n");
   */
   // first try to solve by faster Cholesky decomposition, then by Gaussian elimination
-  double* pVecBLoc = &fVecBLoc[0];
+  double* pVecBLoc = &vecBLoc[0];
   if (!matCLoc.SolveChol(pVecBLoc, true)) {
     LOG(warning) << "MillePede2 - Failed to solve locals by Cholesky, trying Gaussian Elimination";
     if (!matCLoc.SolveSpmInv(pVecBLoc, true)) {
@@ -643,11 +645,11 @@ int MillePede2::LocalFit(std::vector<double>& localParams)
   }
 
   // If requested, store the track params and errors
-  // RRR  printf("locfit: "); for (int i=0;i<fNLocPar;i++) printf("%+e |",fVecBLoc[i]); printf("\n");
+  // RRR  printf("locfit: "); for (int i=0;i<fNLocPar;i++) printf("%+e |",vecBLoc[i]); printf("\n");
 
   if (localParams.size()) {
     for (int i = maxLocUsed; i--;) {
-      localParams[2 * i] = fVecBLoc[i];
+      localParams[2 * i] = vecBLoc[i];
       localParams[2 * i + 1] = TMath::Sqrt(TMath::Abs(matCLoc.QueryDiag(i)));
     }
   }
@@ -655,20 +657,20 @@ int MillePede2::LocalFit(std::vector<double>& localParams)
   int nEq = 0;
 
   for (int ip = nPoints; ip--;) { // Calculate residuals
-    double resid = fRecord->GetValue(refLoc[ip] - 1);
-    double weight = fRecord->GetValue(refGlo[ip] - 1) * gloWgh;
+    double resid = record.GetValue(refLoc[ip] - 1);
+    double weight = record.GetValue(refGlo[ip] - 1) * gloWgh;
     int odd = (ip & 0x1);
     if (fWghScl[odd] > 0) {
       weight *= fWghScl[odd];
     }
-    double* derLoc = fRecord->GetValue() + refLoc[ip];
-    double* derGlo = fRecord->GetValue() + refGlo[ip];
-    int* indLoc = fRecord->GetIndex() + refLoc[ip];
-    int* indGlo = fRecord->GetIndex() + refGlo[ip];
+    double* derLoc = record.GetValue() + refLoc[ip];
+    double* derGlo = record.GetValue() + refGlo[ip];
+    int* indLoc = record.GetIndex() + refLoc[ip];
+    int* indGlo = record.GetIndex() + refGlo[ip];
 
     // Suppress local and global contribution in residuals;
     for (int i = nrefLoc[ip]; i--;) {
-      resid -= derLoc[i] * fVecBLoc[indLoc[i]];
+      resid -= derLoc[i] * vecBLoc[indLoc[i]];
     } // local part
 
     for (int i = nrefGlo[ip]; i--;) { // global part
@@ -687,9 +689,9 @@ int MillePede2::LocalFit(std::vector<double>& localParams)
     double absres = TMath::Abs(resid);
     if ((absres >= fResCutInit && fIter == 1) || (absres >= fResCut && fIter > 1)) {
       if (fLocFitAdd) {
-        fNLocFitsRejected++;
+        buf.nLocFitsRejected++;
       }
-      LOGF(info, "MillePede2 - reject res %+e in record %5ld ", resid, fCurrRecDataID); // A.R. comment
+      LOGF(info, "MillePede2 - reject res %+e in record %5ld ", resid, recID); // A.R. comment
       return 0;
     }
 
@@ -700,28 +702,27 @@ int MillePede2::LocalFit(std::vector<double>& localParams)
   lChi2 /= gloWgh;
   int nDoF = nEq - maxLocUsed;
   lChi2 = (nDoF > 0) ? lChi2 / nDoF : 0; // Chi^2/dof
-  fSumChi2 = lChi2;
-  fRecNDoF = nDoF;
 
   if (fNStdDev != 0 && nDoF > 0 && lChi2 > Chi2DoFLim(fNStdDev, nDoF) * fChi2CutFactor) { // check final chi2
-    fIsChi2BelowLimit = false;
-    if (GetCurrentIteration() == 1 && fTreeChi2) {
-      fTreeChi2->Fill();
+    if (storeChi2) {
+      buf.sumChi2.push_back(lChi2);
+      buf.isChi2BelowLimit.push_back(false);
+      buf.recNDoF.push_back(nDoF);
     }
     if (fLocFitAdd) {
-      fNLocFitsRejected++;
+      buf.nLocFitsRejected++;
     }
-    LOGF(debug, "MillePede2 - reject chi2 %+e record %5ld: (nDOF %d)", lChi2, fCurrRecDataID, nDoF); // A.R. comment
-    // fRecord->Print();                                                                                // A.R. comment
+    LOGF(debug, "MillePede2 - reject chi2 %+e record %5ld: (nDOF %d)", lChi2, recID, nDoF); // A.R. comment
+    // record.Print();                                                                     // A.R. comment
     return 0;
   }
 
   if (fLocFitAdd) {
-    fNLocFits++;
-    fNLocEquations += nEq;
+    buf.nLocFits++;
+    buf.nLocEquations += nEq;
   } else {
-    fNLocFits--;
-    fNLocEquations -= nEq;
+    buf.nLocFits--;
+    buf.nLocEquations -= nEq;
   }
 
   //  local operations are finished, track is accepted
@@ -730,16 +731,16 @@ int MillePede2::LocalFit(std::vector<double>& localParams)
   int nGloInFit = 0;
 
   for (int ip = nPoints; ip--;) { // Update matrices
-    double resid = fRecord->GetValue(refLoc[ip] - 1);
-    double weight = fRecord->GetValue(refGlo[ip] - 1) * gloWgh;
+    double resid = record.GetValue(refLoc[ip] - 1);
+    double weight = record.GetValue(refGlo[ip] - 1) * gloWgh;
     int odd = (ip & 0x1);
     if (fWghScl[odd] > 0) {
       weight *= fWghScl[odd];
     }
-    double* derLoc = fRecord->GetValue() + refLoc[ip];
-    double* derGlo = fRecord->GetValue() + refGlo[ip];
-    int* indLoc = fRecord->GetIndex() + refLoc[ip];
-    int* indGlo = fRecord->GetIndex() + refGlo[ip];
+    double* derLoc = record.GetValue() + refLoc[ip];
+    double* derGlo = record.GetValue() + refGlo[ip];
+    int* indLoc = record.GetIndex() + refLoc[ip];
+    int* indGlo = record.GetIndex() + refGlo[ip];
 
     for (int i = nrefGlo[ip]; i--;) { // suppress the global part
       int iID = indGlo[i];            // Global param indice
@@ -758,11 +759,9 @@ int MillePede2::LocalFit(std::vector<double>& localParams)
       if (iIDg < 0 || fSigmaPar[iIDg] <= 0.) {
         continue;
       } // fixed parameter RRRCheck
-      if (fLocFitAdd) {
-        fVecBGlo[iIDg] += weight * resid * derGlo[ig];
-      } else {
-        fVecBGlo[iIDg] -= weight * resid * derGlo[ig];
-      }
+      vl = weight * resid * derGlo[ig];
+      buf.indexVecBGlo.push_back(iIDg);
+      buf.valueVecBGlo.push_back(fLocFitAdd ? vl : -vl);
 
       // First of all, the global/global terms (exactly like local matrix)
       int nfill = 0;
@@ -772,39 +771,39 @@ int MillePede2::LocalFit(std::vector<double>& localParams)
           continue;
         } // fixed parameter RRRCheck
         if (!IsZero(vl = weight * derGlo[ig] * derGlo[jg])) {
-          fFillIndex[nfill] = jIDg;
-          fFillValue[nfill++] = fLocFitAdd ? vl : -vl;
+          buf.fillIndex.push_back(jIDg);
+          buf.fillValue.push_back(fLocFitAdd ? vl : -vl);
+          nfill++;
         }
       }
       if (nfill) {
-        matCGlo.AddToRow(iIDg, fFillValue.data(), fFillIndex.data(), nfill);
+        buf.rowMatCGlo.push_back(iIDg);
+        buf.nFillMatCGlo.push_back(nfill);
       }
 
       // Now we have also rectangular matrices containing global/local terms.
-      int iCIDg = fGlo2CGlo[iIDg]; // compressed Index of index
+      int iCIDg = buf.glo2CGlo[iIDg]; // compressed Index of index
       if (iCIDg == -1) {
         double* rowGL = matCGloLoc(nGloInFit);
         for (int k = maxLocUsed; k--;) {
           rowGL[k] = 0.0;
         } // reset the row
-        iCIDg = fGlo2CGlo[iIDg] = nGloInFit;
-        fCGlo2Glo[nGloInFit++] = iIDg;
+        iCIDg = buf.glo2CGlo[iIDg] = nGloInFit;
+        buf.cGlo2Glo[nGloInFit++] = iIDg;
       }
 
       double* rowGLIDg = matCGloLoc(iCIDg);
       for (int il = nrefLoc[ip]; il--;) {
         rowGLIDg[indLoc[il]] += weight * derGlo[ig] * derLoc[il];
       }
-      fProcPnt[iIDg] += fLocFitAdd ? 1 : -1; // update counter
+      buf.procPnt.push_back(iIDg); // update counter
     }
   } // end of Update matrices
   //
   /*//RRR
   LOG(info) << "MillePede2 - After GLO";
-  printf("MatCLoc: "); fMatCLoc->Print("l");
-  printf("MatCGlo: "); fMatCGlo->Print("l");
-  printf("MatCGlLc:"); fMatCGloLoc->Print("l");
-  printf("BGlo: "); for (int i=0; i<fNGloPar; i++) printf("%+e |",fVecBGlo[i]); printf("\n");
+  printf("MatCLoc: "); matCLoc.Print("l");
+  printf("MatCGlLc:"); matCGloLoc.Print("l");
   */
   // calculate fMatCGlo -= fMatCGloLoc * fMatCLoc * fMatCGloLoc^T
   // and       fVecBGlo -= fMatCGloLoc * fVecBLoc
@@ -812,22 +811,23 @@ int MillePede2::LocalFit(std::vector<double>& localParams)
   //-------------------------------------------------------------- >>>
   double vll;
   for (int iCIDg = 0; iCIDg < nGloInFit; iCIDg++) {
-    int iIDg = fCGlo2Glo[iCIDg];
+    int iIDg = buf.cGlo2Glo[iCIDg];
 
     vl = 0;
     double* rowGLIDg = matCGloLoc(iCIDg);
     for (int kl = 0; kl < maxLocUsed; kl++) {
       if (rowGLIDg[kl]) {
-        vl += rowGLIDg[kl] * fVecBLoc[kl];
+        vl += rowGLIDg[kl] * vecBLoc[kl];
       }
     }
     if (!IsZero(vl)) {
-      fVecBGlo[iIDg] -= fLocFitAdd ? vl : -vl;
+      buf.indexVecBGlo.push_back(iIDg);
+      buf.valueVecBGlo.push_back(fLocFitAdd ? -vl : vl);
     }
 
     int nfill = 0;
     for (int jCIDg = 0; jCIDg <= iCIDg; jCIDg++) {
-      int jIDg = fCGlo2Glo[jCIDg];
+      int jIDg = buf.cGlo2Glo[jCIDg];
 
       vl = 0;
       double* rowGLJDg = matCGloLoc(jCIDg);
@@ -848,34 +848,127 @@ int MillePede2::LocalFit(std::vector<double>& localParams)
         }
       }
       if (!IsZero(vl)) {
-        fFillIndex[nfill] = jIDg;
-        fFillValue[nfill++] = fLocFitAdd ? -vl : vl;
+        buf.fillIndex.push_back(jIDg);
+        buf.fillValue.push_back(fLocFitAdd ? -vl : vl);
+        nfill++;
       }
     }
     if (nfill) {
-      matCGlo.AddToRow(iIDg, fFillValue.data(), fFillIndex.data(), nfill);
+      buf.rowMatCGlo.push_back(iIDg);
+      buf.nFillMatCGlo.push_back(nfill);
     }
   }
 
   // reset compressed index array
 
-  /*//RRR
-  LOG(info) << "MillePede2 - After GLOLoc";
-  printf("MatCGlo: "); fMatCGlo->Print("");
-  printf("BGlo: "); for (int i=0; i<fNGloPar; i++) printf("%+e |",fVecBGlo[i]); printf("\n");
-  */
   for (int i = nGloInFit; i--;) {
-    fGlo2CGlo[fCGlo2Glo[i]] = -1;
-    fCGlo2Glo[i] = -1;
+    buf.glo2CGlo[buf.cGlo2Glo[i]] = -1;
+    buf.cGlo2Glo[i] = -1;
   }
   //
   //---------------------------------------------------- <<<
-  if (GetCurrentIteration() == 1 && fTreeChi2) {
-    fTreeChi2->Fill();
+  if (storeChi2) {
+    buf.sumChi2.push_back(lChi2);
+    buf.isChi2BelowLimit.push_back(true);
+    buf.recNDoF.push_back(nDoF);
   }
   return 1;
 }
 
+//_____________________________________________________________________________
+void MillePede2::AddLocalFits(LocFitBuffer& buf)
+{
+  MatrixSq& matCGlo = *fMatCGlo;
+  for (size_t i = 0, ifill = 0; i < buf.rowMatCGlo.size(); i++) {
+    matCGlo.AddToRow(buf.rowMatCGlo[i], &buf.fillValue[ifill], &buf.fillIndex[ifill], buf.nFillMatCGlo[i]);
+    ifill += buf.nFillMatCGlo[i];
+  }
+  for (size_t i = 0; i < buf.indexVecBGlo.size(); i++) {
+    fVecBGlo[buf.indexVecBGlo[i]] += buf.valueVecBGlo[i];
+  }
+  for (auto iIDg : buf.procPnt) {
+    fProcPnt[iIDg] += fLocFitAdd ? 1 : -1;
+  }
+  for (size_t i = 0; i < buf.sumChi2.size(); i++) {
+    fSumChi2 = buf.sumChi2[i];
+    fIsChi2BelowLimit = buf.isChi2BelowLimit[i];
+    fRecNDoF = buf.recNDoF[i];
+    fTreeChi2->Fill();
+  }
+  fNLocFits += buf.nLocFits;
+  fNLocFitsRejected += buf.nLocFitsRejected;
+  fNLocEquations += buf.nLocEquations;
+  buf.Clear();
+}
+
+//_____________________________________________________________________________
+void MillePede2::ProcessDataRecords(const long first, const long nRec,
+                                    const std::function<bool(const MillePedeRecord&)>& select)
+{
+#ifdef WITH_OPENMP
+  const int nThreads = fgNThreads;
+#else
+  const int nThreads = 1;
+#endif
+  while (int(fLocFitBuf.size()) < nThreads) {
+    fLocFitBuf.push_back(std::make_unique<LocFitBuffer>(fNGloPar, fNLocPar));
+  }
+  const long printStep = std::max(long(0.2 * nRec), 1L);
+
+  if (nThreads < 2) {
+    for (long i = 0; i < nRec; i++) {
+      ReadRecordData(i + first);
+      if (!IsRecordAcceptable() || !fRecordReader->isReadEntryOk() || (select && !select(*fRecord))) {
+        continue;
+      }
+      std::vector<double> emptyLocalParams = {};
+      LocalFit(emptyLocalParams);
+      if (fLocFitAdd && (i % printStep) == 0) {
+        printf("%.1f%% of local fits done\n", double(100. * i) / nRec);
+      }
+    }
+    return;
+  }
+
+  // the records are read sequentially and fitted in parallel, each thread takes a contiguous block of records
+  // such that their contributions to the global system can be added in the order of the records
+  const long nRecChunk = long(nThreads) * kNRecPerThread;
+  std::vector<MillePedeRecord> records(nRecChunk);
+  std::vector<long> recIDs(nRecChunk);
+  std::vector<double> runWgh(nRecChunk);
+  long nextPrint = 0;
+  for (long i = 0; i < nRec;) {
+    long nSel = 0;
+    for (; i < nRec && nSel < nRecChunk; i++) {
+      ReadRecordData(i + first);
+      if (!IsRecordAcceptable() || !fRecordReader->isReadEntryOk() || (select && !select(*fRecord))) {
+        continue;
+      }
+      records[nSel] = *fRecord;
+      recIDs[nSel] = i + first;
+      runWgh[nSel++] = fRunWgh; // may change from run to run
+    }
+
+#ifdef WITH_OPENMP
+#pragma omp parallel for num_threads(nThreads) schedule(static, 1)
+#endif
+    for (int ith = 0; ith < nThreads; ith++) {
+      std::vector<double> emptyLocalParams = {};
+      for (long ir = nSel * ith / nThreads; ir < nSel * (ith + 1) / nThreads; ir++) {
+        LocalFit(records[ir], recIDs[ir], runWgh[ir], *fLocFitBuf[ith], emptyLocalParams);
+      }
+    }
+    for (int ith = 0; ith < nThreads; ith++) {
+      AddLocalFits(*fLocFitBuf[ith]);
+    }
+
+    if (fLocFitAdd && i >= nextPrint) {
+      printf("%.1f%% of local fits done\n", double(100. * i) / nRec);
+      nextPrint = (i / printStep + 1) * printStep;
+    }
+  }
+}
+
 //_____________________________________________________________________________
 int MillePede2::GlobalFit(std::vector<double>& par,
                           std::vector<double>& error,
@@ -1002,18 +1095,7 @@ int MillePede2::GlobalFitIteration()
   TStopwatch swt;
   swt.Start();
   fLocFitAdd = true; // add contributions of matching tracks
-  for (long i = 0; i < ndr; i++) {
-    long iev = i + first;
-    ReadRecordData(iev);
-    if (!IsRecordAcceptable() || !fRecordReader->isReadEntryOk()) {
-      continue;
-    }
-    std::vector<double> emptyLocalParams = {};
-    LocalFit(emptyLocalParams);
-    if ((i % int(0.2 * ndr)) == 0) {
-      printf("%.1f%% of local fits done\n", double(100. * i) / ndr);
-    }
-  }
+  ProcessDataRecords(first, ndr);
   swt.Stop();
   LOGF(info, "MillePede2 - %ld local fits done: ", ndr);
   /*
@@ -1104,23 +1186,15 @@ int MillePede2::GlobalFitIteration()
     // 2) loop over records and add contributions of fixed groups with negative sign
     fLocFitAdd = false;
 
-    for (long i = 0; i < ndr; i++) {
-      long iev = i + first;
-      ReadRecordData(iev);
-      if (!IsRecordAcceptable() || !fRecordReader->isReadEntryOk()) {
-        continue;
-      }
+    ProcessDataRecords(first, ndr, [&fixGroups, nFixedGroups](const MillePedeRecord& record) {
       bool suppr = false;
       for (int ifx = nFixedGroups; ifx--;) {
-        if (fRecord->IsGroupPresent(fixGroups[ifx])) {
+        if (record.IsGroupPresent(fixGroups[ifx])) {
           suppr = true;
         }
       }
-      if (suppr) {
-        std::vector<double> emptyLocalParams = {};
-        LocalFit(emptyLocalParams);
-      }
-    }
+      return suppr;
+    });
     fLocFitAdd = true;
 
     if (nFixedGroups) {
@@ -1425,6 +1499,13 @@ int MillePede2::SolveGlobalMatEq()
   return kNoInversion;
 }
 
+//_____________________________________________________________________________
+void MillePede2::SetNThreads(const int n)
+{
+  fgNThreads = n > 0 ? n : 1;
+  SymMatrix::SetNThreads(fgNThreads); // dense global matrix solution and MINRES/FGMRES products
+}
+
 //_____________________________________________________________________________
 Float_t MillePede2::Chi2DoFLim(int nSig, int nDoF) const
 {
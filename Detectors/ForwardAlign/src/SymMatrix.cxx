@@ -12,6 +12,7 @@
 /// @file SymMatrix.cxx
 
 #include <iostream>
+#include <vector>
 
 #include <TClass.h>
 #include <TMath.h>
@@ -22,8 +23,9 @@ using namespace o2::fwdalign;
 
 ClassImp(SymMatrix);
 
-SymMatrix* SymMatrix::fgBuffer = nullptr;
-Int_t SymMatrix::fgCopyCnt = 0;
+thread_local SymMatrix* SymMatrix::fgBuffer = nullptr;
+std::atomic<Int_t> SymMatrix::fgCopyCnt{0};
+Int_t SymMatrix::fgNThreads = 1;
 
 //___________________________________________________________
 SymMatrix::SymMatrix()
@@ -218,9 +220,13 @@ void SymMatrix::Print(Option_t* option) const
 //___________________________________________________________
 void SymMatrix::MultiplyByVec(const Double_t* vecIn, Double_t* vecOut) const
 {
-  for (int i = GetSizeUsed(); i--;) {
+  const int sz = GetSizeUsed();
+#ifdef WITH_OPENMP
+#pragma omp parallel for num_threads(fgNThreads) schedule(static) if (IsMultiThreaded())
+#endif
+  for (int i = sz - 1; i >= 0; i--) {
     vecOut[i] = 0.0;
-    for (int j = GetSizeUsed(); j--;) {
+    for (int j = sz; j--;) {
       vecOut[i] += vecIn[j] * GetEl(i, j);
     }
   }
@@ -265,28 +271,38 @@ SymMatrix* SymMatrix::DecomposeChol()
   }
 
   SymMatrix& mchol = *fgBuffer;
+  const int sz = GetSizeUsed();
+  const bool mt = IsMultiThreaded();
 
-  for (int i = 0; i < GetSizeUsed(); i++) {
+  for (int i = 0; i < sz; i++) {
     Double_t* rowi = mchol.GetRow(i);
-    for (int j = i; j < GetSizeUsed(); j++) {
+    double sum = rowi[i];
+    for (int k = i - 1; k >= 0; k--) {
+      if (rowi[k]) {
+        sum -= rowi[k] * rowi[k];
+      }
+    }
+    if (sum <= 0.0) { // not positive-definite
+      LOG(debug) << "The matrix is not positive definite [" << sum
+                 << "]: Choleski decomposition is not possible";
+      // Print("l");
+      return nullptr;
+    }
+    rowi[i] = TMath::Sqrt(sum);
+
+    // once the diagonal element is known, the rest of the column can be computed in parallel
+#ifdef WITH_OPENMP
+#pragma omp parallel for num_threads(fgNThreads) schedule(static) if (mt)
+#endif
+    for (int j = i + 1; j < sz; j++) {
       Double_t* rowj = mchol.GetRow(j);
-      double sum = rowj[i];
+      double sumj = rowj[i];
       for (int k = i - 1; k >= 0; k--) {
         if (rowi[k] && rowj[k]) {
-          sum -= rowi[k] * rowj[k];
-        }
-      }
-      if (i == j) {
-        if (sum <= 0.0) { // not positive-definite
-          LOG(debug) << "The matrix is not positive definite [" << sum
-                     << "]: Choleski decomposition is not possible";
-          // Print("l");
-          return nullptr;
+          sumj -= rowi[k] * rowj[k];
         }
-        rowi[i] = TMath::Sqrt(sum);
-      } else {
-        rowj[i] = sum / rowi[i];
       }
+      rowj[i] = sumj / rowi[i];
     }
   }
   return fgBuffer;
@@ -308,15 +324,21 @@ Bool_t SymMatrix::InvertChol()
 //___________________________________________________________
 void SymMatrix::InvertChol(SymMatrix* pmchol)
 {
-  Double_t sum;
   SymMatrix& mchol = *pmchol;
-
-  // Invert decomposed triangular L matrix (Lower triangle is filled)
-  for (int i = 0; i < GetSizeUsed(); i++) {
-    mchol(i, i) = 1.0 / mchol(i, i);
-    for (int j = i + 1; j < GetSizeUsed(); j++) {
-      Double_t* rowj = mchol.GetRow(j);
-      sum = 0.0;
+  const int sz = GetSizeUsed();
+  const bool mt = IsMultiThreaded();
+
+  // Invert decomposed triangular L matrix (Lower triangle is filled).
+  // This is done row by row: the elements of the row j of the inverse depend only on the
+  // already inverted rows above it and on the row j of L, so they can be computed in parallel
+  std::vector<double> rowInv(sz);
+  for (int j = 0; j < sz; j++) {
+    Double_t* rowj = mchol.GetRow(j);
+#ifdef WITH_OPENMP
+#pragma omp parallel for num_threads(fgNThreads) schedule(static) if (mt)
+#endif
+    for (int i = 0; i < j; i++) {
+      double sum = 0.0;
       for (int k = i; k < j; k++) {
         if (rowj[k]) {
           double& mki = mchol(k, i);
@@ -325,15 +347,22 @@ void SymMatrix::InvertChol(SymMatrix* pmchol)
           }
         }
       }
-      rowj[i] = sum / rowj[j];
+      rowInv[i] = sum / rowj[j];
     }
+    for (int i = 0; i < j; i++) {
+      rowj[i] = rowInv[i];
+    }
+    rowj[j] = 1.0 / rowj[j];
   }
 
   // take product of the inverted Choleski L matrix with its transposed
-  for (int i = GetSizeUsed(); i--;) {
+#ifdef WITH_OPENMP
+#pragma omp parallel for num_threads(fgNThreads) schedule(dynamic) if (mt)
+#endif
+  for (int i = sz - 1; i >= 0; i--) {
     for (int j = i + 1; j--;) {
-      sum = 0;
-      for (int k = i; k < GetSizeUsed(); k++) {
+      double sum = 0;
+      for (int k = i; k < sz; k++) {
         double& mik = mchol(i, k);
         if (mik) {
           double& mjk = mchol(j, k);
@@ -556,6 +585,7 @@ int SymMatrix::SolveSpmInv(double* vecB, Bool_t stabilize)
   double vPivot = 0.;
   double eps = 1e-14;
   int nGlo = GetSizeUsed();
+  const bool mt = IsMultiThreaded();
   bool* bUnUsed = new bool[nGlo];
   double *rowMax, *colMax = nullptr;
   rowMax = new double[nGlo];
@@ -647,11 +677,16 @@ int SymMatrix::SolveSpmInv(double* vecB, Bool_t stabilize)
       vPivot = 1.0 / vPivot;
       DiagElem(iPivot) = -vPivot; // Replace pivot by its inverse
       //
+      // each element is updated using only the pivot row and column, which are not modified here
+      SymMatrix& upper = *fgBuffer; // fgBuffer is thread-local
+#ifdef WITH_OPENMP
+#pragma omp parallel for num_threads(fgNThreads) schedule(static) if (mt)
+#endif
       for (Int_t j = 0; j < nGlo; j++) {
         for (Int_t jj = 0; jj < nGlo; jj++) {
           if (j != iPivot && jj != iPivot) { // Other elements (!!! do them first as you use old matV[k][j]'s !!!)
-            double& r = j >= jj ? (*this)(j, jj) : (*fgBuffer)(jj, j);
-            r -= vPivot * (j > iPivot ? Query(j, iPivot) : fgBuffer->Query(iPivot, j)) * (iPivot > jj ? Query(iPivot, jj) : fgBuffer->Query(jj, iPivot));
+            double& r = j >= jj ? (*this)(j, jj) : upper(jj, j);
+            r -= vPivot * (j > iPivot ? Query(j, iPivot) : upper.Query(iPivot, j)) * (iPivot > jj ? Query(iPivot, jj) : upper.Query(jj, iPivot));
           }
         }
       }
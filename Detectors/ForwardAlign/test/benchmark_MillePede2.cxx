@@ -0,0 +1,131 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <random>
+#include <thread>
+#include <vector>
+#include <TChain.h>
+#include "ForwardAlign/MillePede2.h"
+#include "ForwardAlign/MillePedeRecord.h"
+#include "ForwardAlign/MilleRecordReader.h"
+#include "ForwardAlign/MilleRecordWriter.h"
+
+using namespace o2::fwdalign;
+
+// telescope of NLayers planes of NSensors sensors with NDofSensor global parameters (dx, dy, dz, dphi) each,
+// crossed by straight tracks with NLoc local parameters (x, y, tx, ty) measured in x and y in every plane
+constexpr int NLayers = 10, NSensors = 50, NDofSensor = 4, NLoc = 4;
+constexpr int NGlo = NLayers * NSensors * NDofSensor;
+constexpr int NRecords = 50000;
+constexpr double Sigma = 5.e-4, DZ = 5.;
+constexpr const char* RecordsFileName = "benchmark_millerecords.root";
+
+// synthetic Mille records of misaligned sensors
+static void writeRecords()
+{
+  MilleRecordWriter writer;
+  writer.setDataFileName(RecordsFileName);
+  writer.init();
+  MillePedeRecord* record = writer.getRecord();
+  std::mt19937 generator(1);
+  std::normal_distribution<double> gaus(0., 1.);
+  std::uniform_int_distribution<int> sensor(0, NSensors - 1);
+  std::vector<double> misalignment(NGlo);
+  for (auto& m : misalignment) {
+    m = 2.e-4 * gaus(generator);
+  }
+  for (int iTrack = 0; iTrack < NRecords; iTrack++) {
+    const double track[NLoc] = {gaus(generator), gaus(generator), 0.1 * gaus(generator), 0.1 * gaus(generator)};
+    for (int iLayer = 0; iLayer < NLayers; iLayer++) {
+      const double z = iLayer * DZ;
+      const double x = track[0] + track[2] * z, y = track[1] + track[3] * z;
+      const int firstPar = (iLayer * NSensors + sensor(generator)) * NDofSensor;
+      const double derLoc[2][NLoc] = {{1., 0., z, 0.}, {0., 1., 0., z}};
+      const double derGlo[2][NDofSensor] = {{-1., 0., track[2], y}, {0., -1., track[3], -x}};
+      for (int xy = 0; xy < 2; xy++) {
+        double resid = Sigma * gaus(generator);
+        for (int i = 0; i < NDofSensor; i++) {
+          resid += derGlo[xy][i] * misalignment[firstPar + i];
+        }
+        record->AddResidual(resid);
+        for (int i = 0; i < NLoc; i++) {
+          if (derLoc[xy][i] != 0.) {
+            record->AddIndexValue(i, derLoc[xy][i]);
+          }
+        }
+        record->AddWeight(1. / (Sigma * Sigma));
+        for (int i = 0; i < NDofSensor; i++) {
+          record->AddIndexValue(firstPar + i, derGlo[xy][i]);
+        }
+      }
+    }
+    writer.fillRecordTree();
+  }
+  writer.terminate();
+}
+
+// one iteration of the global fit: local fits of all the records and solution of the global system
+static std::vector<double> globalFitIteration(bool sparse, int nThreads)
+{
+  static bool recordsWritten = false;
+  if (!recordsWritten) {
+    writeRecords();
+    recordsWritten = true;
+  }
+  TChain chain("o2sim");
+  chain.AddFile(RecordsFileName);
+  MilleRecordReader reader;
+  reader.connectToChain(&chain);
+
+  MillePede2::SetGlobalMatSparse(sparse);
+  MillePede2::SetNThreads(nThreads);
+  MillePede2 millepede;
+  millepede.SetRecordReader(&reader);
+  millepede.InitMille(NGlo, NLoc);
+  for (int i = 0; i < NGlo; i++) {
+    millepede.SetSigmaPar(i, 1.);
+  }
+  millepede.SetIterations(1.);
+  millepede.GlobalFitIteration();
+  return millepede.GetGlobals();
+}
+
+static void BM_GlobalFitIteration(benchmark::State& state)
+{
+  // reference solution from a single thread for each type of the global matrix
+  static std::map<bool, std::vector<double>> reference;
+  const bool sparse = state.range(0);
+  const int nThreads = state.range(1) ? state.range(1) : std::thread::hardware_concurrency();
+  if (!reference.count(sparse)) {
+    reference[sparse] = globalFitIteration(sparse, 1);
+  }
+  double maxDiff = 0;
+  for (auto _ : state) {
+    const auto globals = globalFitIteration(sparse, nThreads);
+    for (int i = 0; i < NGlo; i++) {
+      maxDiff = std::max(maxDiff, std::abs(globals[i] - reference[sparse][i]));
+    }
+  }
+  state.counters["records"] = benchmark::Counter(state.iterations() * NRecords, benchmark::Counter::kIsRate);
+  state.counters["threads"] = nThreads;
+  state.counters["maxDiff"] = maxDiff;
+  MillePede2::SetGlobalMatSparse(false);
+  MillePede2::SetNThreads(1);
+}
+
+// arguments: sparse global matrix solved by MINRES (1) or dense one solved by Cholesky (0), number of threads (0: all cores)
+BENCHMARK(BM_GlobalFitIteration)->Args({0, 1})->Args({0, 4})->Args({0, 0})->Args({1, 1})->Args({1, 4})->Args({1, 0})->Unit(benchmark::kSecond)->Iterations(1);
+
+BENCHMARK_MAIN();
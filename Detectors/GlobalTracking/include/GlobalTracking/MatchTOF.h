@@ -195,6 +195,13 @@ class MatchTOF
   static void groupingMatch(const std::vector<o2::dataformats::MatchInfoTOFReco>& origin, std::vector<std::vector<o2::dataformats::MatchInfoTOFReco>>& grouped, std::vector<std::vector<int>>& firstEls, std::vector<std::vector<int>>& secondEls);
   static void printGrouping(const std::vector<o2::dataformats::MatchInfoTOFReco>& origin, const std::vector<std::vector<o2::dataformats::MatchInfoTOFReco>>& grouped);
 
+  ///< index per strip the TOF clusters of a sector, given by their indices in clusters and ordered in time (CSR layout, see mTOFClusStripIndex)
+  static void fillStripIndex(const std::vector<Cluster>& clusters, const std::vector<int>& sectorCache, std::array<int, Geo::NSTRIPXSECTOR + 1>& stripFirst, std::vector<int>& stripIndex);
+  ///< positions in sectorCache of the TOF clusters in the given strips with position in [posMin, posMax) and time in [minTime, maxTime],
+  ///< looked up in the strip index of the sector; they are returned in increasing order, i.e. ordered in time
+  static void getClustersInStrips(const std::vector<Cluster>& clusters, const std::vector<int>& sectorCache, const std::array<int, Geo::NSTRIPXSECTOR + 1>& stripFirst, const std::vector<int>& stripIndex,
+                                  const int* strips, int nStrips, int posMin, int posMax, double minTime, double maxTime, std::vector<int>& positions);
+
   void storeMatchable(bool val = true) { mStoreMatchable = val; }
 
   void setNlanes(int lanes) { mNlanes = lanes; }
@@ -213,6 +220,17 @@ class MatchTOF
   //  void addITSTPCTRDSeed(const o2::track::TrackParCov& _tr, o2::dataformats::GlobalTrackID srcGID, int tpcID);
   bool prepareTOFClusters();
 
+  ///< propagation of a track through the TOF strips (at maximum 2 strips can be crossed)
+  struct TrackInStrips {
+    int nStrips = 0;                                                ///< number of strips crossed in the propagation
+    int detId[2][5] = {{-1, -1, -1, -1, -1}, {-1, -1, -1, -1, -1}}; ///< TOF det index of the crossed strips
+    float deltaPos[2][3] = {};                                      ///< residuals in the crossed strips
+    o2::track::TrackLTIntegral trkLTInt[2];                         ///< integrated track length and time for the crossed strips
+    int nStepsInsideSameStrip[2] = {0, 0};                          ///< number of propagation steps in the crossed strips
+    float zShift[2] = {0.f, 0.f};                                   ///< z shift of the TPC track for the BC candidate in the crossed strips
+  };
+
+  void getClustersInStrips(int sec, const int* strips, int nStrips, int posMin, int posMax, double minTime, double maxTime, std::vector<int>& positions) const;
   void doMatching(int sec);
   void doMatchingForTPC(int sec);
   void selectBestMatches(int sec);
@@ -320,6 +338,11 @@ class MatchTOF
   ///< per sector indices of TOF cluster entry in mTOFClusWork
   std::array<std::vector<int>, o2::constants::math::NSectors> mTOFClusSectIndexCache;
 
+  ///< per sector and strip positions in mTOFClusSectIndexCache of the TOF clusters (CSR layout: the clusters of strip i are
+  ///< mTOFClusStripIndex[sec][mTOFClusStripFirst[sec][i] ... mTOFClusStripFirst[sec][i + 1] - 1], ordered in time)
+  std::array<std::array<int, Geo::NSTRIPXSECTOR + 1>, o2::constants::math::NSectors> mTOFClusStripFirst;
+  std::array<std::vector<int>, o2::constants::math::NSectors> mTOFClusStripIndex;
+
   ///< array of track-TOFCluster pairs from the matching
   std::vector<o2::dataformats::MatchInfoTOFReco> mMatchedTracksPairsSec[o2::constants::math::NSectors];
 
@@ -350,7 +373,10 @@ class MatchTOF
   TStopwatch mTimerMatchITSTPC;
   TStopwatch mTimerMatchTPC;
   TStopwatch mTimerDBG;
-  ClassDefNV(MatchTOF, 6);
+  TStopwatch mTimerPropagation;   ///< propagation of the tracks through the TOF strips
+  TStopwatch mTimerClusterSearch; ///< search of the TOF clusters compatible with the propagated tracks
+  TStopwatch mTimerSelection;     ///< selection of the best matches
+  ClassDefNV(MatchTOF, 7);
 };
 } // namespace globaltracking
 } // namespace o2
@@ -194,6 +194,14 @@ struct MatchRecord {
   }
 };
 
+///< TPC-ITS pair accepted by the sector matching, to be registered in the MatchRecords
+struct MatchCandidate {
+  int iITS = MinusOne;      ///< entry of the ITS track in mITSWork
+  int iTPC = MinusOne;      ///< entry of the TPC track in mTPCWork
+  float chi2 = -1.f;        ///< matching chi2
+  int matchedIC = MinusOne; ///< index of eventually matched InteractionCandidate
+};
+
 ///< Link of the AfterBurner track: update at sertain cluster
 ///< original track in the currently loaded TPC reco output
 struct ABTrackLink : public o2::track::TrackParCov {
@@ -371,7 +379,7 @@ class MatchTPCITS
                       pmr::vector<o2::itsmft::TrkClusRef>& ABTrackletRefs, pmr::vector<o2::dataformats::Triplet<float, float, float>>& calib);
   void refitABWinners(pmr::vector<o2::dataformats::TrackTPCITS>& matchedTracks, pmr::vector<o2::MCCompLabel>& matchLabels, pmr::vector<o2::MCCompLabel>& ABTrackletLabels, pmr::vector<int>& ABTrackletClusterIDs,
                       pmr::vector<o2::itsmft::TrkClusRef>& ABTrackletRefs, pmr::vector<o2::dataformats::Triplet<float, float, float>>& calib);
-  bool refitABTrack(int iITSAB, const TPCABSeed& seed, pmr::vector<o2::dataformats::TrackTPCITS>& matchedTracks, pmr::vector<int>& ABTrackletClusterIDs, pmr::vector<o2::itsmft::TrkClusRef>& ABTrackletRefs);
+  bool refitABTrack(int iITSAB, const TPCABSeed& seed, o2::dataformats::TrackTPCITS& newtr, const pmr::vector<int>& ABTrackletClusterIDs, const pmr::vector<o2::itsmft::TrkClusRef>& ABTrackletRefs);
 #endif // CLING
   void setSkipTPCOnly(bool v)
   {
@@ -500,6 +508,7 @@ class MatchTPCITS
   void flagUsedITSClusters(const o2::its::TrackITS& track);
 
   void doMatching(int sec);
+  void registerMatchCandidates();
 
   bool refitTPCInward(o2::track::TrackParCov& trcIn, float& chi2, float xTgt, int trcID, float timeTB) const;
 
@@ -529,7 +538,7 @@ class MatchTPCITS
   int getNMatchRecordsITS(const TrackLocITS& tITS) const;
 
   ///< convert time bracket to IR bracket
-  BracketIR tBracket2IRBracket(const BracketF tbrange);
+  BracketIR tBracket2IRBracket(const BracketF tbrange) const;
 
   ///< convert time to ITS ROFrame units in case of continuous ITS readout
   int time2ITSROFrameCont(float t) const
@@ -723,6 +732,10 @@ class MatchTPCITS
   std::array<std::vector<int>, o2::constants::math::NSectors> mTPCTimeStart;
   ///< indices of 1st entries of ITS tracks starting at given ROframe
   std::array<std::vector<int>, o2::constants::math::NSectors> mITSTimeStart;
+  ///< per sector tgl of cached ITS tracks (ordered as mITSSectIndexCache), for the tgl window search within ROframe
+  std::array<std::vector<float>, o2::constants::math::NSectors> mITSSectTgl;
+  ///< per sector TPC-ITS pairs accepted by doMatching, registered in the sector order
+  std::array<std::vector<MatchCandidate>, o2::constants::math::NSectors> mSectMatchCandidates;
 
   /// mapping for tracks' continuos ROF cycle to actual continuous readout ROFs with eventual gaps
   std::vector<int> mITSTrackROFContMapping;
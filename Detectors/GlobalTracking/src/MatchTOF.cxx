@@ -10,6 +10,8 @@
 // or submit itself to any jurisdiction.
 #include <TTree.h>
 #include <cassert>
+#include <algorithm>
+#include <limits>
 
 #include <fairlogger/Logger.h>
 #include "Field/MagneticField.h"
@@ -81,6 +83,9 @@ void MatchTOF::run(const o2::globaltracking::RecoContainer& inp, unsigned long f
   mTimerMatchTPC.Reset();
   mTimerMatchITSTPC.Reset();
   mTimerTot.Reset();
+  mTimerPropagation.Reset();
+  mTimerClusterSearch.Reset();
+  mTimerSelection.Reset();
 
   mCalibInfoTOF.clear();
 
@@ -143,9 +148,6 @@ void MatchTOF::run(const o2::globaltracking::RecoContainer& inp, unsigned long f
   o2::tof::Geo::Init();
 
   if (mIsITSTPCused || mIsTPCTRDused || mIsITSTPCTRDused) {
-#ifdef WITH_OPENMP
-#pragma omp parallel for schedule(dynamic) num_threads(mNlanes)
-#endif
     for (int sec = o2::constants::math::NSectors - 1; sec > -1; sec--) {
       doMatching(sec);
     }
@@ -154,9 +156,6 @@ void MatchTOF::run(const o2::globaltracking::RecoContainer& inp, unsigned long f
 
   mTimerMatchTPC.Start();
   if (mIsTPCused) {
-#ifdef WITH_OPENMP
-#pragma omp parallel for schedule(dynamic) num_threads(mNlanes)
-#endif
     for (int sec = o2::constants::math::NSectors - 1; sec > -1; sec--) {
       doMatchingForTPC(sec);
     }
@@ -164,6 +163,7 @@ void MatchTOF::run(const o2::globaltracking::RecoContainer& inp, unsigned long f
   mTimerMatchTPC.Stop();
 
   // finalize
+  mTimerSelection.Start();
   for (int sec = o2::constants::math::NSectors - 1; sec > -1; sec--) {
     if (mStoreMatchable) {
       // if MC check if good or fake matches
@@ -231,6 +231,7 @@ void MatchTOF::run(const o2::globaltracking::RecoContainer& inp, unsigned long f
   for (int sec = o2::constants::math::NSectors - 1; sec > -1; sec--) {
     nMatchesStr += fmt::format("{} : {} ; ", sec, nMatches[sec]);
   }
+  mTimerSelection.Stop();
   LOG(info) << nMatchesStr;
   // re-arrange outputs from constrained/unconstrained to the 4 cases (TPC, ITS-TPC, TPC-TRD, ITS-TPC-TRD) to be implemented as soon as TPC-TRD and ITS-TPC-TRD tracks available
 
@@ -243,6 +244,9 @@ void MatchTOF::run(const o2::globaltracking::RecoContainer& inp, unsigned long f
   LOGF(info, "Timing Do Matching:             Cpu: %.3e s Real: %.3e s in %d slots", mTimerTot.CpuTime(), mTimerTot.RealTime(), mTimerTot.Counter() - 1);
   LOGF(info, "Timing Do Matching Constrained: Cpu: %.3e s Real: %.3e s in %d slots", mTimerMatchITSTPC.CpuTime(), mTimerMatchITSTPC.RealTime(), mTimerMatchITSTPC.Counter() - 1);
   LOGF(info, "Timing Do Matching TPC        : Cpu: %.3e s Real: %.3e s in %d slots", mTimerMatchTPC.CpuTime(), mTimerMatchTPC.RealTime(), mTimerMatchTPC.Counter() - 1);
+  LOGF(info, "Timing Track Propagation      : Cpu: %.3e s Real: %.3e s in %d slots", mTimerPropagation.CpuTime(), mTimerPropagation.RealTime(), mTimerPropagation.Counter() - 1);
+  LOGF(info, "Timing TOF Cluster Search     : Cpu: %.3e s Real: %.3e s in %d slots", mTimerClusterSearch.CpuTime(), mTimerClusterSearch.RealTime(), mTimerClusterSearch.Counter() - 1);
+  LOGF(info, "Timing Best Matches Selection : Cpu: %.3e s Real: %.3e s in %d slots", mTimerSelection.CpuTime(), mTimerSelection.RealTime(), mTimerSelection.Counter() - 1);
 }
 
 //______________________________________________
@@ -800,6 +804,11 @@ bool MatchTOF::prepareTOFClusters()
     });
   } // loop over TOF clusters of single sector
 
+  // index the clusters of each sector per strip, within a strip they stay ordered in time
+  for (int sec = o2::constants::math::NSectors - 1; sec > -1; sec--) {
+    fillStripIndex(mTOFClusWork, mTOFClusSectIndexCache[sec], mTOFClusStripFirst[sec], mTOFClusStripIndex[sec]);
+  }
+
   if (mMatchedClustersIndex) {
     delete[] mMatchedClustersIndex;
   }
@@ -809,6 +818,63 @@ bool MatchTOF::prepareTOFClusters()
   return true;
 }
 //______________________________________________
+void MatchTOF::fillStripIndex(const std::vector<Cluster>& clusters, const std::vector<int>& sectorCache, std::array<int, Geo::NSTRIPXSECTOR + 1>& stripFirst, std::vector<int>& stripIndex)
+{
+  std::vector<int> clusStrip(sectorCache.size());
+  stripFirst.fill(0);
+  for (int pos = 0; pos < sectorCache.size(); pos++) {
+    int indices[5];
+    Geo::getVolumeIndices(clusters[sectorCache[pos]].getMainContributingChannel(), indices);
+    clusStrip[pos] = Geo::getStripNumberPerSM(indices[1], indices[2]);
+    if (clusStrip[pos] >= 0) {
+      stripFirst[clusStrip[pos] + 1]++;
+    }
+  }
+  for (int strip = 0; strip < Geo::NSTRIPXSECTOR; strip++) {
+    stripFirst[strip + 1] += stripFirst[strip];
+  }
+  stripIndex.resize(stripFirst[Geo::NSTRIPXSECTOR]);
+  std::array<int, Geo::NSTRIPXSECTOR> fill;
+  std::copy(stripFirst.begin(), stripFirst.end() - 1, fill.begin());
+  for (int pos = 0; pos < sectorCache.size(); pos++) {
+    if (clusStrip[pos] >= 0) {
+      stripIndex[fill[clusStrip[pos]]++] = pos;
+    }
+  }
+}
+//______________________________________________
+void MatchTOF::getClustersInStrips(const std::vector<Cluster>& clusters, const std::vector<int>& sectorCache, const std::array<int, Geo::NSTRIPXSECTOR + 1>& stripFirst, const std::vector<int>& stripIndex,
+                                   const int* strips, int nStrips, int posMin, int posMax, double minTime, double maxTime, std::vector<int>& positions)
+{
+  positions.clear();
+  for (int is = 0; is < nStrips; is++) {
+    if (strips[is] < 0 || (is > 0 && strips[is] == strips[0])) {
+      continue;
+    }
+    auto first = stripIndex.begin() + stripFirst[strips[is]];
+    auto last = stripIndex.begin() + stripFirst[strips[is] + 1];
+    first = std::lower_bound(first, last, posMin);
+    first = std::partition_point(first, last, [&](int pos) { return clusters[sectorCache[pos]].getTime() < minTime; });
+    size_t nPrev = positions.size();
+    for (; first != last && *first < posMax; ++first) {
+      if (clusters[sectorCache[*first]].getTime() > maxTime) {
+        break;
+      }
+      positions.push_back(*first);
+    }
+    if (nPrev) {
+      std::inplace_merge(positions.begin(), positions.begin() + nPrev, positions.end());
+    }
+  }
+}
+//______________________________________________
+void MatchTOF::getClustersInStrips(int sec, const int* strips, int nStrips, int posMin, int posMax, double minTime, double maxTime, std::vector<int>& positions) const
+{
+  ///< positions in mTOFClusSectIndexCache[sec] of the TOF clusters in the given strips with position in [posMin, posMax)
+  ///< and time in [minTime, maxTime]; they are returned in increasing order, i.e. ordered in time
+  getClustersInStrips(mTOFClusWork, mTOFClusSectIndexCache[sec], mTOFClusStripFirst[sec], mTOFClusStripIndex[sec], strips, nStrips, posMin, posMax, minTime, maxTime, positions);
+}
+//______________________________________________
 void MatchTOF::doMatching(int sec)
 {
   trkType type = trkType::CONSTR;
@@ -821,20 +887,34 @@ void MatchTOF::doMatching(int sec)
   if (!nTracks || !nTOFCls) {
     return;
   }
-  int itof0 = 0;                          // starting index in TOF clusters for matching of the track
-  int detId[2][5];                        // at maximum one track can fall in 2 strips during the propagation; the second dimention of the array is the TOF det index
-  float deltaPos[2][3];                   // at maximum one track can fall in 2 strips during the propagation; the second dimention of the array is the residuals
-  o2::track::TrackLTIntegral trkLTInt[2]; // Here we store the integrated track length and time for the (max 2) matched strips
-  int nStepsInsideSameStrip[2] = {0, 0};  // number of propagation steps in the same strip (since we have maximum 2 strips, it has dimention = 2)
-  float deltaPosTemp[3];
-  std::array<float, 3> pos;
-  std::array<float, 3> posBeforeProp;
-  float posFloat[3];
 
   // prematching for TPC only tracks (identify BC candidate to correct z for TPC track accordingly to v_drift)
 
+  // the tracks are propagated and matched independently, the matches are collected per track and then merged in the track order
+  struct TrackToMatch {
+    TrackInStrips strips;
+    float pt;
+    float minTrkTime;
+    float maxTrkTime;
+    float resT;
+  };
+  std::vector<TrackToMatch> tracks(nTracks);
+  std::vector<std::vector<o2::dataformats::MatchInfoTOFReco>> matches(nTracks);
+
   LOG(debug) << "Trying to match %d tracks" << cacheTrk.size();
-  for (int itrk = 0; itrk < cacheTrk.size(); itrk++) {
+  mTimerPropagation.Start(false);
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNlanes)
+#endif
+  for (int itrk = 0; itrk < nTracks; itrk++) {
+    int detId[2][5];                        // at maximum one track can fall in 2 strips during the propagation; the second dimention of the array is the TOF det index
+    float deltaPos[2][3];                   // at maximum one track can fall in 2 strips during the propagation; the second dimention of the array is the residuals
+    o2::track::TrackLTIntegral trkLTInt[2]; // Here we store the integrated track length and time for the (max 2) matched strips
+    int nStepsInsideSameStrip[2] = {0, 0};  // number of propagation steps in the same strip (since we have maximum 2 strips, it has dimention = 2)
+    float deltaPosTemp[3];
+    std::array<float, 3> pos;
+    float posFloat[3];
+
     for (int ii = 0; ii < 2; ii++) {
       detId[ii][2] = -1; // before trying to match, we need to inizialize the detId corresponding to the strip number to -1; this is the array that we will use to save the det id of the maximum 2 strips matched
       nStepsInsideSameStrip[ii] = 0;
@@ -992,31 +1072,69 @@ void MatchTOF::doMatching(int sec)
       */
     }
 
+    auto& track = tracks[itrk];
+    track.pt = pt;
+    track.minTrkTime = minTrkTime;
+    track.maxTrkTime = maxTrkTime;
+    track.resT = resT;
+    track.strips.nStrips = nStripsCrossedInPropagation;
     for (Int_t imatch = 0; imatch < nStripsCrossedInPropagation; imatch++) {
       // we take as residual the average of the residuals along the propagation in the same strip
-      deltaPos[imatch][0] /= nStepsInsideSameStrip[imatch];
-      deltaPos[imatch][1] /= nStepsInsideSameStrip[imatch];
-      deltaPos[imatch][2] /= nStepsInsideSameStrip[imatch];
+      for (int ii = 0; ii < 3; ii++) {
+        track.strips.deltaPos[imatch][ii] = deltaPos[imatch][ii] / nStepsInsideSameStrip[imatch];
+      }
+      for (int ii = 0; ii < 5; ii++) {
+        track.strips.detId[imatch][ii] = detId[imatch][ii];
+      }
+      track.strips.trkLTInt[imatch] = trkLTInt[imatch];
     }
+  }
+  mTimerPropagation.Stop();
+
+  mTimerClusterSearch.Start(false);
+  // the clusters earlier than the time window of a track reaching a strip are not considered for the following tracks
+  // either (reminder: tracks and clusters are both ordered in time), therefore the time windows are bounded from below
+  // by the largest minimum time of the previous tracks reaching a strip
+  std::vector<float> minClusTime(nTracks);
+  float minClusTimeTrk = std::numeric_limits<float>::lowest();
+  for (int itrk = 0; itrk < nTracks; itrk++) {
+    if (tracks[itrk].strips.nStrips) {
+      minClusTimeTrk = std::max(minClusTimeTrk, tracks[itrk].minTrkTime);
+    }
+    minClusTime[itrk] = minClusTimeTrk;
+  }
 
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNlanes)
+#endif
+  for (int itrk = 0; itrk < nTracks; itrk++) {
+    auto& track = tracks[itrk];
+    int nStripsCrossedInPropagation = track.strips.nStrips;
     if (nStripsCrossedInPropagation == 0) {
       continue; // the track never hit a TOF strip during the propagation
     }
+    auto& trefTrk = mTracksWork[sec][type][cacheTrk[itrk]].first;
+    const auto& detId = track.strips.detId;
+    const auto& deltaPos = track.strips.deltaPos;
+    const auto& trkLTInt = track.strips.trkLTInt;
+    float pt = track.pt;
+    float minTrkTime = track.minTrkTime;
+    float maxTrkTime = track.maxTrkTime;
+    float resT = track.resT;
+    auto& trackMatches = matches[itrk];
+
+    // only the clusters in the crossed strips can be matched
+    int strips[2];
+    for (int imatch = 0; imatch < nStripsCrossedInPropagation; imatch++) {
+      strips[imatch] = Geo::getStripNumberPerSM(detId[imatch][1], detId[imatch][2]);
+    }
+    std::vector<int> clusters;
+    getClustersInStrips(sec, strips, nStripsCrossedInPropagation, 0, nTOFCls, minClusTime[itrk], maxTrkTime, clusters);
+
     bool foundCluster = false;
-    for (auto itof = itof0; itof < nTOFCls; itof++) {
+    for (auto itof : clusters) {
       //      printf("itof = %d\n", itof);
       auto& trefTOF = mTOFClusWork[cacheTOF[itof]];
-      // compare the times of the track and the TOF clusters - remember that they both are ordered in time!
-      //Printf("trefTOF.getTime() = %f, maxTrkTime = %f, minTrkTime = %f", trefTOF.getTime(), maxTrkTime, minTrkTime);
-
-      if (trefTOF.getTime() < minTrkTime) { // this cluster has a time that is too small for the current track, we will get to the next one
-        //Printf("In trefTOF.getTime() < minTrkTime");
-        itof0 = itof + 1; // but for the next track that we will check, we will ignore this cluster (the time is anyway too small)
-        continue;
-      }
-      if (trefTOF.getTime() > maxTrkTime) { // no more TOF clusters can be matched to this track
-        break;
-      }
 
       int mainChannel = trefTOF.getMainContributingChannel();
       int indices[5];
@@ -1059,9 +1177,6 @@ void MatchTOF::doMatching(int sec)
         posCorr[2] *= ndifInv;
       }
 
-      int trackIdTOF;
-      int eventIdTOF;
-      int sourceIdTOF;
       for (auto iPropagation = 0; iPropagation < nStripsCrossedInPropagation; iPropagation++) {
         int bct0 = int((mTOFClusWork[cacheTOF[itof]].getTime() - trkLTInt[iPropagation].getTOF(0) + 5000) * Geo::BC_TIME_INPS_INV); // bc taken assuming speed of light (el) and 5 ns of margin
         if (bct0 < 0) {                                                                                                             // if negative time (it can happen at the beginng of the TF int was truncated per excess... adjusting)
@@ -1126,17 +1241,22 @@ void MatchTOF::doMatching(int sec)
           foundCluster = true;
           // set event indexes (to be checked)
           int eventIndexTOFCluster = mTOFClusSectIndexCache[indices[0]][itof];
-          mMatchedTracksPairsSec[sec].emplace_back(cacheTrk[itrk], eventIndexTOFCluster, mTOFClusWork[cacheTOF[itof]].getTime(), chi2, trkLTInt[iPropagation], mTrackGid[sec][type][cacheTrk[itrk]], type, (trefTOF.getTime() - (minTrkTime + maxTrkTime - 100E3) * 0.5) * 1E-6, trefTOF.getZ(), resXor, resZor, resY); // subracting 100 ns to max track which was artificially added
-          mMatchedTracksPairsSec[sec][mMatchedTracksPairsSec[sec].size() - 1].setPt(pt);
-          mMatchedTracksPairsSec[sec][mMatchedTracksPairsSec[sec].size() - 1].setResX(sqrt(1. / errXinv2));
-          mMatchedTracksPairsSec[sec][mMatchedTracksPairsSec[sec].size() - 1].setResZ(sqrt(1. / errZinv2));
-          mMatchedTracksPairsSec[sec][mMatchedTracksPairsSec[sec].size() - 1].setResT(resT);
-          mMatchedTracksPairsSec[sec][mMatchedTracksPairsSec[sec].size() - 1].setVz(0.0); // not needed for constrained tracks
-          mMatchedTracksPairsSec[sec][mMatchedTracksPairsSec[sec].size() - 1].setChannel(mainChannel);
+          auto& match = trackMatches.emplace_back(cacheTrk[itrk], eventIndexTOFCluster, mTOFClusWork[cacheTOF[itof]].getTime(), chi2, trkLTInt[iPropagation], mTrackGid[sec][type][cacheTrk[itrk]], type, (trefTOF.getTime() - (minTrkTime + maxTrkTime - 100E3) * 0.5) * 1E-6, trefTOF.getZ(), resXor, resZor, resY); // subracting 100 ns to max track which was artificially added
+          match.setPt(pt);
+          match.setResX(sqrt(1. / errXinv2));
+          match.setResZ(sqrt(1. / errZinv2));
+          match.setResT(resT);
+          match.setVz(0.0); // not needed for constrained tracks
+          match.setChannel(mainChannel);
         }
       }
     }
   }
+
+  for (auto& trackMatches : matches) {
+    mMatchedTracksPairsSec[sec].insert(mMatchedTracksPairsSec[sec].end(), trackMatches.begin(), trackMatches.end());
+  }
+  mTimerClusterSearch.Stop();
   return;
 }
 //______________________________________________
@@ -1157,69 +1277,80 @@ void MatchTOF::doMatchingForTPC(int sec)
   if (!nTracks || !nTOFCls) {
     return;
   }
-  int itof0 = 0; // starting index in TOF clusters for matching of the track
-  float deltaPosTemp[3];
-  std::array<float, 3> pos;
-  std::array<float, 3> posBeforeProp;
-  float posFloat[3];
 
   // prematching for TPC only tracks (identify BC candidate to correct z for TPC track accordingly to v_drift)
 
-  std::vector<unsigned long> BCcand;
-
-  std::vector<int> nStripsCrossedInPropagation;
-  std::vector<std::array<std::array<int, 5>, 2>> detId;
-  std::vector<std::array<o2::track::TrackLTIntegral, 2>> trkLTInt;
-  std::vector<std::array<std::array<float, 3>, 2>> deltaPos;
-  std::vector<std::array<int, 2>> nStepsInsideSameStrip;
-  std::vector<std::array<float, 2>> Zshift;
-
-  LOG(debug) << "Trying to match %d tracks" << cacheTrk.size();
-
-  for (int itrk = 0; itrk < cacheTrk.size(); itrk++) {
+  // the tracks are propagated and matched independently, the matches are collected per track and then merged in the track order
+  struct TrackToMatch {
+    std::vector<unsigned long> BCcand;
+    std::vector<TrackInStrips> strips; // for each BC candidate
+    double tpctime;
+    double minTrkTime;
+    double maxTrkTime;
+    float pt;
+    float resT;
+    int itof0;   // first TOF cluster to be considered
+    int itofMax; // first TOF cluster after the time window
+  };
+  std::vector<TrackToMatch> tracks(nTracks);
+  std::vector<std::vector<o2::dataformats::MatchInfoTOFReco>> matches(nTracks);
+
+  // time windows of the tracks; the clusters earlier than the time window of a track are not considered for the following
+  // tracks either (reminder: tracks and clusters are both ordered in time)
+  double minClusTime = std::numeric_limits<double>::lowest();
+  for (int itrk = 0; itrk < nTracks; itrk++) {
+    auto& track = tracks[itrk];
     auto& trackWork = mTracksWork[sec][trkType::UNCONS][cacheTrk[itrk]];
-    auto& trefTrk = trackWork.first;
-    float pt = trefTrk.getPt();
     auto& intLT = mLTinfos[sec][trkType::UNCONS][cacheTrk[itrk]];
 
     float timeShift = intLT.getL() * 33.35641; // integrated time for 0.75 beta particles in ps, to take into account the t.o.f. delay with respect the interaction BC
                                                // using beta=0.75 to cover beta range [0.59 , 1.04] also for a 8 m track lenght with a 10 ns track resolution (TRD)
 
-    BCcand.clear();
-    nStripsCrossedInPropagation.clear();
-
-    int side = mSideTPC[sec][cacheTrk[itrk]];
     // look at BC candidates for the track
-    double tpctime = trackWork.second.getTimeStamp();                                                                // in mus
-    double minTrkTime = (tpctime - trackWork.second.getTimeStampError()) * 1.E6 + timeShift;                         // minimum time in ps
-    minTrkTime = int(minTrkTime / BCgranularity) * BCgranularity;                                                    // align min to a BC
-    double maxTrkTime = (tpctime + mExtraTPCFwdTime[sec][cacheTrk[itrk]]) * 1.E6 + timeShift;                        // maximum time in ps
+    track.tpctime = trackWork.second.getTimeStamp();                                                                // in mus
+    track.minTrkTime = (track.tpctime - trackWork.second.getTimeStampError()) * 1.E6 + timeShift;                  // minimum time in ps
+    track.minTrkTime = int(track.minTrkTime / BCgranularity) * BCgranularity;                                       // align min to a BC
+    track.maxTrkTime = (track.tpctime + mExtraTPCFwdTime[sec][cacheTrk[itrk]]) * 1.E6 + timeShift;                 // maximum time in ps
     const float sqrt12inv = 1. / sqrt(12.);
-    float resT = (maxTrkTime - minTrkTime) * sqrt12inv;
+    track.resT = (track.maxTrkTime - track.minTrkTime) * sqrt12inv;
+
+    minClusTime = std::max(minClusTime, track.minTrkTime);
+    auto first = std::partition_point(cacheTOF.begin(), cacheTOF.end(), [&](int i) { return mTOFClusWork[i].getTime() < minClusTime; });
+    auto last = std::partition_point(cacheTOF.begin(), cacheTOF.end(), [&](int i) { return !(mTOFClusWork[i].getTime() > track.maxTrkTime); });
+    track.itof0 = first - cacheTOF.begin();
+    track.itofMax = std::max(track.itof0, int(last - cacheTOF.begin()));
+  }
+
+  LOG(debug) << "Trying to match %d tracks" << cacheTrk.size();
+  mTimerPropagation.Start(false);
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNlanes)
+#endif
+  for (int itrk = 0; itrk < nTracks; itrk++) {
+    auto& track = tracks[itrk];
+    auto& trackWork = mTracksWork[sec][trkType::UNCONS][cacheTrk[itrk]];
+    auto& trefTrk = trackWork.first;
+    track.pt = trefTrk.getPt();
+    auto& intLT = mLTinfos[sec][trkType::UNCONS][cacheTrk[itrk]];
+    float deltaPosTemp[3];
+    std::array<float, 3> pos;
+    float posFloat[3];
+
+    auto& BCcand = track.BCcand;
+    int side = mSideTPC[sec][cacheTrk[itrk]];
+    double minTrkTime = track.minTrkTime;
+    double maxTrkTime = track.maxTrkTime;
 
     if (mIsCosmics) {
       for (double tBC = minTrkTime; tBC < maxTrkTime; tBC += BCgranularity) {
         unsigned long ibc = (unsigned long)(tBC * Geo::BC_TIME_INPS_INV);
         BCcand.emplace_back(ibc);
-        nStripsCrossedInPropagation.emplace_back(0);
       }
     }
 
-    int itofMax = nTOFCls;
-
-    for (auto itof = itof0; itof < nTOFCls; itof++) {
+    for (auto itof = track.itof0; itof < track.itofMax; itof++) {
       auto& trefTOF = mTOFClusWork[cacheTOF[itof]];
 
-      if (trefTOF.getTime() < minTrkTime) { // this cluster has a time that is too small for the current track, we will get to the next one
-        itof0 = itof + 1;
-        continue;
-      }
-
-      if (trefTOF.getTime() > maxTrkTime) { // this cluster has a time that is too large for the current track, close loop
-        itofMax = itof;
-        break;
-      }
-
       if ((trefTOF.getZ() * side < 0) && ((side > 0) != (trackWork.first.getTgl() > 0))) {
         continue;
       }
@@ -1238,20 +1369,11 @@ void MatchTOF::doMatchingForTPC(int sec)
 
       if (!isalreadyin) {
         BCcand.emplace_back(bc);
-        nStripsCrossedInPropagation.emplace_back(0);
       }
     }
 
-    detId.clear();
-    detId.reserve(BCcand.size());
-    trkLTInt.clear();
-    trkLTInt.reserve(BCcand.size());
-    Zshift.clear();
-    Zshift.reserve(BCcand.size());
-    deltaPos.clear();
-    deltaPos.reserve(BCcand.size());
-    nStepsInsideSameStrip.clear();
-    nStepsInsideSameStrip.reserve(BCcand.size());
+    auto& strips = track.strips;
+    strips.resize(BCcand.size());
 
     //    Printf("intLT (before doing anything): length = %f, time (Pion) = %f", intLT.getL(), intLT.getTOF(o2::track::PID::Pion));
     int istep = 1;    // number of steps
@@ -1270,15 +1392,6 @@ void MatchTOF::doMatchingForTPC(int sec)
 
     double reachedPoint = mXRef + istep * step;
 
-    // initializing
-    for (int ibc = 0; ibc < BCcand.size(); ibc++) {
-      for (int ii = 0; ii < 2; ii++) {
-        nStepsInsideSameStrip[ibc][ii] = 0;
-        for (int iii = 0; iii < 5; iii++) {
-          detId[ibc][ii][iii] = -1;
-        }
-      }
-    }
     while (propagateToRefX(trefTrk, reachedPoint, step, intLT) && reachedPoint < Geo::RMAX) {
       // while (o2::base::Propagator::Instance()->PropagateToXBxByBz(trefTrk,  mXRef + istep * step, MAXSNP, step, 1, &intLT) && nStripsCrossedInPropagation <= 2 && mXRef + istep * step < Geo::RMAX) {
 
@@ -1298,6 +1411,13 @@ void MatchTOF::doMatchingForTPC(int sec)
 
       // check if you fall in a strip
       for (int ibc = 0; ibc < BCcand.size(); ibc++) {
+        auto& nStripsCrossedInPropagation = strips[ibc].nStrips;
+        auto& detId = strips[ibc].detId;
+        auto& deltaPos = strips[ibc].deltaPos;
+        auto& trkLTInt = strips[ibc].trkLTInt;
+        auto& nStepsInsideSameStrip = strips[ibc].nStepsInsideSameStrip;
+        auto& Zshift = strips[ibc].zShift;
+
         for (int idet = 0; idet < 5; idet++) {
           detIdTemp[idet] = -1;
         }
@@ -1318,20 +1438,20 @@ void MatchTOF::doMatchingForTPC(int sec)
           continue;
         }
 
-        if (nStripsCrossedInPropagation[ibc] == 0 ||                                                                                                                                                                                                                          // we are crossing a strip for the first time...
-            (nStripsCrossedInPropagation[ibc] >= 1 && (detId[ibc][nStripsCrossedInPropagation[ibc] - 1][0] != detIdTemp[0] || detId[ibc][nStripsCrossedInPropagation[ibc] - 1][1] != detIdTemp[1] || detId[ibc][nStripsCrossedInPropagation[ibc] - 1][2] != detIdTemp[2]))) { // ...or we are crossing a new strip
-          if (nStripsCrossedInPropagation[ibc] == 0) {
+        if (nStripsCrossedInPropagation == 0 ||                                                                                                                                                                                            // we are crossing a strip for the first time...
+            (nStripsCrossedInPropagation >= 1 && (detId[nStripsCrossedInPropagation - 1][0] != detIdTemp[0] || detId[nStripsCrossedInPropagation - 1][1] != detIdTemp[1] || detId[nStripsCrossedInPropagation - 1][2] != detIdTemp[2]))) { // ...or we are crossing a new strip
+          if (nStripsCrossedInPropagation == 0) {
             LOG(debug) << "We cross a strip for the first time";
           }
-          if (nStripsCrossedInPropagation[ibc] == 2) {
+          if (nStripsCrossedInPropagation == 2) {
             continue; // we have already matched 2 strips, we cannot match more
           }
-          nStripsCrossedInPropagation[ibc]++;
+          nStripsCrossedInPropagation++;
         }
 
         //Printf("nStepsInsideSameStrip[nStripsCrossedInPropagation-1] = %d", nStepsInsideSameStrip[nStripsCrossedInPropagation - 1]);
-        if (nStepsInsideSameStrip[ibc][nStripsCrossedInPropagation[ibc] - 1] == 0) {
-          trkLTInt[ibc][nStripsCrossedInPropagation[ibc] - 1] = intLT;
+        if (nStepsInsideSameStrip[nStripsCrossedInPropagation - 1] == 0) {
+          trkLTInt[nStripsCrossedInPropagation - 1] = intLT;
           // temporary variables since propagation can fail
           int detIdTemp2[5] = {0, 0, 0, 0, 0};
           float deltaPosTemp2[3] = {deltaPosTemp[0], deltaPosTemp[1], deltaPosTemp[2]};
@@ -1356,7 +1476,7 @@ void MatchTOF::doMatchingForTPC(int sec)
               float dx = deltaPosTemp2[0] - deltaPosTemp[0];
               float dy = deltaPosTemp2[1] - deltaPosTemp[1];
               float dz = deltaPosTemp2[2] - deltaPosTemp[2];
-              updateTL(trkLTInt[ibc][nStripsCrossedInPropagation[ibc] - 1], sqrt(dx * dx + dy * dy + dz * dz));
+              updateTL(trkLTInt[nStripsCrossedInPropagation - 1], sqrt(dx * dx + dy * dy + dz * dz));
               detIdTemp[0] = detIdTemp2[0];
               detIdTemp[1] = detIdTemp2[1];
               detIdTemp[2] = detIdTemp2[2];
@@ -1369,20 +1489,20 @@ void MatchTOF::doMatchingForTPC(int sec)
           }
 
           // adjust accordingly to DeltaY
-          updateTL(trkLTInt[ibc][nStripsCrossedInPropagation[ibc] - 1], -deltaPosTemp[1]);
-
-          detId[ibc][nStripsCrossedInPropagation[ibc] - 1][0] = detIdTemp[0];
-          detId[ibc][nStripsCrossedInPropagation[ibc] - 1][1] = detIdTemp[1];
-          detId[ibc][nStripsCrossedInPropagation[ibc] - 1][2] = detIdTemp[2];
-          detId[ibc][nStripsCrossedInPropagation[ibc] - 1][3] = detIdTemp[3];
-          detId[ibc][nStripsCrossedInPropagation[ibc] - 1][4] = detIdTemp[4];
-          deltaPos[ibc][nStripsCrossedInPropagation[ibc] - 1][0] = deltaPosTemp[0];
-          deltaPos[ibc][nStripsCrossedInPropagation[ibc] - 1][1] = deltaPosTemp[1];
-          deltaPos[ibc][nStripsCrossedInPropagation[ibc] - 1][2] = deltaPosTemp[2];
-
-          Zshift[ibc][nStripsCrossedInPropagation[ibc] - 1] = ZshiftCurrent;
+          updateTL(trkLTInt[nStripsCrossedInPropagation - 1], -deltaPosTemp[1]);
+
+          detId[nStripsCrossedInPropagation - 1][0] = detIdTemp[0];
+          detId[nStripsCrossedInPropagation - 1][1] = detIdTemp[1];
+          detId[nStripsCrossedInPropagation - 1][2] = detIdTemp[2];
+          detId[nStripsCrossedInPropagation - 1][3] = detIdTemp[3];
+          detId[nStripsCrossedInPropagation - 1][4] = detIdTemp[4];
+          deltaPos[nStripsCrossedInPropagation - 1][0] = deltaPosTemp[0];
+          deltaPos[nStripsCrossedInPropagation - 1][1] = deltaPosTemp[1];
+          deltaPos[nStripsCrossedInPropagation - 1][2] = deltaPosTemp[2];
+
+          Zshift[nStripsCrossedInPropagation - 1] = ZshiftCurrent;
           //          Printf("intLT (after matching to strip %d): length = %f, time (Pion) = %f", nStripsCrossedInPropagation - 1, trkLTInt[nStripsCrossedInPropagation - 1].getL(), trkLTInt[nStripsCrossedInPropagation - 1].getTOF(o2::track::PID::Pion));
-          nStepsInsideSameStrip[ibc][nStripsCrossedInPropagation[ibc] - 1]++;
+          nStepsInsideSameStrip[nStripsCrossedInPropagation - 1]++;
         }
         /* // obsolete
         else { // a further propagation step in the same strip -> update info (we sum up on all matching with strip - we will divide for the number of steps a bit below)
@@ -1395,40 +1515,65 @@ void MatchTOF::doMatchingForTPC(int sec)
         */
       }
     }
+
+    for (auto& stripsBC : strips) {
+      for (Int_t imatch = 0; imatch < stripsBC.nStrips; imatch++) {
+        // we take as residual the average of the residuals along the propagation in the same strip
+        stripsBC.deltaPos[imatch][0] /= stripsBC.nStepsInsideSameStrip[imatch];
+        stripsBC.deltaPos[imatch][1] /= stripsBC.nStepsInsideSameStrip[imatch];
+        stripsBC.deltaPos[imatch][2] /= stripsBC.nStepsInsideSameStrip[imatch];
+      }
+    }
+  }
+  mTimerPropagation.Stop();
+
+  mTimerClusterSearch.Start(false);
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNlanes)
+#endif
+  for (int itrk = 0; itrk < nTracks; itrk++) {
+    auto& track = tracks[itrk];
+    auto& trefTrk = mTracksWork[sec][trkType::UNCONS][cacheTrk[itrk]].first;
+    auto& BCcand = track.BCcand;
+    int side = mSideTPC[sec][cacheTrk[itrk]];
+    double tpctime = track.tpctime;
+    float pt = track.pt;
+    float resT = track.resT;
+    auto& trackMatches = matches[itrk];
+    std::vector<int> clusters;
+
     for (int ibc = 0; ibc < BCcand.size(); ibc++) {
+      int nStripsCrossedInPropagation = track.strips[ibc].nStrips;
+      const auto& detId = track.strips[ibc].detId;
+      const auto& deltaPos = track.strips[ibc].deltaPos;
+      const auto& trkLTInt = track.strips[ibc].trkLTInt;
+      const auto& Zshift = track.strips[ibc].zShift;
       float minTime = (BCcand[ibc] - bc_grouping_tolerance) * Geo::BC_TIME_INPS;
       float maxTime = (BCcand[ibc] + bc_grouping_tolerance) * Geo::BC_TIME_INPS;
-      for (Int_t imatch = 0; imatch < nStripsCrossedInPropagation[ibc]; imatch++) {
-        // we take as residual the average of the residuals along the propagation in the same strip
-        deltaPos[ibc][imatch][0] /= nStepsInsideSameStrip[ibc][imatch];
-        deltaPos[ibc][imatch][1] /= nStepsInsideSameStrip[ibc][imatch];
-        deltaPos[ibc][imatch][2] /= nStepsInsideSameStrip[ibc][imatch];
-      }
 
-      if (nStripsCrossedInPropagation[ibc] == 0) {
+      if (nStripsCrossedInPropagation == 0) {
         continue; // the track never hit a TOF strip during the propagation
       }
 
+      // only the clusters in the crossed strips can be matched
+      int strips[2];
+      for (int imatch = 0; imatch < nStripsCrossedInPropagation; imatch++) {
+        strips[imatch] = Geo::getStripNumberPerSM(detId[imatch][1], detId[imatch][2]);
+      }
+      getClustersInStrips(sec, strips, nStripsCrossedInPropagation, track.itof0, track.itofMax, minTime, maxTime, clusters);
+
       bool foundCluster = false;
-      for (auto itof = itof0; itof < itofMax; itof++) {
+      for (auto itof : clusters) {
         //      printf("itof = %d\n", itof);
         auto& trefTOF = mTOFClusWork[cacheTOF[itof]];
-        // compare the times of the track and the TOF clusters - remember that they both are ordered in time!
-
-        if (trefTOF.getTime() < minTime) { // this cluster has a time that is too small for the current track, we will get to the next one
-          continue;
-        }
-        if (trefTOF.getTime() > maxTime) { // no more TOF clusters can be matched to this track
-          break;
-        }
 
         int mainChannel = trefTOF.getMainContributingChannel();
         int indices[5];
         Geo::getVolumeIndices(mainChannel, indices);
 
         bool isInStrip = false;
-        for (auto iPropagation = 0; iPropagation < nStripsCrossedInPropagation[ibc]; iPropagation++) {
-          if (detId[ibc][iPropagation][1] == indices[1] && detId[ibc][iPropagation][2] == indices[2]) {
+        for (auto iPropagation = 0; iPropagation < nStripsCrossedInPropagation; iPropagation++) {
+          if (detId[iPropagation][1] == indices[1] && detId[iPropagation][2] == indices[2]) {
             isInStrip = true;
           }
         }
@@ -1476,27 +1621,24 @@ void MatchTOF::doMatchingForTPC(int sec)
           posCorr[2] *= ndifInv;
         }
 
-        int trackIdTOF;
-        int eventIdTOF;
-        int sourceIdTOF;
-        for (auto iPropagation = 0; iPropagation < nStripsCrossedInPropagation[ibc]; iPropagation++) {
-          if (detId[ibc][iPropagation][1] != indices[1] || detId[ibc][iPropagation][2] != indices[2]) {
+        for (auto iPropagation = 0; iPropagation < nStripsCrossedInPropagation; iPropagation++) {
+          if (detId[iPropagation][1] != indices[1] || detId[iPropagation][2] != indices[2]) {
             continue;
           }
 
-          int bct0 = int((mTOFClusWork[cacheTOF[itof]].getTime() - trkLTInt[ibc][iPropagation].getTOF(0) + 5000) * Geo::BC_TIME_INPS_INV); // bc taken assuming speed of light (el) and 5 ns of margin
-          if (bct0 < 0) {                                                                                                                  // if negative time (it can happen at the beginng of the TF int was truncated per excess... adjusting)
+          int bct0 = int((mTOFClusWork[cacheTOF[itof]].getTime() - trkLTInt[iPropagation].getTOF(0) + 5000) * Geo::BC_TIME_INPS_INV); // bc taken assuming speed of light (el) and 5 ns of margin
+          if (bct0 < 0) {                                                                                                             // if negative time (it can happen at the beginng of the TF int was truncated per excess... adjusting)
             bct0--;
           }
           float tof = mTOFClusWork[cacheTOF[itof]].getTime() - bct0 * Geo::BC_TIME_INPS;
-          if (tof - trkLTInt[ibc][iPropagation].getTOF(6) > 2000) { // reject tracks slower than triton
+          if (tof - trkLTInt[iPropagation].getTOF(6) > 2000) { // reject tracks slower than triton
             continue;
           }
 
-          if (mMatchParams->applyPIDcutTPConly) {                                 // for TPC only tracks allowing possibility to apply a PID cut
-            if (std::abs(tof - trkLTInt[ibc][iPropagation].getTOF(2)) < 2000) {   // pion hypotesis
-            } else if (std::abs(tof - trkLTInt[ibc][iPropagation].getTOF(3)) < 2000) { // kaon hypoteis
-            } else if (std::abs(tof - trkLTInt[ibc][iPropagation].getTOF(4)) < 2000) { // proton hypotesis
+          if (mMatchParams->applyPIDcutTPConly) {                                      // for TPC only tracks allowing possibility to apply a PID cut
+            if (std::abs(tof - trkLTInt[iPropagation].getTOF(2)) < 2000) {             // pion hypotesis
+            } else if (std::abs(tof - trkLTInt[iPropagation].getTOF(3)) < 2000) {      // kaon hypoteis
+            } else if (std::abs(tof - trkLTInt[iPropagation].getTOF(4)) < 2000) {      // proton hypotesis
             } else {                                                                   // reject matching
               continue;
             }
@@ -1516,10 +1658,10 @@ void MatchTOF::doMatchingForTPC(int sec)
           }
 
           LOG(debug) << "TOF Cluster [" << itof << ", " << cacheTOF[itof] << "]:      indices   = " << indices[0] << ", " << indices[1] << ", " << indices[2] << ", " << indices[3] << ", " << indices[4];
-          LOG(debug) << "Propagated Track [" << itrk << "]: detId[" << iPropagation << "]  = " << detId[ibc][iPropagation][0] << ", " << detId[ibc][iPropagation][1] << ", " << detId[ibc][iPropagation][2] << ", " << detId[ibc][iPropagation][3] << ", " << detId[ibc][iPropagation][4];
-          float resX = deltaPos[ibc][iPropagation][0] - (indices[4] - detId[ibc][iPropagation][4]) * Geo::XPAD + posCorr[0]; // readjusting the residuals due to the fact that the propagation fell in a pad that was not exactly the one of the cluster
-          float resZ = deltaPos[ibc][iPropagation][2] - (indices[3] - detId[ibc][iPropagation][3]) * Geo::ZPAD + posCorr[2]; // readjusting the residuals due to the fact that the propagation fell in a pad that was not exactly the one of the cluster
-          float resY = deltaPos[ibc][iPropagation][1];
+          LOG(debug) << "Propagated Track [" << itrk << "]: detId[" << iPropagation << "]  = " << detId[iPropagation][0] << ", " << detId[iPropagation][1] << ", " << detId[iPropagation][2] << ", " << detId[iPropagation][3] << ", " << detId[iPropagation][4];
+          float resX = deltaPos[iPropagation][0] - (indices[4] - detId[iPropagation][4]) * Geo::XPAD + posCorr[0]; // readjusting the residuals due to the fact that the propagation fell in a pad that was not exactly the one of the cluster
+          float resZ = deltaPos[iPropagation][2] - (indices[3] - detId[iPropagation][3]) * Geo::ZPAD + posCorr[2]; // readjusting the residuals due to the fact that the propagation fell in a pad that was not exactly the one of the cluster
+          float resY = deltaPos[iPropagation][1];
           if (BCcand[ibc] > bcClus) {
             resZ += (BCcand[ibc] - bcClus) * vdriftInBC * side; // add bc correction
           } else {
@@ -1545,13 +1687,13 @@ void MatchTOF::doMatchingForTPC(int sec)
             resZ = 1E-3 / (pt + 1E-3); // high-pt should be favoured
           }
 
-          if (indices[0] != detId[ibc][iPropagation][0]) {
+          if (indices[0] != detId[iPropagation][0]) {
             continue;
           }
-          if (indices[1] != detId[ibc][iPropagation][1]) {
+          if (indices[1] != detId[iPropagation][1]) {
             continue;
           }
-          if (indices[2] != detId[ibc][iPropagation][2]) {
+          if (indices[2] != detId[iPropagation][2]) {
             continue;
           }
 
@@ -1564,18 +1706,23 @@ void MatchTOF::doMatchingForTPC(int sec)
             // set event indexes (to be checked)
 
             int eventIndexTOFCluster = mTOFClusSectIndexCache[indices[0]][itof];
-            mMatchedTracksPairsSec[sec].emplace_back(cacheTrk[itrk], eventIndexTOFCluster, mTOFClusWork[cacheTOF[itof]].getTime(), chi2, trkLTInt[ibc][iPropagation], mTrackGid[sec][trkType::UNCONS][cacheTrk[itrk]], trkType::UNCONS, trefTOF.getTime() * 1E-6 - tpctime, trefTOF.getZ(), resXor, resZor, resY); // TODO: check if this is correct!
-            mMatchedTracksPairsSec[sec][mMatchedTracksPairsSec[sec].size() - 1].setPt(pt);
-            mMatchedTracksPairsSec[sec][mMatchedTracksPairsSec[sec].size() - 1].setResX(sqrt(1. / errXinv2));
-            mMatchedTracksPairsSec[sec][mMatchedTracksPairsSec[sec].size() - 1].setResZ(sqrt(1. / errZinv2));
-            mMatchedTracksPairsSec[sec][mMatchedTracksPairsSec[sec].size() - 1].setResT(resT);
-            mMatchedTracksPairsSec[sec][mMatchedTracksPairsSec[sec].size() - 1].setVz(mVZtpcOnly[sec][itrk] + Zshift[ibc][iPropagation]);
-            mMatchedTracksPairsSec[sec][mMatchedTracksPairsSec[sec].size() - 1].setChannel(mainChannel);
+            auto& match = trackMatches.emplace_back(cacheTrk[itrk], eventIndexTOFCluster, mTOFClusWork[cacheTOF[itof]].getTime(), chi2, trkLTInt[iPropagation], mTrackGid[sec][trkType::UNCONS][cacheTrk[itrk]], trkType::UNCONS, trefTOF.getTime() * 1E-6 - tpctime, trefTOF.getZ(), resXor, resZor, resY); // TODO: check if this is correct!
+            match.setPt(pt);
+            match.setResX(sqrt(1. / errXinv2));
+            match.setResZ(sqrt(1. / errZinv2));
+            match.setResT(resT);
+            match.setVz(mVZtpcOnly[sec][itrk] + Zshift[iPropagation]);
+            match.setChannel(mainChannel);
           }
         }
       }
     }
   }
+
+  for (auto& trackMatches : matches) {
+    mMatchedTracksPairsSec[sec].insert(mMatchedTracksPairsSec[sec].end(), trackMatches.begin(), trackMatches.end());
+  }
+  mTimerClusterSearch.Stop();
   return;
 }
 //______________________________________________
@@ -106,9 +106,19 @@ void MatchTPCITS::run(const o2::globaltracking::RecoContainer& inp,
     }
 
     mTimer[SWDoMatching].Start(false);
-    for (int sec = o2::constants::math::NSectors; sec--;) {
-      doMatching(sec);
+    int nThreadsMatch = mNThreads;
+#ifdef _ALLOW_DEBUG_TREES_
+    if (mDBGOut && isDebugFlag(MatchTreeAll | MatchTreeAccOnly)) {
+      nThreadsMatch = 1; // debug streamer is not thread-safe
+    }
+#endif
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(nThreadsMatch)
+#endif
+    for (int is = 0; is < o2::constants::math::NSectors; is++) {
+      doMatching(o2::constants::math::NSectors - 1 - is);
     }
+    registerMatchCandidates(); // serially, in the same order as the sectors were processed
     mTimer[SWDoMatching].Stop();
     if constexpr (false) { // enabling this creates very verbose output
       mTimer[SWTot].Stop();
@@ -183,6 +193,8 @@ void MatchTPCITS::clear()
   for (int sec = o2::constants::math::NSectors; sec--;) {
     mITSSectIndexCache[sec].clear();
     mITSTimeStart[sec].clear();
+    mITSSectTgl[sec].clear();
+    mSectMatchCandidates[sec].clear();
     mTPCSectIndexCache[sec].clear();
     mTPCTimeStart[sec].clear();
   }
@@ -828,6 +840,11 @@ bool MatchTPCITS::prepareITSData()
       }
       return trackA.getTgl() < trackB.getTgl();
     });
+    auto& tglCache = mITSSectTgl[sec];
+    tglCache.resize(indexCache.size());
+    for (size_t i = 0; i < indexCache.size(); i++) {
+      tglCache[i] = mITSWork[indexCache[i]].getTgl();
+    }
   } // loop over tracks of single sector
   mMatchRecordsITS.reserve(mITSWork.size() * mParams->maxMatchCandidates);
   mTimer[SWPrepITS].Stop();
@@ -849,12 +866,17 @@ bool MatchTPCITS::prepareFITData()
 //_____________________________________________________
 void MatchTPCITS::doMatching(int sec)
 {
-  ///< run matching for currently cached ITS data for given TPC sector
+  ///< find matching candidates for currently cached ITS data for given TPC sector.
+  ///< Only sector-local containers are modified, so that the sectors can be processed in parallel;
+  ///< the candidates are registered in the MatchRecords by registerMatchCandidates
   auto& cacheITS = mITSSectIndexCache[sec]; // array of cached ITS track indices for this sector
   auto& cacheTPC = mTPCSectIndexCache[sec]; // array of cached ITS track indices for this sector
   auto& timeStartTPC = mTPCTimeStart[sec];  // array of 1st TPC track with timeMax in ITS ROFrame
   auto& timeStartITS = mITSTimeStart[sec];
-  int nTracksTPC = cacheTPC.size(), nTracksITS = cacheITS.size();
+  auto& tglITS = mITSSectTgl[sec];              // tgl of cached ITS tracks
+  auto& candidates = mSectMatchCandidates[sec]; // accepted pairs for this sector
+  candidates.clear();
+  int nTracksTPC = cacheTPC.size(), nTracksITS = cacheITS.size(), nROFsITS = timeStartITS.size();
   if (!nTracksTPC || !nTracksITS) {
     if (mParams->verbosity > 0) {
       LOG(info) << "Matchng sector " << sec << " : N tracks TPC:" << nTracksTPC << " ITS:" << nTracksITS << " in sector " << sec;
@@ -874,11 +896,21 @@ void MatchTPCITS::doMatching(int sec)
     return;
   }
 
-  int nCheckTPCControl = 0, nCheckITSControl = 0, nMatchesControl = 0; // temporary
-  int idxMinTPC = timeStartTPC[minROFITS];                             // index of 1st cached TPC track within cached ITS ROFrames
+  int nCheckTPCControl = 0, nCheckITSControl = 0; // temporary
+  int idxMinTPC = timeStartTPC[minROFITS];        // index of 1st cached TPC track within cached ITS ROFrames
   auto t2nbs = tpcTimeBin2MUS(mZ2TPCBin * mParams->tpcTimeICMatchingNSigma);
   bool checkInteractionCandidates = mUseFT0 && mParams->validateMatchByFIT != MatchTPCITSParams::Disable;
 
+  // ITS tracks of every ROFrame share the same time bracket and are ordered in tgl, hence within the ROFrame
+  // only those in the window tglTPC +- crudeAbsDiffCut, which would not be rejected on Tgl, need to be checked
+  float tglCut = mParams->crudeAbsDiffCut[o2::track::kTgl];
+  bool useTglWindow = true;
+#ifdef _ALLOW_DEBUG_TREES_
+  if (mDBGOut && isDebugFlag(MatchTreeAll)) {
+    useTglWindow = false; // all time-compatible pairs are stored in the debug tree
+  }
+#endif
+
   int itsROBin = 0;
   for (int itpc = idxMinTPC; itpc < nTracksTPC; itpc++) {
     auto& trefTPC = mTPCWork[cacheTPC[itpc]];
@@ -887,124 +919,130 @@ void MatchTPCITS::doMatching(int sec)
     auto tmn = trefTPC.tBracket.getMax() - maxTDriftSafe;
     itsROBin = mITSTriggered ? time2ITSROFrameTrig(tmn, itsROBin) : time2ITSROFrameCont(tmn);
 
-    if (itsROBin >= int(timeStartITS.size())) { // time of TPC track exceeds the max time of ITS in the cache
+    if (itsROBin >= nROFsITS) { // time of TPC track exceeds the max time of ITS in the cache
       break;
     }
-    int iits0 = timeStartITS[itsROBin];
     nCheckTPCControl++;
-    for (auto iits = iits0; iits < nTracksITS; iits++) {
-      auto& trefITS = mITSWork[cacheITS[iits]];
+    float tglTPC = trefTPC.getTgl();
+    for (int irof = itsROBin; irof < nROFsITS; irof++) {
+      int iitsMin = timeStartITS[irof];
+      if (iitsMin < 0) { // no ITS tracks were cached starting from this ROFrame
+        break;
+      }
+      int iitsMax = (irof + 1 < nROFsITS && timeStartITS[irof + 1] >= 0) ? timeStartITS[irof + 1] : nTracksITS;
+      if (iitsMin == iitsMax) {
+        continue;
+      }
+      const auto& tBracketITS = mITSWork[cacheITS[iitsMin]].tBracket;
       // compare if the ITS and TPC tracks may overlap in time
-      LOG(debug) << "TPC bracket: " << trefTPC.tBracket.asString() << " ITS bracket: " << trefITS.tBracket.asString() << " TPCtgl: " << trefTPC.getTgl() << " ITStgl: " << trefITS.getTgl();
-      if (trefTPC.tBracket < trefITS.tBracket) { // since TPC tracks are sorted in timeMax and ITS tracks are sorted in timeMin all following ITS tracks also will not match
+      LOG(debug) << "TPC bracket: " << trefTPC.tBracket.asString() << " ITS bracket: " << tBracketITS.asString() << " TPCtgl: " << tglTPC;
+      if (trefTPC.tBracket < tBracketITS) { // since TPC tracks are sorted in timeMax and ITS tracks are sorted in timeMin all following ITS tracks also will not match
         break;
       }
-      if (trefTPC.tBracket > trefITS.tBracket) { // its bracket precedes TPC bracket
+      if (trefTPC.tBracket > tBracketITS) { // its bracket precedes TPC bracket
         continue;
       }
-
-      // is corrected TPC track time compatible with ITS ROF expressed
-      auto deltaT = (trefITS.getZ() - trefTPC.getZ()) * mTPCVDriftInv;                                                    // drift time difference corresponding to Z differences
-      auto timeCorr = trefTPC.getCorrectedTime(deltaT);                                                                   // TPC time required to match to Z of ITS track
-      auto timeCorrErr = std::sqrt(trefITS.getSigmaZ2() + trefTPC.getSigmaZ2()) * t2nbs + mParams->safeMarginTimeCorrErr; // nsigma*error
-      if (mVDriftCalibOn) {
-        timeCorrErr += vdErrT * (250. - abs(trefITS.getZ())); // account for the extra error from TPC VDrift uncertainty
+      int iits = iitsMin;
+      if (useTglWindow) { // skip ITS tracks which would be rejected on tgl being too small
+        iits = std::partition_point(tglITS.begin() + iitsMin, tglITS.begin() + iitsMax, [tglTPC, tglCut](float tgl) { return tgl - tglTPC < -tglCut; }) - tglITS.begin();
       }
-      o2::math_utils::Bracketf_t trange(timeCorr - timeCorrErr, timeCorr + timeCorrErr);
-      LOG(debug) << "TPC range: " << trange.asString() << " ITS bracket: " << trefITS.tBracket.asString() << " DZ: " << (trefITS.getZ() - trefTPC.getZ()) << " DT: " << timeCorr;
-      // check if the assigned time is strictly within the ITS bracket
-      auto cmpITSBracket = trefITS.tBracket.isOutside(timeCorr);
-      if (cmpITSBracket) { // no, check if brackets are overlapping at all
-        if (trefITS.tBracket.isOutside(trange)) {
-          continue;
+      for (; iits < iitsMax; iits++) {
+        if (useTglWindow && tglITS[iits] - tglTPC > tglCut) { // this and all following ITS tracks of the ROFrame have too large tgl
+          break;
         }
-        if (mParams->ITSTimeOutliersPolicy == MatchTPCITSParams::TimeOutliersPolicy::Adjust) {
-          if (cmpITSBracket == o2::math_utils::Bracketf_t::Below) {
-            timeCorr = trefITS.tBracket.getMin();
-            trange.setMin(timeCorr);
-          } else {
-            timeCorr = trefITS.tBracket.getMax();
-            trange.setMax(timeCorr);
+        auto& trefITS = mITSWork[cacheITS[iits]];
+        // is corrected TPC track time compatible with ITS ROF expressed
+        auto deltaT = (trefITS.getZ() - trefTPC.getZ()) * mTPCVDriftInv;                                                    // drift time difference corresponding to Z differences
+        auto timeCorr = trefTPC.getCorrectedTime(deltaT);                                                                   // TPC time required to match to Z of ITS track
+        auto timeCorrErr = std::sqrt(trefITS.getSigmaZ2() + trefTPC.getSigmaZ2()) * t2nbs + mParams->safeMarginTimeCorrErr; // nsigma*error
+        if (mVDriftCalibOn) {
+          timeCorrErr += vdErrT * (250. - abs(trefITS.getZ())); // account for the extra error from TPC VDrift uncertainty
+        }
+        o2::math_utils::Bracketf_t trange(timeCorr - timeCorrErr, timeCorr + timeCorrErr);
+        LOG(debug) << "TPC range: " << trange.asString() << " ITS bracket: " << trefITS.tBracket.asString() << " DZ: " << (trefITS.getZ() - trefTPC.getZ()) << " DT: " << timeCorr;
+        // check if the assigned time is strictly within the ITS bracket
+        auto cmpITSBracket = trefITS.tBracket.isOutside(timeCorr);
+        if (cmpITSBracket) { // no, check if brackets are overlapping at all
+          if (trefITS.tBracket.isOutside(trange)) {
+            continue;
+          }
+          if (mParams->ITSTimeOutliersPolicy == MatchTPCITSParams::TimeOutliersPolicy::Adjust) {
+            if (cmpITSBracket == o2::math_utils::Bracketf_t::Below) {
+              timeCorr = trefITS.tBracket.getMin();
+              trange.setMin(timeCorr);
+            } else {
+              timeCorr = trefITS.tBracket.getMax();
+              trange.setMax(timeCorr);
+            }
+          } else if (mParams->ITSTimeOutliersPolicy == MatchTPCITSParams::TimeOutliersPolicy::Reject) {
+            continue;
           }
-        } else if (mParams->ITSTimeOutliersPolicy == MatchTPCITSParams::TimeOutliersPolicy::Reject) {
-          continue;
         }
-      }
 
-      nCheckITSControl++;
-      float chi2 = -1;
-      int rejFlag = compareTPCITSTracks(trefITS, trefTPC, chi2);
+        nCheckITSControl++;
+        float chi2 = -1;
+        int rejFlag = compareTPCITSTracks(trefITS, trefTPC, chi2);
 
 #ifdef _ALLOW_DEBUG_TREES_
-      if (mDBGOut && ((rejFlag == Accept && isDebugFlag(MatchTreeAccOnly)) || isDebugFlag(MatchTreeAll))) {
-        fillTPCITSmatchTree(cacheITS[iits], cacheTPC[itpc], rejFlag, chi2, timeCorr);
-      }
-#endif
-      /*
-      // RS: this might be dangerous for ITS tracks with different time coverages.
-      if (rejFlag == RejectOnTgl) {
-        // ITS tracks in each ROFrame are ordered in Tgl, hence if this check failed on Tgl check
-        // (i.e. tgl_its>tgl_tpc+tolerance), then all other ITS tracks in this ROFrame will also have tgl too large.
-        // Jump on the 1st ITS track of the next ROFrame
-        int rof = trefITS.roFrame;
-        bool stop = false;
-        do {
-          if (++rof >= int(timeStartITS.size())) {
-            stop = true;
-            break; // no more ITS ROFrames in cache
-          }
-          iits = timeStartITS[rof] - 1;                  // next track to be checked -1
-        } while (iits <= timeStartITS[trefITS.roFrame]); // skip empty bins
-        if (stop) {
-          break;
+        if (mDBGOut && ((rejFlag == Accept && isDebugFlag(MatchTreeAccOnly)) || isDebugFlag(MatchTreeAll))) {
+          fillTPCITSmatchTree(cacheITS[iits], cacheTPC[itpc], rejFlag, chi2, timeCorr);
         }
-        continue;
-      }
-      */
-      if (rejFlag != Accept) {
-        continue;
-      }
-      int matchedIC = MinusOne;
-      if (!isCosmics()) {
-        // validate by bunch filling scheme
-        if (mUseBCFilling) {
-          auto irBracket = tBracket2IRBracket(trange);
-          if (irBracket.isInvalid()) {
-            continue;
-          }
+#endif
+        if (rejFlag != Accept) {
+          continue;
         }
-        if (checkInteractionCandidates && mInteractions.size()) {
-          // check if corrected TPC track time is compatible with any of interaction times
-          int tmus = trange.getMin();
-          if (tmus < 0) {
-            tmus = 0;
-          }
-          auto entStart = tmus < int(mInteractionMUSLUT.size()) ? mInteractionMUSLUT[tmus] : (mInteractionMUSLUT.size() ? mInteractionMUSLUT.back() : 0);
-          for (int ent = entStart; ent < (int)mInteractions.size(); ent++) {
-            auto cmp = mInteractions[ent].tBracket.isOutside(trange);
-            if (cmp == o2::math_utils::Bracketf_t::Above) { // trange is above this interaction candidate, the following ones may match
+        int matchedIC = MinusOne;
+        if (!isCosmics()) {
+          // validate by bunch filling scheme
+          if (mUseBCFilling) {
+            auto irBracket = tBracket2IRBracket(trange);
+            if (irBracket.isInvalid()) {
               continue;
             }
-            if (cmp == o2::math_utils::Bracketf_t::Inside) {
-              matchedIC = ent;
+          }
+          if (checkInteractionCandidates && mInteractions.size()) {
+            // check if corrected TPC track time is compatible with any of interaction times
+            int tmus = trange.getMin();
+            if (tmus < 0) {
+              tmus = 0;
+            }
+            auto entStart = tmus < int(mInteractionMUSLUT.size()) ? mInteractionMUSLUT[tmus] : (mInteractionMUSLUT.size() ? mInteractionMUSLUT.back() : 0);
+            for (int ent = entStart; ent < (int)mInteractions.size(); ent++) {
+              auto cmp = mInteractions[ent].tBracket.isOutside(trange);
+              if (cmp == o2::math_utils::Bracketf_t::Above) { // trange is above this interaction candidate, the following ones may match
+                continue;
+              }
+              if (cmp == o2::math_utils::Bracketf_t::Inside) {
+                matchedIC = ent;
+              }
+              break; // we loop till 1st matching IC or the one above the trange (since IC are ordered, all others will be above too)
             }
-            break; // we loop till 1st matching IC or the one above the trange (since IC are ordered, all others will be above too)
+          }
+          if (mParams->validateMatchByFIT == MatchTPCITSParams::Require && matchedIC == MinusOne) {
+            continue;
           }
         }
-        if (mParams->validateMatchByFIT == MatchTPCITSParams::Require && matchedIC == MinusOne) {
-          continue;
-        }
+        candidates.emplace_back(MatchCandidate{cacheITS[iits], cacheTPC[itpc], chi2, matchedIC}); // store matching candidate
       }
-      registerMatchRecordTPC(cacheITS[iits], cacheTPC[itpc], chi2, matchedIC); // register matching candidate
-      nMatchesControl++;
     }
   }
   if (mParams->verbosity > 0) {
     LOG(info) << "Match sector " << sec << " N tracks TPC:" << nTracksTPC << " ITS:" << nTracksITS
               << " N TPC tracks checked: " << nCheckTPCControl << " (starting from " << idxMinTPC
-              << "), checks: " << nCheckITSControl << ", matches:" << nMatchesControl;
+              << "), checks: " << nCheckITSControl << ", matches:" << candidates.size();
+  }
+}
+
+//______________________________________________
+void MatchTPCITS::registerMatchCandidates()
+{
+  ///< register the candidates found by doMatching in the MatchRecords, in the order of their search
+  for (int sec = o2::constants::math::NSectors; sec--;) {
+    for (const auto& cand : mSectMatchCandidates[sec]) {
+      registerMatchRecordTPC(cand.iITS, cand.iTPC, cand.chi2, cand.matchedIC);
+    }
+    mNMatchesControl += mSectMatchCandidates[sec].size();
   }
-  mNMatchesControl += nMatchesControl;
 }
 
 //______________________________________________
@@ -1451,7 +1489,7 @@ void MatchTPCITS::refitWinners(pmr::vector<o2::dataformats::TrackTPCITS>& matche
     int iTPC = tpcToFit[ifit], iITS;
     const auto& tTPC = mTPCWork[iTPC];
     if (refitTrackTPCITS(ifit, iTPC, iITS, matchedTracks, matchLabels, calib)) {
-      mWinnerChi2Refit[iITS] = matchedTracks.back().getChi2Refit();
+      mWinnerChi2Refit[iITS] = matchedTracks[ifit].getChi2Refit();
     } else {
       ++nFailedRefit;
     }
@@ -1741,14 +1779,14 @@ bool MatchTPCITS::refitTrackTPCITS(int slot, int iTPC, int& iITS, pmr::vector<o2
 }
 
 //______________________________________________
-bool MatchTPCITS::refitABTrack(int iITSAB, const TPCABSeed& seed, pmr::vector<o2::dataformats::TrackTPCITS>& matchedTracks, pmr::vector<int>& ABTrackletClusterIDs, pmr::vector<o2::itsmft::TrkClusRef>& ABTrackletRefs)
+bool MatchTPCITS::refitABTrack(int iITSAB, const TPCABSeed& seed, o2::dataformats::TrackTPCITS& newtr, const pmr::vector<int>& ABTrackletClusterIDs, const pmr::vector<o2::itsmft::TrkClusRef>& ABTrackletRefs)
 {
   ///< refit AfterBurner track
 
   const float maxStep = 2.f; // max propagation step (TODO: tune)
   const auto& tTPC = mTPCWork[seed.tpcWID];
   const auto& winLink = seed.getLink(seed.winLinkID);
-  auto& newtr = matchedTracks.emplace_back(winLink, winLink); // create a copy of winner param at innermost ITS cluster
+  newtr = o2::dataformats::TrackTPCITS(winLink, winLink); // create a copy of winner param at innermost ITS cluster
   auto& tracOut = newtr.getParamOut();
   auto& tofL = newtr.getLTIntegralOut();
   auto geom = o2::its::GeometryTGeo::Instance();
@@ -1780,7 +1818,6 @@ bool MatchTPCITS::refitABTrack(int iITSAB, const TPCABSeed& seed, pmr::vector<o2
   if (nclRefit != ncl) {
     LOGP(debug, "AfterBurner refit in ITS failed after ncl={}, match between TPC track #{} and ITS tracklet #{}", nclRefit, tTPC.sourceID, iITSAB);
     LOGP(debug, "{:s}", tracOut.asString());
-    matchedTracks.pop_back(); // destroy failed track
     return false;
   }
   // perform TPC refit with interaction time constraint
@@ -1791,7 +1828,6 @@ bool MatchTPCITS::refitABTrack(int iITSAB, const TPCABSeed& seed, pmr::vector<o2
     if (!tracOut.getXatLabR(o2::constants::geom::XTPCInnerRef, xtogo, mBz, o2::track::DirOutward) ||
         !propagator->PropagateToXBxByBz(tracOut, xtogo, MaxSnp, 10., mUseMatCorrFlag, &tofL)) {
       LOG(debug) << "Propagation to inner TPC boundary X=" << xtogo << " failed, Xtr=" << tracOut.getX() << " snp=" << tracOut.getSnp();
-      matchedTracks.pop_back(); // destroy failed track
       return false;
     }
     float chi2Out = 0;
@@ -1799,7 +1835,6 @@ bool MatchTPCITS::refitABTrack(int iITSAB, const TPCABSeed& seed, pmr::vector<o2
     int retVal = mTPCRefitter->RefitTrackAsTrackParCov(tracOut, mTPCTracksArray[tTPC.sourceID].getClusterRef(), timeC * mTPCTBinMUSInv, &chi2Out, true, false); // outward refit
     if (retVal < 0) {
       LOG(debug) << "Refit failed";
-      matchedTracks.pop_back(); // destroy failed track
       return false;
     }
     auto posEnd = tracOut.getXYZGlo();
@@ -2087,6 +2122,12 @@ void MatchTPCITS::refitABWinners(pmr::vector<o2::dataformats::TrackTPCITS>& matc
     }
   };
 
+  // collect clusters (and labels) of all winners, the refit of each winner is done in parallel
+  int nWinners = mABWinnersIDs.size();
+  std::vector<o2::MCCompLabel> winnerLabels;
+  if (mMCTruthON) {
+    winnerLabels.reserve(nWinners);
+  }
   for (auto wid : mABWinnersIDs) {
     const auto& ABSeed = mTPCABSeeds[wid];
     int start = ABTrackletClusterIDs.size();
@@ -2106,14 +2147,6 @@ void MatchTPCITS::refitABWinners(pmr::vector<o2::dataformats::TrackTPCITS>& matc
       lID = winL.parentID;
     }
     clref.setEntries(ncl);
-    if (!refitABTrack(ABTrackletRefs.size() - 1, ABSeed, matchedTracks, ABTrackletClusterIDs, ABTrackletRefs)) { // on failure, destroy added tracklet reference
-      ABTrackletRefs.pop_back();
-      ABTrackletClusterIDs.resize(start); // RSS
-      if (mMCTruthON) {
-        labelOccurence.clear();
-      }
-      continue;
-    }
     if (mMCTruthON) {
       o2::MCCompLabel lab;
       int maxL = 0; // find most encountered label
@@ -2127,13 +2160,46 @@ void MatchTPCITS::refitABWinners(pmr::vector<o2::dataformats::TrackTPCITS>& matc
         lab.setFakeFlag();
       }
       labelOccurence.clear();
+      winnerLabels.push_back(lab);
+    }
+  }
+
+  std::vector<o2::dataformats::TrackTPCITS> winnerTracks(nWinners);
+  std::vector<uint8_t> winnerRefitOK(nWinners, 0);
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNThreads)
+#endif
+  for (int iw = 0; iw < nWinners; iw++) {
+    winnerRefitOK[iw] = refitABTrack(iw, mTPCABSeeds[mABWinnersIDs[iw]], winnerTracks[iw], ABTrackletClusterIDs, ABTrackletRefs);
+  }
+
+  // store refitted tracks in the order of winners, destroying tracklet references and clusters of failed ones
+  int nRefitOK = 0, nClusOK = 0;
+  for (int iw = 0; iw < nWinners; iw++) {
+    if (!winnerRefitOK[iw]) {
+      continue;
+    }
+    auto clref = ABTrackletRefs[iw];
+    if (clref.getFirstEntry() != nClusOK) { // destination precedes the source, nothing to move if they coincide
+      std::copy(ABTrackletClusterIDs.begin() + clref.getFirstEntry(), ABTrackletClusterIDs.begin() + clref.getEntriesBound(), ABTrackletClusterIDs.begin() + nClusOK);
+      clref.setFirstEntry(nClusOK);
+    }
+    nClusOK += clref.getEntries();
+    ABTrackletRefs[nRefitOK] = clref;
+    auto& newtr = matchedTracks.emplace_back(winnerTracks[iw]);
+    newtr.setRefITS({unsigned(nRefitOK), o2::dataformats::GlobalTrackID::ITSAB});
+    if (mMCTruthON) {
+      const auto& ABSeed = mTPCABSeeds[mABWinnersIDs[iw]];
+      const auto& lab = winnerLabels[iw];
       ABTrackletLabels.push_back(lab); // ITSAB tracklet label
       auto& lblGlo = matchLabels.emplace_back(mTPCLblWork[ABSeed.tpcWID]);
       lblGlo.setFakeFlag(lab != lblGlo);
-      LOG(debug) << "ABWinner ncl=" << ncl << " mcLBAB " << lab << " mcLBGlo " << lblGlo << " chi2=" << ABSeed.getLink(ABSeed.winLinkID).chi2Norm() << " pT = " << ABSeed.track.getPt();
+      LOG(debug) << "ABWinner ncl=" << clref.getEntries() << " mcLBAB " << lab << " mcLBGlo " << lblGlo << " chi2=" << ABSeed.getLink(ABSeed.winLinkID).chi2Norm() << " pT = " << ABSeed.track.getPt();
     }
-    // build MC label
+    nRefitOK++;
   }
+  ABTrackletRefs.resize(nRefitOK);
+  ABTrackletClusterIDs.resize(nClusOK);
   LOG(info) << "AfterBurner validated " << ABTrackletRefs.size() << " tracks";
 }
 
@@ -2574,7 +2640,7 @@ void MatchTPCITS::setBunchFilling(const o2::BunchFilling& bf)
 }
 
 //___________________________________________________________________
-MatchTPCITS::BracketIR MatchTPCITS::tBracket2IRBracket(const BracketF tbrange)
+MatchTPCITS::BracketIR MatchTPCITS::tBracket2IRBracket(const BracketF tbrange) const
 {
   // convert time bracket to IR bracket
   o2::InteractionRecord irMin(mStartIR), irMax(mStartIR);
@@ -2840,6 +2906,24 @@ void MatchTPCITS::reportSizes(pmr::vector<o2::dataformats::TrackTPCITS>& matched
     capTot += cap;
     LOGP(info, "Size RSS, mITSTimeStart         : size {:9} cap {:9}", siz, cap);
     //
+    siz = cap = 0;
+    for (int is = 0; is < o2::constants::math::NSectors; is++) {
+      siz += mITSSectTgl[is].size() * sizeof(float);
+      cap += mITSSectTgl[is].capacity() * sizeof(float);
+    }
+    sizTot += siz;
+    capTot += cap;
+    LOGP(info, "Size RSS, mITSSectTgl           : size {:9} cap {:9}", siz, cap);
+    //
+    siz = cap = 0;
+    for (int is = 0; is < o2::constants::math::NSectors; is++) {
+      siz += mSectMatchCandidates[is].size() * sizeof(MatchCandidate);
+      cap += mSectMatchCandidates[is].capacity() * sizeof(MatchCandidate);
+    }
+    sizTot += siz;
+    capTot += cap;
+    LOGP(info, "Size RSS, mSectMatchCandidates  : size {:9} cap {:9}", siz, cap);
+    //
     siz = mITSTrackROFContMapping.size() * sizeof(int);
     cap = mITSTrackROFContMapping.capacity() * sizeof(int);
     sizTot += siz;
@@ -0,0 +1,202 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file testMatchTOFStripIndex.cxx
+/// \brief Compare the TOF cluster lookup in the strip index of MatchTOF with the scan of all clusters of a sector
+
+#define BOOST_TEST_MODULE Test MatchTOF strip index
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <random>
+#include <vector>
+#include "GlobalTracking/MatchTOF.h"
+#include "DataFormatsTOF/Cluster.h"
+#include "TOFBase/Geo.h"
+
+using o2::globaltracking::MatchTOF;
+using o2::tof::Cluster;
+using o2::tof::Geo;
+
+namespace
+{
+constexpr int Sector = 7;
+
+struct SectorEvent {
+  std::vector<Cluster> clusters;
+  std::vector<int> sectorCache; // indices in clusters of the clusters of the sector, ordered in time
+  std::vector<int> clusStrip;   // strip of the cluster at each position of sectorCache
+  std::array<int, Geo::NSTRIPXSECTOR + 1> stripFirst;
+  std::vector<int> stripIndex;
+};
+
+/// clusters in random pads of a sector and in other sectors; the times are on a coarse grid to have clusters with equal times
+SectorEvent createEvent(int nClusters, unsigned int seed)
+{
+  std::mt19937 generator(seed);
+  std::uniform_int_distribution<int> paddist(0, Geo::NPADSXSECTOR - 1);
+  std::uniform_int_distribution<int> timedist(0, 20000);
+  SectorEvent event;
+  for (int i = 0; i < nClusters; i++) {
+    int sector = (i % 5) ? Sector : (Sector + 1 + i % 3);
+    auto& cl = event.clusters.emplace_back();
+    cl.setMainContributingChannel(sector * Geo::NPADSXSECTOR + paddist(generator));
+    cl.setTime(timedist(generator) * 10.);
+    if (sector == Sector) {
+      event.sectorCache.push_back(i);
+    }
+  }
+  std::stable_sort(event.sectorCache.begin(), event.sectorCache.end(), [&event](int a, int b) { return event.clusters[a].getTime() < event.clusters[b].getTime(); });
+  for (auto icl : event.sectorCache) {
+    int indices[5];
+    Geo::getVolumeIndices(event.clusters[icl].getMainContributingChannel(), indices);
+    event.clusStrip.push_back(Geo::getStripNumberPerSM(indices[1], indices[2]));
+  }
+  MatchTOF::fillStripIndex(event.clusters, event.sectorCache, event.stripFirst, event.stripIndex);
+  return event;
+}
+
+bool inStrips(int strip, const int* strips, int nStrips)
+{
+  return std::find(strips, strips + nStrips, strip) != strips + nStrips;
+}
+
+/// scan of the sector clusters in [posMin, posMax), as done by the TPC-only track matching before the strip index
+std::vector<int> scanClusters(const SectorEvent& event, const int* strips, int nStrips, int posMin, int posMax, double minTime, double maxTime)
+{
+  std::vector<int> positions;
+  for (int itof = posMin; itof < posMax; itof++) {
+    double time = event.clusters[event.sectorCache[itof]].getTime();
+    if (time < minTime) {
+      continue;
+    }
+    if (time > maxTime) {
+      break;
+    }
+    if (inStrips(event.clusStrip[itof], strips, nStrips)) {
+      positions.push_back(itof);
+    }
+  }
+  return positions;
+}
+
+void randomStrips(std::mt19937& generator, int* strips, int& nStrips)
+{
+  std::uniform_int_distribution<int> stripdist(0, Geo::NSTRIPXSECTOR - 1);
+  nStrips = 1 + generator() % 2;
+  strips[0] = stripdist(generator);
+  strips[1] = generator() % 4 ? std::min(strips[0] + 1, Geo::NSTRIPXSECTOR - 1) : stripdist(generator); // mostly neighbouring strips
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(MatchTOF_StripIndexContent)
+{
+  auto event = createEvent(5000, 1);
+  BOOST_REQUIRE_EQUAL(event.stripFirst[0], 0);
+  BOOST_CHECK_EQUAL(event.stripFirst[Geo::NSTRIPXSECTOR], event.sectorCache.size());
+  BOOST_CHECK_EQUAL(event.stripIndex.size(), event.sectorCache.size());
+  for (int strip = 0; strip < Geo::NSTRIPXSECTOR; strip++) {
+    for (int i = event.stripFirst[strip]; i < event.stripFirst[strip + 1]; i++) {
+      BOOST_CHECK_EQUAL(event.clusStrip[event.stripIndex[i]], strip);
+      if (i > event.stripFirst[strip]) {
+        BOOST_CHECK_LT(event.stripIndex[i - 1], event.stripIndex[i]);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(MatchTOF_StripIndexLookup)
+{
+  std::mt19937 generator(2);
+  std::uniform_real_distribution<double> timedist(-1000., 210000.);
+  std::vector<int> positions;
+  for (unsigned int seed = 1; seed <= 3; seed++) {
+    auto event = createEvent(2000 * seed, seed);
+    int nTOFCls = event.sectorCache.size();
+    std::uniform_int_distribution<int> posdist(0, nTOFCls);
+    for (int itest = 0; itest < 2000; itest++) {
+      int strips[2], nStrips;
+      randomStrips(generator, strips, nStrips);
+      int posMin = posdist(generator), posMax = posdist(generator);
+      if (posMin > posMax) {
+        std::swap(posMin, posMax);
+      }
+      if (itest % 2) {
+        posMin = 0;
+        posMax = nTOFCls;
+      }
+      double minTime = timedist(generator), maxTime = minTime + (itest % 3 ? 5000. : 50000.);
+      if (itest % 7 == 0) { // window edges on the time of a cluster
+        minTime = event.clusters[event.sectorCache[posdist(generator) % nTOFCls]].getTime();
+        maxTime = event.clusters[event.sectorCache[posdist(generator) % nTOFCls]].getTime();
+      }
+      MatchTOF::getClustersInStrips(event.clusters, event.sectorCache, event.stripFirst, event.stripIndex, strips, nStrips, posMin, posMax, minTime, maxTime, positions);
+      auto reference = scanClusters(event, strips, nStrips, posMin, posMax, minTime, maxTime);
+      BOOST_CHECK_EQUAL_COLLECTIONS(positions.begin(), positions.end(), reference.begin(), reference.end());
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(MatchTOF_StripIndexTrackSequence)
+{
+  // tracks ordered in time, matched one after the other: the scan for the constrained tracks before the strip index skipped
+  // for the following tracks the clusters earlier than the time window of a track; the lookup bounds the time window
+  // from below by the largest minimum time of the previous tracks instead
+  std::mt19937 generator(3);
+  auto event = createEvent(6000, 4);
+  int nTOFCls = event.sectorCache.size();
+  std::uniform_real_distribution<double> timedist(0., 200000.);
+  std::vector<double> trackTimes(3000);
+  for (auto& t : trackTimes) {
+    t = timedist(generator);
+  }
+  std::sort(trackTimes.begin(), trackTimes.end());
+
+  int itof0 = 0;
+  double minClusTime = std::numeric_limits<double>::lowest();
+  std::vector<int> positions;
+  size_t nCandidates = 0;
+  for (auto trackTime : trackTimes) {
+    int strips[2], nStrips;
+    randomStrips(generator, strips, nStrips);
+    if (generator() % 10 == 0) {
+      nStrips = 0; // the track did not reach the TOF strips
+    }
+    double minTrkTime = trackTime - (generator() % 2 ? 500. : 10000.), maxTrkTime = trackTime + 2000.;
+    if (!nStrips) {
+      continue;
+    }
+
+    std::vector<int> reference;
+    for (auto itof = itof0; itof < nTOFCls; itof++) {
+      double time = event.clusters[event.sectorCache[itof]].getTime();
+      if (time < minTrkTime) {
+        itof0 = itof + 1;
+        continue;
+      }
+      if (time > maxTrkTime) {
+        break;
+      }
+      if (inStrips(event.clusStrip[itof], strips, nStrips)) {
+        reference.push_back(itof);
+      }
+    }
+
+    minClusTime = std::max(minClusTime, minTrkTime);
+    MatchTOF::getClustersInStrips(event.clusters, event.sectorCache, event.stripFirst, event.stripIndex, strips, nStrips, 0, nTOFCls, minClusTime, maxTrkTime, positions);
+    BOOST_CHECK_EQUAL_COLLECTIONS(positions.begin(), positions.end(), reference.begin(), reference.end());
+    nCandidates += reference.size();
+  }
+  BOOST_CHECK(nCandidates > 0);
+}
@@ -15,6 +15,7 @@
 
 #include <array>
 #include <vector>
+#include <type_traits>
 #include <utility>
 #include <numeric>
 #include <cassert>
@@ -250,6 +251,23 @@ class TimeFrame
   void setExtAllocator(bool ext) { mExtAllocator = ext; }
   bool getExtAllocator() const { return mExtAllocator; }
 
+  /// Memory of the TF vectors: when reused, the vectors are cleared keeping their capacity for the next TF,
+  /// unless it exceeds shrinkFactor times what was used by the last TF (high-water mark), then it is released.
+  /// The capacities are summed over the TF vectors (with their inner vectors) when the stats are reset at the
+  /// loading of a TF and when they are queried, e.g. at the end of the TF.
+  struct MemoryStats {
+    size_t startBytes = 0;    // capacity when the TF was loaded, i.e. kept from the previous TF
+    size_t releasedBytes = 0; // capacity released while clearing the TF vectors since the TF was loaded
+    size_t currentBytes = 0;  // capacity at the time of the query
+    size_t nKept = 0;         // vectors cleared keeping their capacity, i.e. (re)allocations avoided in this TF
+    size_t nReleased = 0;     // vectors whose capacity was released, i.e. (re)allocated again when filled in this TF
+  };
+  void setReuseMemory(bool reuse, float shrinkFactor = 2.f);
+  bool getReuseMemory() const { return mReuseMemory; }
+  MemoryStats getMemoryStats() const;
+  void resetMemoryStats();
+  size_t getVectorsCapacity() const;
+
   /// Debug and printing
   void checkTrackletLUTs();
   void printROFoffsets();
@@ -305,12 +323,60 @@ class TimeFrame
   }
 
  protected:
+  template <typename T>
+  struct IsVector : std::false_type {
+  };
+  template <typename T>
+  struct IsVector<std::vector<T>> : std::true_type {
+  };
+
   template <typename T>
   void deepVectorClear(std::vector<T>& vec)
   {
+    if constexpr (IsVector<T>::value) {
+      for (auto& v : vec) {
+        deepVectorClear(v);
+      }
+      if (mReuseMemory) { // inner vectors are kept with their capacity, the caller resizes the outer one
+        mMemoryStats.nKept += bool(vec.capacity());
+        return;
+      }
+    }
+    if (!vec.capacity()) {
+      return;
+    }
+    if (mReuseMemory && vec.capacity() <= mShrinkFactor * std::max(vec.size(), size_t(1))) {
+      vec.clear();
+      mMemoryStats.nKept++;
+      return;
+    }
+    mMemoryStats.nReleased++;
+    mMemoryStats.releasedBytes += vec.capacity() * sizeof(T);
     std::vector<T>().swap(vec);
   }
 
+  template <typename T>
+  static size_t capacityBytes(const std::vector<T>& vec)
+  {
+    size_t bytes{vec.capacity() * sizeof(T)};
+    if constexpr (IsVector<T>::value) {
+      for (const auto& v : vec) {
+        bytes += capacityBytes(v);
+      }
+    }
+    return bytes;
+  }
+
+  template <typename T, size_t N>
+  static size_t capacityBytes(const std::array<T, N>& arr)
+  {
+    size_t bytes{0};
+    for (const auto& v : arr) {
+      bytes += capacityBytes(v);
+    }
+    return bytes;
+  }
+
  private:
   void prepareClusters(const TrackingParameters& trkParam, const int maxLayers);
   float mBz = 5.;
@@ -325,6 +391,10 @@ class TimeFrame
   std::vector<float> mPositionResolution;
   std::vector<uint8_t> mClusterSize;
 
+  bool mReuseMemory = false;
+  float mShrinkFactor = 2.f;
+  MemoryStats mMemoryStats;
+
   std::vector<uint8_t> mROFMask;
   std::vector<std::array<float, 2>> mPValphaX; /// PV x and alpha for track propagation
   std::vector<std::vector<MCCompLabel>> mTrackletLabels;
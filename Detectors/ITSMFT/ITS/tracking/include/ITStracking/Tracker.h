@@ -98,6 +98,7 @@ class Tracker
   void computeRoadsMClabels();
   void computeTracksMClabels();
   void rectifyClusterIndices();
+  std::string getMemoryReport() const;
 
   template <typename... T>
   float evaluateTask(void (Tracker::*)(T...), const char*, std::function<void(std::string s)> logger, T&&... args);
@@ -87,6 +87,8 @@ struct TrackerParamConfig : public o2::conf::ConfigurableParamHelper<TrackerPara
   bool doUPCIteration = false;             // Perform an additional iteration for UPC events on tagged vertices. You want to combine this config with VertexerParamConfig.nIterations=2
   bool fataliseUponFailure = true;         // granular management of the fatalisation in async mode
   bool dropTFUponFailure = false;
+  bool reuseTFMemory = false;              // keep the capacity of the TimeFrame vectors across TFs instead of releasing it
+  float tfMemoryShrinkFactor = 2.f;        // with reuseTFMemory, release a vector whose capacity exceeds this factor times the size used by the last TF
 
   O2ParamDef(TrackerParamConfig, "ITSCATrackerParam");
 };
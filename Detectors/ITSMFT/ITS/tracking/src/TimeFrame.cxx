@@ -185,6 +185,7 @@ int TimeFrame::loadROFrameData(gsl::span<o2::itsmft::ROFRecord> rofs,
                                const itsmft::TopologyDictionary* dict,
                                const dataformats::MCTruthContainer<MCCompLabel>* mcLabels)
 {
+  resetMemoryStats();
   for (int iLayer{0}; iLayer < mUnsortedClusters.size(); ++iLayer) {
     deepVectorClear(mUnsortedClusters[iLayer]);
     deepVectorClear(mTrackingFrameInfo[iLayer]);
@@ -288,7 +289,7 @@ void TimeFrame::prepareClusters(const TrackingParameters& trkParam, const int ma
       const auto unsortedClusters{getUnsortedClustersOnLayer(rof, iLayer)};
       const int clustersNum{static_cast<int>(unsortedClusters.size())};
 
-      deepVectorClear(cHelper);
+      cHelper.clear();
       cHelper.resize(clustersNum);
 
       for (int iCluster{0}; iCluster < clustersNum; ++iCluster) {
@@ -379,7 +380,10 @@ void TimeFrame::initialise(const int iteration, const TrackingParameters& trkPar
       mPositionResolution[iLayer] = o2::gpu::CAMath::Sqrt(0.5 * (trkParam.SystErrorZ2[iLayer] + trkParam.SystErrorY2[iLayer]) + trkParam.LayerResolution[iLayer] * trkParam.LayerResolution[iLayer]);
     }
     deepVectorClear(mIndexTables);
-    mIndexTables.resize(mClusters.size(), std::vector<int>(mNrof * (trkParam.ZBins * trkParam.PhiBins + 1), 0));
+    mIndexTables.resize(mClusters.size());
+    for (auto& indexTable : mIndexTables) {
+      indexTable.assign(mNrof * (trkParam.ZBins * trkParam.PhiBins + 1), 0);
+    }
     mLines.resize(mNrof);
     mTrackletClusters.resize(mNrof);
 
@@ -451,6 +455,37 @@ void TimeFrame::initialise(const int iteration, const TrackingParameters& trkPar
   }
 }
 
+void TimeFrame::setReuseMemory(bool reuse, float shrinkFactor)
+{
+  mReuseMemory = reuse;
+  mShrinkFactor = std::max(shrinkFactor, 1.f);
+}
+
+void TimeFrame::resetMemoryStats()
+{
+  mMemoryStats = MemoryStats{};
+  mMemoryStats.startBytes = getVectorsCapacity();
+}
+
+TimeFrame::MemoryStats TimeFrame::getMemoryStats() const
+{
+  MemoryStats stats{mMemoryStats};
+  stats.currentBytes = getVectorsCapacity();
+  return stats;
+}
+
+size_t TimeFrame::getVectorsCapacity() const
+{
+  // the vectors cleared by deepVectorClear from TF to TF
+  return capacityBytes(mClusters) + capacityBytes(mUnsortedClusters) + capacityBytes(mTrackingFrameInfo) + capacityBytes(mClusterExternalIndices) +
+         capacityBytes(mClusterSize) + capacityBytes(mUsedClusters) + capacityBytes(mIndexTables) + capacityBytes(mNTrackletsPerCluster) +
+         capacityBytes(mNTrackletsPerClusterSum) + capacityBytes(mTracklets) + capacityBytes(mTrackletLabels) + capacityBytes(mTrackletsLookupTable) +
+         capacityBytes(mCells) + capacityBytes(mCellLabels) + capacityBytes(mCellsLookupTable) + capacityBytes(mCellsNeighbours) +
+         capacityBytes(mCellsNeighboursLUT) + capacityBytes(mRoads) + capacityBytes(mRoadLabels) + capacityBytes(mTracks) + capacityBytes(mTracksLabel) +
+         capacityBytes(mPrimaryVertices) + capacityBytes(mTotVertPerIteration) + capacityBytes(mVerticesMCRecInfo) + capacityBytes(mLines) +
+         capacityBytes(mLinesLabels) + capacityBytes(mTrackletClusters) + capacityBytes(mTrackletsIndexROF);
+}
+
 unsigned long TimeFrame::getArtefactsMemory()
 {
   unsigned long size{0};
@@ -36,6 +36,7 @@ namespace o2
 namespace its
 {
 using o2::its::constants::GB;
+using o2::its::constants::MB;
 
 Tracker::Tracker(o2::its::TrackerTraits* traits)
 {
@@ -144,9 +145,10 @@ void Tracker::clustersToTracks(std::function<void(std::string s)> logger, std::f
             << "Timeframe " << mTimeFrameCounter++ << " processing completed in: " << total << "ms using " << mTraits->getNThreads() << " threads.";
   }
   logger(sstream.str());
+  logger(getMemoryReport());
 
   if (mTimeFrame->hasMCinformation()) {
-    computeTracksMClabels();
+    evaluateTask(&Tracker::computeTracksMClabels, "Tracks MC labels computation", logger);
   }
   rectifyClusterIndices();
   mNumberOfRuns++;
@@ -224,9 +226,10 @@ void Tracker::clustersToTracksHybrid(std::function<void(std::string s)> logger,
             << "Timeframe " << mTimeFrameCounter++ << " processing completed in: " << total << "ms using " << mTraits->getNThreads() << " threads.";
   }
   logger(sstream.str());
+  logger(getMemoryReport());
 
   if (mTimeFrame->hasMCinformation()) {
-    computeTracksMClabels();
+    evaluateTask(&Tracker::computeTracksMClabels, "Tracks MC labels computation", logger);
   }
   rectifyClusterIndices();
   mNumberOfRuns++;
@@ -408,58 +411,66 @@ void Tracker::computeRoadsMClabels()
 
 void Tracker::computeTracksMClabels()
 {
-  for (int iROF{0}; iROF < mTimeFrame->getNrof(); ++iROF) {
-    for (auto& track : mTimeFrame->getTracks(iROF)) {
-      std::vector<std::pair<MCCompLabel, size_t>> occurrences;
-      occurrences.clear();
-
-      for (int iCluster = 0; iCluster < TrackITSExt::MaxClusters; ++iCluster) {
-        const int index = track.getClusterIndex(iCluster);
-        if (index == constants::its::UnusedIndex) {
-          continue;
-        }
-        auto labels = mTimeFrame->getClusterLabels(iCluster, index);
-        bool found{false};
-        for (size_t iOcc{0}; iOcc < occurrences.size(); ++iOcc) {
-          std::pair<o2::MCCompLabel, size_t>& occurrence = occurrences[iOcc];
-          for (auto& label : labels) {
-            if (label == occurrence.first) {
-              ++occurrence.second;
-              found = true;
-              // break; // uncomment to stop to the first hit
+  /// ROFs are processed in parallel, each thread reusing its own buffer of label occurrences:
+  /// the labels of a ROF are filled by a single thread in the order of its tracks.
+#pragma omp parallel num_threads(mTraits->getNThreads())
+  {
+    std::vector<std::pair<MCCompLabel, size_t>> occurrences;
+#pragma omp for schedule(dynamic)
+    for (int iROF = 0; iROF < mTimeFrame->getNrof(); ++iROF) {
+      auto& tracksLabel{mTimeFrame->getTracksLabel(iROF)};
+      tracksLabel.reserve(tracksLabel.size() + mTimeFrame->getTracks(iROF).size());
+      for (auto& track : mTimeFrame->getTracks(iROF)) {
+        occurrences.clear();
+
+        for (int iCluster = 0; iCluster < TrackITSExt::MaxClusters; ++iCluster) {
+          const int index = track.getClusterIndex(iCluster);
+          if (index == constants::its::UnusedIndex) {
+            continue;
+          }
+          auto labels = mTimeFrame->getClusterLabels(iCluster, index);
+          bool found{false};
+          for (size_t iOcc{0}; iOcc < occurrences.size(); ++iOcc) {
+            std::pair<o2::MCCompLabel, size_t>& occurrence = occurrences[iOcc];
+            for (auto& label : labels) {
+              if (label == occurrence.first) {
+                ++occurrence.second;
+                found = true;
+                // break; // uncomment to stop to the first hit
+              }
             }
           }
-        }
-        if (!found) {
-          for (auto& label : labels) {
-            occurrences.emplace_back(label, 1);
+          if (!found) {
+            for (auto& label : labels) {
+              occurrences.emplace_back(label, 1);
+            }
           }
         }
-      }
-      std::sort(std::begin(occurrences), std::end(occurrences), [](auto e1, auto e2) {
-        return e1.second > e2.second;
-      });
-
-      auto maxOccurrencesValue = occurrences[0].first;
-      uint32_t pattern = track.getPattern();
-      // set fake clusters pattern
-      for (int ic{TrackITSExt::MaxClusters}; ic--;) {
-        auto clid = track.getClusterIndex(ic);
-        if (clid != constants::its::UnusedIndex) {
-          auto labelsSpan = mTimeFrame->getClusterLabels(ic, clid);
-          for (auto& currentLabel : labelsSpan) {
-            if (currentLabel == maxOccurrencesValue) {
-              pattern |= 0x1 << (16 + ic); // set bit if correct
-              break;
+        std::sort(std::begin(occurrences), std::end(occurrences), [](auto e1, auto e2) {
+          return e1.second > e2.second;
+        });
+
+        auto maxOccurrencesValue = occurrences[0].first;
+        uint32_t pattern = track.getPattern();
+        // set fake clusters pattern
+        for (int ic{TrackITSExt::MaxClusters}; ic--;) {
+          auto clid = track.getClusterIndex(ic);
+          if (clid != constants::its::UnusedIndex) {
+            auto labelsSpan = mTimeFrame->getClusterLabels(ic, clid);
+            for (auto& currentLabel : labelsSpan) {
+              if (currentLabel == maxOccurrencesValue) {
+                pattern |= 0x1 << (16 + ic); // set bit if correct
+                break;
+              }
             }
           }
         }
+        track.setPattern(pattern);
+        if (occurrences[0].second < track.getNumberOfClusters()) {
+          maxOccurrencesValue.setFakeFlag();
+        }
+        tracksLabel.emplace_back(maxOccurrencesValue);
       }
-      track.setPattern(pattern);
-      if (occurrences[0].second < track.getNumberOfClusters()) {
-        maxOccurrencesValue.setFakeFlag();
-      }
-      mTimeFrame->getTracksLabel(iROF).emplace_back(maxOccurrencesValue);
     }
   }
 }
@@ -478,6 +489,17 @@ void Tracker::rectifyClusterIndices()
   }
 }
 
+std::string Tracker::getMemoryReport() const
+{
+  const auto memStats = mTimeFrame->getMemoryStats();
+  if (mTimeFrame->getReuseMemory()) {
+    return fmt::format(" - Timeframe memory: vector capacity {:.2f} MB kept from the previous TF, {:.2f} MB at the end of this TF, {:.2f} MB released (shrunk) during this TF, {} vectors reused, {} reallocated",
+                       memStats.startBytes / MB, memStats.currentBytes / MB, memStats.releasedBytes / MB, memStats.nKept, memStats.nReleased);
+  }
+  return fmt::format(" - Timeframe memory: vector capacity {:.2f} MB at the end of this TF, {:.2f} MB released during this TF, {} vectors reallocated (memory reuse disabled)",
+                     memStats.currentBytes / MB, memStats.releasedBytes / MB, memStats.nReleased);
+}
+
 void Tracker::getGlobalConfiguration()
 {
   auto& tc = o2::its::TrackerParamConfig::Instance();
@@ -490,6 +512,9 @@ void Tracker::getGlobalConfiguration()
     mTraits->setCorrType(o2::base::PropagatorImpl<float>::MatCorrType::USEMatCorrLUT);
   }
   setNThreads(tc.nThreads);
+  if (mTimeFrame) {
+    mTimeFrame->setReuseMemory(tc.reuseTFMemory, tc.tfMemoryShrinkFactor);
+  }
   int nROFsPerIterations = tc.nROFsPerIterations > 0 ? tc.nROFsPerIterations : -1;
   if (tc.nOrbitsPerIterations > 0) {
     /// code to be used when the number of ROFs per orbit is known, this gets priority over the number of ROFs per iteration
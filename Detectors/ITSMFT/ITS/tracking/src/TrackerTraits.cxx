@@ -245,7 +245,13 @@ void TrackerTraits::computeLayerTracklets(const int iteration, int iROFslice, in
   /// Create tracklets labels
   if (tf->hasMCinformation()) {
     for (int iLayer{0}; iLayer < mTrkParams[iteration].TrackletsPerRoad(); ++iLayer) {
-      for (auto& trk : tf->getTracklets()[iLayer]) {
+      const auto& tracklets{tf->getTracklets()[iLayer]};
+      auto& labels{tf->getTrackletsLabel(iLayer)};
+      const int offset{static_cast<int>(labels.size())};
+      labels.resize(offset + tracklets.size());
+#pragma omp parallel for num_threads(mNThreads)
+      for (int iTracklet = 0; iTracklet < static_cast<int>(tracklets.size()); ++iTracklet) {
+        const Tracklet& trk{tracklets[iTracklet]};
         MCCompLabel label;
         int currentId{tf->getClusters()[iLayer][trk.firstClusterIndex].clusterId};
         int nextId{tf->getClusters()[iLayer + 1][trk.secondClusterIndex].clusterId};
@@ -260,7 +266,7 @@ void TrackerTraits::computeLayerTracklets(const int iteration, int iROFslice, in
             break;
           }
         }
-        tf->getTrackletsLabel(iLayer).emplace_back(label);
+        labels[offset + iTracklet] = label;
       }
     }
   }
@@ -272,7 +272,13 @@ void VertexerTraits::computeTracklets(const int iteration)
 
   /// Create tracklets labels for L0-L1, information is as flat as in tracklets vector (no rofId)
   if (mTimeFrame->hasMCinformation()) {
-    for (auto& trk : mTimeFrame->getTracklets()[0]) {
+    const auto& tracklets{mTimeFrame->getTracklets()[0]};
+    auto& labels{mTimeFrame->getTrackletsLabel(0)};
+    const int offset{static_cast<int>(labels.size())};
+    labels.resize(offset + tracklets.size());
+#pragma omp parallel for num_threads(mNThreads)
+    for (int iTracklet = 0; iTracklet < static_cast<int>(tracklets.size()); ++iTracklet) {
+      const Tracklet& trk{tracklets[iTracklet]};
       MCCompLabel label;
       int sortedId0{mTimeFrame->getSortedIndex(trk.rof[0], 0, trk.firstClusterIndex)};
       int sortedId1{mTimeFrame->getSortedIndex(trk.rof[1], 1, trk.secondClusterIndex)};
@@ -287,7 +293,7 @@ void VertexerTraits::computeTracklets(const int iteration)
           break;
         }
       }
-      mTimeFrame->getTrackletsLabel(0).emplace_back(label);
+      labels[offset + iTracklet] = label;
     }
   }
 
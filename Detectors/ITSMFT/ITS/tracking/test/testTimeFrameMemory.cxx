@@ -0,0 +1,142 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file testTimeFrameMemory.cxx
+/// \brief check the reuse and shrink policy of the TimeFrame vectors cleared from TF to TF
+
+#define BOOST_TEST_MODULE Test ITS TimeFrame memory
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include <vector>
+#include "ITStracking/TimeFrame.h"
+
+using namespace o2::its;
+
+namespace
+{
+class TimeFrameMemory : public TimeFrame
+{
+ public:
+  using TimeFrame::deepVectorClear;
+};
+} // namespace
+
+BOOST_AUTO_TEST_CASE(TimeFrame_reuse_keeps_capacity)
+{
+  TimeFrameMemory tf;
+  tf.setReuseMemory(true, 2.f);
+  tf.resetMemoryStats();
+
+  std::vector<int> vec(1000);
+  tf.deepVectorClear(vec);
+  BOOST_CHECK(vec.empty());
+  BOOST_CHECK_EQUAL(vec.capacity(), 1000);
+
+  // at the shrink threshold the capacity is still kept
+  std::vector<int> limit;
+  limit.reserve(2000);
+  limit.resize(1000);
+  tf.deepVectorClear(limit);
+  BOOST_CHECK_EQUAL(limit.capacity(), 2000);
+
+  // inner vectors keep their capacity as well
+  std::vector<std::vector<int>> nested(3, std::vector<int>(100));
+  tf.deepVectorClear(nested);
+  BOOST_CHECK_EQUAL(nested.size(), 3);
+  for (const auto& v : nested) {
+    BOOST_CHECK(v.empty());
+    BOOST_CHECK_EQUAL(v.capacity(), 100);
+  }
+
+  // vectors without capacity are neither reused nor reallocated
+  std::vector<int> unused;
+  tf.deepVectorClear(unused);
+
+  const auto stats = tf.getMemoryStats();
+  BOOST_CHECK_EQUAL(stats.nKept, 6);
+  BOOST_CHECK_EQUAL(stats.nReleased, 0);
+  BOOST_CHECK_EQUAL(stats.releasedBytes, 0);
+}
+
+BOOST_AUTO_TEST_CASE(TimeFrame_reuse_shrinks_capacity)
+{
+  TimeFrameMemory tf;
+  for (const float shrinkFactor : {1.f, 2.f, 4.f}) {
+    tf.setReuseMemory(true, shrinkFactor);
+    tf.resetMemoryStats();
+
+    // capacity above shrinkFactor times the used size is released
+    const size_t size{1000}, capacity = shrinkFactor * size + 1;
+    std::vector<int> large;
+    large.reserve(capacity);
+    large.resize(size);
+    const size_t releasedBytes{large.capacity() * sizeof(int)};
+    tf.deepVectorClear(large);
+    BOOST_CHECK(large.empty());
+    BOOST_CHECK_EQUAL(large.capacity(), 0);
+
+    // while the one within the limit is kept
+    std::vector<int> small;
+    small.reserve(shrinkFactor * size);
+    small.resize(size);
+    tf.deepVectorClear(small);
+    BOOST_CHECK_EQUAL(small.capacity(), size_t(shrinkFactor * size));
+
+    const auto stats = tf.getMemoryStats();
+    BOOST_CHECK_EQUAL(stats.nKept, 1);
+    BOOST_CHECK_EQUAL(stats.nReleased, 1);
+    BOOST_CHECK_EQUAL(stats.releasedBytes, releasedBytes);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TimeFrame_no_reuse_releases_capacity)
+{
+  TimeFrameMemory tf;
+  tf.setReuseMemory(false);
+  tf.resetMemoryStats();
+
+  std::vector<int> vec(1000);
+  std::vector<std::vector<int>> nested(3, std::vector<int>(100));
+  tf.deepVectorClear(vec);
+  tf.deepVectorClear(nested);
+  BOOST_CHECK_EQUAL(vec.capacity(), 0);
+  BOOST_CHECK_EQUAL(nested.capacity(), 0);
+
+  const auto stats = tf.getMemoryStats();
+  BOOST_CHECK_EQUAL(stats.nKept, 0);
+  BOOST_CHECK_EQUAL(stats.nReleased, 5);
+  BOOST_CHECK_EQUAL(stats.releasedBytes, (1000 + 3 * 100) * sizeof(int) + 3 * sizeof(std::vector<int>));
+}
+
+BOOST_AUTO_TEST_CASE(TimeFrame_memory_stats)
+{
+  TimeFrameMemory tf;
+  tf.setReuseMemory(true);
+  tf.mIndexTables.assign(2, std::vector<int>(500));
+  tf.resetMemoryStats();
+  const auto start = tf.getMemoryStats();
+  BOOST_CHECK_EQUAL(start.startBytes, start.currentBytes);
+  BOOST_CHECK_GE(start.startBytes, 2 * 500 * sizeof(int));
+  BOOST_CHECK_EQUAL(start.nKept + start.nReleased, 0);
+
+  // the capacity of the reused TF vectors stays with the TimeFrame
+  tf.deepVectorClear(tf.mIndexTables);
+  const auto reused = tf.getMemoryStats();
+  BOOST_CHECK_EQUAL(reused.currentBytes, start.startBytes);
+  BOOST_CHECK_EQUAL(reused.nKept, 3);
+
+  tf.setReuseMemory(false);
+  tf.deepVectorClear(tf.mIndexTables);
+  const auto released = tf.getMemoryStats();
+  BOOST_CHECK_EQUAL(released.currentBytes + released.releasedBytes, start.startBytes);
+}
@@ -19,6 +19,7 @@
 
 #include "Framework/DataProcessorSpec.h"
 #include "Framework/Task.h"
+#include "DPLUtils/RootTreeBulkReader.h"
 #include "Headers/DataHeader.h"
 #include "DataFormatsITS/TrackITS.h"
 #include "SimulationDataFormat/MCCompLabel.h"
@@ -44,13 +45,8 @@ class TrackReader : public o2::framework::Task
  protected:
   void connectTree(const std::string& filename);
 
-  std::vector<o2::itsmft::ROFRecord> mROFRec, *mROFRecInp = &mROFRec;
-  std::vector<o2::itsmft::ROFRecord> mVerticesROFRec, *mVerticesROFRecInp = &mVerticesROFRec;
-  std::vector<o2::its::TrackITS> mTracks, *mTracksInp = &mTracks;
-  std::vector<Vertex> mVertices, *mVerticesInp = &mVertices;
-  std::vector<int> mClusInd, *mClusIndInp = &mClusInd;
-  std::vector<o2::MCCompLabel> mMCTruth, *mMCTruthInp = &mMCTruth;
-  std::vector<o2::MCCompLabel> mMCVertTruth, *mMCVTruthInp = &mMCTruth;
+  template <typename T>
+  void publish(o2::framework::ProcessingContext& pc, const o2::framework::Output& output, const std::string& branchName);
 
   o2::header::DataOrigin mOrigin = o2::header::gDataOriginITS;
 
@@ -58,6 +54,7 @@ class TrackReader : public o2::framework::Task
 
   std::unique_ptr<TFile> mFile;
   std::unique_ptr<TTree> mTree;
+  std::unique_ptr<o2::framework::RootTreeBulkReader> mReader;
   std::string mInputFileName = "";
   std::string mTrackTreeName = "o2sim";
   std::string mROFBranchName = "ITSTracksROF";
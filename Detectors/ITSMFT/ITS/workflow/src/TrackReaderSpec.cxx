@@ -40,28 +40,41 @@ void TrackReader::init(InitContext& ic)
 
 void TrackReader::run(ProcessingContext& pc)
 {
-  auto ent = mTree->GetReadEntry() + 1;
-  assert(ent < mTree->GetEntries()); // this should not happen
-  mTree->GetEntry(ent);
-  LOG(info) << "Pushing " << mTracks.size() << " track in " << mROFRec.size() << " ROFs at entry " << ent;
-  pc.outputs().snapshot(Output{mOrigin, "ITSTrackROF", 0}, mROFRec);
-  pc.outputs().snapshot(Output{mOrigin, "TRACKS", 0}, mTracks);
-  pc.outputs().snapshot(Output{mOrigin, "TRACKCLSID", 0}, mClusInd);
-  pc.outputs().snapshot(Output{"ITS", "VERTICES", 0}, mVertices);
-  pc.outputs().snapshot(Output{"ITS", "VERTICESROF", 0}, mVerticesROFRec);
+  auto ent = mReader->getReadEntry() + 1;
+  assert(ent < mReader->getNEntries()); // this should not happen
+  mReader->readEntry(ent);
+  const auto& tracks = mReader->get<std::vector<o2::its::TrackITS>>(mTrackBranchName);
+  const auto& rofs = mReader->get<std::vector<o2::itsmft::ROFRecord>>(mROFBranchName);
+  LOG(info) << "Pushing " << tracks.size() << " track in " << rofs.size() << " ROFs at entry " << ent;
+  publish<std::vector<o2::itsmft::ROFRecord>>(pc, Output{mOrigin, "ITSTrackROF", 0}, mROFBranchName);
+  publish<std::vector<o2::its::TrackITS>>(pc, Output{mOrigin, "TRACKS", 0}, mTrackBranchName);
+  publish<std::vector<int>>(pc, Output{mOrigin, "TRACKCLSID", 0}, mClusIdxBranchName);
+  publish<std::vector<Vertex>>(pc, Output{"ITS", "VERTICES", 0}, mVertexBranchName);
+  publish<std::vector<o2::itsmft::ROFRecord>>(pc, Output{"ITS", "VERTICESROF", 0}, mVertexROFBranchName);
   if (mUseMC) {
-    pc.outputs().snapshot(Output{mOrigin, "TRACKSMCTR", 0}, mMCTruth);
-    pc.outputs().snapshot(Output{mOrigin, "VERTICESMCTR", 0}, mMCVertTruth);
+    publish<std::vector<o2::MCCompLabel>>(pc, Output{mOrigin, "TRACKSMCTR", 0}, mTrackMCTruthBranchName);
+    RootTreeBulkReader::publishEmpty<std::vector<o2::MCCompLabel>>(pc, Output{mOrigin, "VERTICESMCTR", 0});
   }
 
-  if (mTree->GetReadEntry() + 1 >= mTree->GetEntries()) {
+  if (mReader->isLastEntry()) {
     pc.services().get<ControlService>().endOfStream();
     pc.services().get<ControlService>().readyToQuit(QuitRequest::Me);
   }
 }
 
+template <typename T>
+void TrackReader::publish(ProcessingContext& pc, const Output& output, const std::string& branchName)
+{
+  if (mReader->hasBranch(branchName)) {
+    mReader->publish<T>(pc, output, branchName);
+  } else {
+    RootTreeBulkReader::publishEmpty<T>(pc, output);
+  }
+}
+
 void TrackReader::connectTree(const std::string& filename)
 {
+  mReader.reset(nullptr);
   mTree.reset(nullptr); // in case it was already loaded
   mFile.reset(TFile::Open(filename.c_str()));
   assert(mFile && !mFile->IsZombie());
@@ -69,24 +82,19 @@ void TrackReader::connectTree(const std::string& filename)
   assert(mTree);
   assert(mTree->GetBranch(mROFBranchName.c_str()));
 
-  mTree->SetBranchAddress(mROFBranchName.c_str(), &mROFRecInp);
-  mTree->SetBranchAddress(mTrackBranchName.c_str(), &mTracksInp);
-  mTree->SetBranchAddress(mClusIdxBranchName.c_str(), &mClusIndInp);
-  if (!mTree->GetBranch(mVertexBranchName.c_str())) {
+  mReader = std::make_unique<RootTreeBulkReader>(mTree.get());
+  mReader->addBranch<std::vector<o2::itsmft::ROFRecord>>(mROFBranchName);
+  mReader->addBranch<std::vector<o2::its::TrackITS>>(mTrackBranchName);
+  mReader->addBranch<std::vector<int>>(mClusIdxBranchName);
+  if (!mReader->addBranch<std::vector<Vertex>>(mVertexBranchName, true)) {
     LOG(warning) << "No " << mVertexBranchName << " branch in " << mTrackTreeName << " -> vertices will be empty";
-  } else {
-    mTree->SetBranchAddress(mVertexBranchName.c_str(), &mVerticesInp);
   }
-  if (!mTree->GetBranch(mVertexROFBranchName.c_str())) {
+  if (!mReader->addBranch<std::vector<o2::itsmft::ROFRecord>>(mVertexROFBranchName, true)) {
     LOG(warning) << "No " << mVertexROFBranchName << " branch in " << mTrackTreeName
                  << " -> vertices ROFrecords will be empty";
-  } else {
-    mTree->SetBranchAddress(mVertexROFBranchName.c_str(), &mVerticesROFRecInp);
   }
   if (mUseMC) {
-    if (mTree->GetBranch(mTrackMCTruthBranchName.c_str())) {
-      mTree->SetBranchAddress(mTrackMCTruthBranchName.c_str(), &mMCTruthInp);
-    } else {
+    if (!mReader->addBranch<std::vector<o2::MCCompLabel>>(mTrackMCTruthBranchName, true)) {
       LOG(warning) << "MC-truth is missing, message will be empty";
     }
   }
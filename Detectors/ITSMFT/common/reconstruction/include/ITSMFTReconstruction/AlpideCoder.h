@@ -12,8 +12,10 @@
 #ifndef ALICEO2_ITSMFT_ALPIDE_CODER_H
 #define ALICEO2_ITSMFT_ALPIDE_CODER_H
 #include <Rtypes.h>
+#include <array>
 #include <cstdio>
 #include <cstdint>
+#include <cstring>
 #include <vector>
 #include <string>
 #include <cstdint>
@@ -96,6 +98,17 @@ class AlpideCoder
   static constexpr uint32_t MaskTimeStamp = 0xff;                 // Time stamps as BUNCH_COUNTER[10:3] bits
   static constexpr uint32_t MaskReserved = 0xff;                  // mask for reserved byte
   static constexpr uint32_t MaskHitMap = 0x7f;                    // mask for hit map: at most 7 hits in bits (0:6)
+
+  struct HitMapExpansion {             // extra hits encoded in the DATALONG hit map, relative to the row of the reference pixel
+    uint8_t nLeft = 0;                 // number of extra hits in the left column
+    uint8_t nRight = 0;                // number of extra hits in the right column
+    uint8_t lastAddrOffset = 0;        // address offset of the last hit, used for the range check
+    uint8_t leftRow[HitMapSize] = {};  // row offsets of the left column hits, in decoding order
+    uint8_t rightRow[HitMapSize] = {}; // row offsets of the right column hits, in decoding order
+  };
+  // expansion for every phase of the pixel address (pixID & 0x3) and hit map: index is (phase << HitMapSize) | hitmap
+  using HitMapTable = std::array<HitMapExpansion, 4 * (MaskHitMap + 1)>;
+
   //
   // flags for data records
   static constexpr uint32_t REGION = 0xc0;      // flag for region
@@ -463,6 +476,142 @@ class AlpideCoder
     return chipData.getData().size();
   }
 
+  /// decode alpide data for the next non-empty chip from the buffer, same as decodeChip but
+  /// working directly on the buffer pointer, expanding the DATALONG hit maps with a precomputed
+  /// table and skipping the 0-padding between the chips 8 bytes at a time.
+  /// Only the regular data flow is handled here: anything which would raise an error or
+  /// warning flag (BUSY, APE, RO flags, repeated pixels, truncated data...) is delegated
+  /// to decodeChip, restarting from the position the call started at, so the result is always identical.
+  template <class T, typename CG>
+  static int decodeChipFast(ChipPixelData& chipData, T& buffer, std::vector<uint16_t>& seenChips, CG cidGetter)
+  {
+    const auto& hitMapTable = getHitMapTable();
+    uint8_t* const start = buffer.getPtr();
+    const uint8_t* const end = buffer.getEnd();
+    uint8_t* ptr = start;
+    const size_t nSeenChips = seenChips.size();
+    auto fallback = [&]() {
+      buffer.setPtr(start);
+      seenChips.resize(nSeenChips);
+      return decodeChip(chipData, buffer, seenChips, cidGetter);
+    };
+
+    uint16_t region = 0, rowPrev = 0xffff, colDPrev = 0xffff;
+    int nRightCHits = 0;               // counter for the hits in the right column of the current double column
+    std::uint16_t rightColHits[NRows]; // buffer for the accumulation of hits in the right column
+
+    uint32_t expectInp = ExpectNextChip; // data must always start with chip header or chip empty flag
+
+    chipData.clear();
+    while (ptr < end) {
+      uint8_t dataC = *ptr++;
+
+      if (expectInp == ExpectNextChip) {
+        if (!dataC) {
+          ptr = skipPadding(ptr, end);
+          continue;
+        }
+        bool empty = isChipEmpty(dataC);
+        if (!empty && !isChipHeader(dataC)) {
+          return fallback();
+        }
+        uint16_t chipIDGlo = cidGetter(dataC & MaskChipID);
+        if (chipIDGlo == 0xffff || ptr == end) {
+          return fallback();
+        }
+        ptr++; // timestamp
+        chipData.setChipID(chipIDGlo);
+        if (empty) {
+          seenChips.push_back(chipIDGlo);
+          chipData.resetChipID();
+        } else {
+          expectInp = ExpectRegion;
+        }
+        continue;
+      }
+
+      if ((expectInp & ExpectRegion) && (dataC & REGION_MASK) == REGION) {
+        region = dataC & MaskRegion;
+        expectInp = ExpectData;
+        continue;
+      }
+
+      if ((expectInp & ExpectChipTrailer) && isChipTrailer(dataC)) {
+        if (dataC & MaskROFlags) {
+          return fallback();
+        }
+        expectInp = ExpectNextChip;
+        chipData.setROFlags(0);
+        if (nRightCHits) {
+          colDPrev++;
+          for (int ihr = 0; ihr < nRightCHits; ihr++) {
+            addHit(chipData, rightColHits[ihr], colDPrev);
+          }
+        }
+        break;
+      }
+
+      if (!(expectInp & ExpectData) || !isData(dataC) || ptr == end) {
+        return fallback();
+      }
+      uint16_t dataS = (uint16_t(dataC) << 8) | *ptr++;
+      uint16_t dColID = (dataS & MaskEncoder) >> 10;
+      uint16_t pixID = dataS & MaskPixID;
+      uint16_t row = pixID >> 1;
+      uint16_t colD = (region * NDColInReg + dColID) << 1;
+      bool rightC = (row ^ pixID) & 0x1; // true for right column / false for left
+
+      if (colD == colDPrev) {
+        if (row <= rowPrev) { // repeated pixel or decreasing row
+          return fallback();
+        }
+      } else {
+        if (colD < colDPrev && colDPrev != 0xffff) {
+          return fallback();
+        }
+        colDPrev++;
+        for (int ihr = 0; ihr < nRightCHits; ihr++) {
+          addHit(chipData, rightColHits[ihr], colDPrev);
+        }
+        nRightCHits = 0;
+      }
+      rowPrev = row;
+      colDPrev = colD;
+
+      if (rightC) {
+        rightColHits[nRightCHits++] = row;
+      } else {
+        addHit(chipData, row, colD);
+      }
+
+      if ((dataS & (~MaskDColID)) == DATALONG) {
+        if (ptr == end || (*ptr & (~MaskHitMap))) {
+          return fallback();
+        }
+        const auto& hitMap = hitMapTable[((pixID & 0x3) << HitMapSize) | *ptr++];
+        if (pixID + hitMap.lastAddrOffset > MaskPixID) {
+          return fallback();
+        }
+        for (int ih = 0; ih < hitMap.nLeft; ih++) {
+          addHit(chipData, row + hitMap.leftRow[ih], colD);
+        }
+        for (int ih = 0; ih < hitMap.nRight; ih++) {
+          rightColHits[nRightCHits++] = row + hitMap.rightRow[ih];
+        }
+      }
+      expectInp = ExpectChipTrailer | ExpectData | ExpectRegion;
+    }
+
+    if (expectInp != ExpectNextChip) {
+      return fallback();
+    }
+    buffer.setPtr(ptr);
+    if (chipData.getData().size()) {
+      seenChips.push_back(chipData.getChipID());
+    }
+    return chipData.getData().size();
+  }
+
   /// Verifies the decoder by comparing the contents a cable by re-encoding seen
   /// chips back into the ALPIDE format.
   template <typename LG, typename CG>
@@ -845,6 +994,26 @@ class AlpideCoder
 
   void resetMap();
 
+  /// table for the expansion of the DATALONG hit maps
+  static const HitMapTable& getHitMapTable();
+
+  /// skip 0-padding, checking 8 bytes at a time
+  static uint8_t* skipPadding(uint8_t* ptr, const uint8_t* end)
+  {
+    uint64_t word = 0;
+    while (ptr + sizeof(word) <= end) {
+      std::memcpy(&word, ptr, sizeof(word));
+      if (word) {
+        break;
+      }
+      ptr += sizeof(word);
+    }
+    while (ptr < end && !*ptr) {
+      ptr++;
+    }
+    return ptr;
+  }
+
   ///< error message on unexpected EOF
   static int unexpectedEOF(const std::string& message)
   {
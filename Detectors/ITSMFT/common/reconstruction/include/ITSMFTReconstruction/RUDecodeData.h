@@ -69,7 +69,7 @@ struct RUDecodeData {
   }
   void setROFInfo(ChipPixelData* chipData, const GBTLink* lnk);
   template <class Mapping>
-  int decodeROF(const Mapping& mp, const o2::InteractionRecord ir, bool verifyDecoder);
+  int decodeROF(const Mapping& mp, const o2::InteractionRecord ir, bool verifyDecoder, bool fastDecoder = false);
   void fillChipStatistics(int icab, const ChipPixelData* chipData);
   void dumpcabledata(int icab);
   bool checkLinkInSync(int icab, const o2::InteractionRecord ir);
@@ -79,7 +79,7 @@ struct RUDecodeData {
 ///_________________________________________________________________
 /// decode single readout frame, the cable's data must be filled in advance via GBTLink::collectROFCableData
 template <class Mapping>
-int RUDecodeData::decodeROF(const Mapping& mp, const o2::InteractionRecord ir, bool verifyDecoder)
+int RUDecodeData::decodeROF(const Mapping& mp, const o2::InteractionRecord ir, bool verifyDecoder, bool fastDecoder)
 {
   nChipsFired = 0;
   lastChipChecked = 0;
@@ -116,7 +116,11 @@ int RUDecodeData::decodeROF(const Mapping& mp, const o2::InteractionRecord ir, b
       seenChipIDsPtr = &seenChipIDsInCable;
       seenChips.clear();
     }
-    while ((ret = AlpideCoder::decodeChip(*chipData, cableData[icab], *seenChipIDsPtr, chIdGetter)) || chipData->isErrorSet()) { // we register only chips with hits or errors flags set
+    auto decodeChip = [&]() {
+      return fastDecoder ? AlpideCoder::decodeChipFast(*chipData, cableData[icab], *seenChipIDsPtr, chIdGetter)
+                         : AlpideCoder::decodeChip(*chipData, cableData[icab], *seenChipIDsPtr, chIdGetter);
+    };
+    while ((ret = decodeChip()) || chipData->isErrorSet()) { // we register only chips with hits or errors flags set
       setROFInfo(chipData, cableLinkPtr[icab]);
       if (verifyDecoder) {
         auto ID = chipData->getChipID();
@@ -113,6 +113,9 @@ class RawPixelDecoder final : public PixelReader
   void setVerifyDecoder(bool v) { mVerifyDecoder = v; }
   bool getVerifyDecoder() const { return mVerifyDecoder; }
 
+  void setFastAlpideDecoder(bool v) { mFastAlpideDecoder = v; }
+  bool getFastAlpideDecoder() const { return mFastAlpideDecoder; }
+
   void setInstanceID(size_t i) { mInstanceID = i; }
   void setNInstances(size_t n) { mNInstances = n; }
   auto getInstanceID() const { return mInstanceID; }
@@ -167,6 +170,7 @@ class RawPixelDecoder final : public PixelReader
   bool mROFRampUpStage = false;                                                       // are we still in the ROF ramp up stage?
   bool mSkipRampUpData = false;
   bool mVerifyDecoder = false;
+  bool mFastAlpideDecoder = false; // use AlpideCoder::decodeChipFast
   bool mAlwaysParseTrigger = false;
   int mVerbosity = 0;
   int mNThreads = 1; // number of decoding threads
@@ -155,3 +155,32 @@ void AlpideCoder::resetMap()
   mFirstInRow.clear();
   mPix2Encode.clear();
 }
+
+//_____________________________________
+const AlpideCoder::HitMapTable& AlpideCoder::getHitMapTable()
+{
+  // for the hit ip of the map the address is pixID + ip + 1, the row and the column
+  // (left/right) depend only on the 2 lowest bits of the address of the reference pixel
+  static const HitMapTable table = []() {
+    HitMapTable tab{};
+    for (int phase = 0; phase < 4; phase++) {
+      for (uint32_t hitMap = 0; hitMap <= MaskHitMap; hitMap++) {
+        auto& entry = tab[(phase << HitMapSize) | hitMap];
+        for (int ip = 0; ip < HitMapSize; ip++) {
+          if (hitMap & (0x1 << ip)) {
+            int addr = phase + ip + 1, rowOffset = (addr >> 1) - (phase >> 1);
+            bool rightC = (addr ^ (addr >> 1)) & 0x1; // same as for the reference pixel
+            if (rightC) {
+              entry.rightRow[entry.nRight++] = rowOffset;
+            } else {
+              entry.leftRow[entry.nLeft++] = rowOffset;
+            }
+            entry.lastAddrOffset = ip + 1;
+          }
+        }
+      }
+    }
+    return tab;
+  }();
+  return table;
+}
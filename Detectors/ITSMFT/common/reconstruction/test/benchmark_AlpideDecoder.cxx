@@ -0,0 +1,74 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#include <benchmark/benchmark.h>
+#include <random>
+#include <set>
+#include <vector>
+#include "ITSMFTReconstruction/AlpideCoder.h"
+#include "ITSMFTReconstruction/PayLoadCont.h"
+#include "ITSMFTReconstruction/PixelData.h"
+
+using namespace o2::itsmft;
+
+// Cable data with nChips chips with on average nClusters clusters of 1 to 4x4 pixels each
+static PayLoadCont createCableData(int nChips, int nClusters)
+{
+  std::mt19937 gen(1234);
+  std::poisson_distribution<int> nClustersDist(nClusters);
+  std::uniform_int_distribution<int> rowDist(0, AlpideCoder::NRows - 1), colDist(0, AlpideCoder::NCols - 1), sizeDist(1, 4);
+  AlpideCoder coder;
+  PayLoadCont buffer;
+  for (int chip = 0; chip < nChips; chip++) {
+    std::set<std::pair<int, int>> pixels; // sorted in col/row, as the digits
+    int nCl = nClustersDist(gen);
+    for (int icl = 0; icl < nCl; icl++) {
+      int row0 = rowDist(gen), col0 = colDist(gen), size = sizeDist(gen);
+      for (int row = row0; row < std::min(row0 + size, AlpideCoder::NRows); row++) {
+        for (int col = col0; col < std::min(col0 + size, AlpideCoder::NCols); col++) {
+          pixels.emplace(col, row);
+        }
+      }
+    }
+    ChipPixelData chipData;
+    for (const auto& [col, row] : pixels) {
+      chipData.getData().emplace_back(row, col);
+    }
+    buffer.ensureFreeCapacity(40 * 1024 + 3 * pixels.size());
+    coder.encodeChip(buffer, chipData, chip % 9, 0);
+  }
+  return buffer;
+}
+
+template <bool Fast>
+static void BM_DecodeChip(benchmark::State& state)
+{
+  auto buffer = createCableData(90, state.range(0));
+  auto cidGetter = [](int cid) { return uint16_t(cid); };
+  ChipPixelData chipData;
+  std::vector<uint16_t> seenChips;
+  size_t nPixels = 0;
+  for (auto _ : state) {
+    buffer.rewind();
+    seenChips.clear();
+    int ret = 0;
+    while ((ret = Fast ? AlpideCoder::decodeChipFast(chipData, buffer, seenChips, cidGetter) : AlpideCoder::decodeChip(chipData, buffer, seenChips, cidGetter)) > 0) {
+      nPixels += chipData.getData().size();
+    }
+  }
+  benchmark::DoNotOptimize(nPixels);
+  state.SetBytesProcessed(state.iterations() * buffer.getSize());
+}
+
+BENCHMARK_TEMPLATE(BM_DecodeChip, false)->Arg(1)->Arg(10)->Arg(100);
+BENCHMARK_TEMPLATE(BM_DecodeChip, true)->Arg(1)->Arg(10)->Arg(100);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,158 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file testAlpideDecoder.cxx
+/// \brief check that AlpideCoder::decodeChipFast gives the same result as AlpideCoder::decodeChip
+
+#define BOOST_TEST_MODULE Test AlpideDecoder
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <random>
+#include <set>
+#include <vector>
+#include "ITSMFTReconstruction/AlpideCoder.h"
+#include "ITSMFTReconstruction/PayLoadCont.h"
+#include "ITSMFTReconstruction/PixelData.h"
+
+using namespace o2::itsmft;
+
+namespace
+{
+constexpr int NChipsInCable = 9;
+
+/// encode the data of all the chips of a cable, with clusters of fired pixels to have DATALONG records
+void encodeCable(PayLoadCont& buffer, std::mt19937& gen, int nClustersMax)
+{
+  AlpideCoder coder;
+  std::uniform_int_distribution<int> nClustersDist(0, nClustersMax), rowDist(0, AlpideCoder::NRows - 1),
+    colDist(0, AlpideCoder::NCols - 1), sizeDist(1, 4), paddingDist(0, 20);
+  for (int chip = 0; chip < NChipsInCable; chip++) {
+    std::set<std::pair<int, int>> pixels; // sorted in col/row, as the digits
+    int nClusters = nClustersDist(gen);
+    for (int icl = 0; icl < nClusters; icl++) {
+      int row0 = rowDist(gen), col0 = colDist(gen), size = sizeDist(gen);
+      for (int row = row0; row < std::min(row0 + size, AlpideCoder::NRows); row++) {
+        for (int col = col0; col < std::min(col0 + size, AlpideCoder::NCols); col++) {
+          pixels.emplace(col, row);
+        }
+      }
+    }
+    ChipPixelData chipData;
+    for (const auto& [col, row] : pixels) {
+      chipData.getData().emplace_back(row, col);
+    }
+    buffer.ensureFreeCapacity(40 * 1024 + 3 * pixels.size());
+    coder.encodeChip(buffer, chipData, chip, 10 * chip);
+    if (paddingDist(gen) < 3) {
+      buffer.fill(0, paddingDist(gen)); // 0-padding between the chips
+    }
+  }
+}
+
+struct DecodedChip {
+  int ret = 0;
+  uint16_t chipID = 0;
+  uint8_t roFlags = 0;
+  uint64_t errors = 0;
+  uint64_t errorInfo = 0;
+  size_t offset = 0;
+  std::vector<PixelData> pixels;
+};
+
+/// decode the cable in the same way as RUDecodeData::decodeROF does
+std::vector<DecodedChip> decodeCable(PayLoadCont buffer, std::vector<uint16_t>& seenChips, bool fast)
+{
+  std::vector<DecodedChip> decoded;
+  auto cidGetter = [](int cid) { return cid < NChipsInCable ? uint16_t(100 + cid) : uint16_t(0xffff); };
+  ChipPixelData chipData;
+  int ret = 0;
+  while ((ret = fast ? AlpideCoder::decodeChipFast(chipData, buffer, seenChips, cidGetter) : AlpideCoder::decodeChip(chipData, buffer, seenChips, cidGetter)) || chipData.isErrorSet()) {
+    decoded.push_back({ret, chipData.getChipID(), chipData.getROFlags(), chipData.getErrorFlags(), chipData.getErrorInfo(), buffer.getOffset(), chipData.getData()});
+    if (decoded.size() > 10 * NChipsInCable) {
+      break;
+    }
+  }
+  decoded.push_back({ret, chipData.getChipID(), chipData.getROFlags(), chipData.getErrorFlags(), chipData.getErrorInfo(), buffer.getOffset(), chipData.getData()});
+  return decoded;
+}
+
+void compareDecoders(const PayLoadCont& buffer)
+{
+  std::vector<uint16_t> seenRef, seenFast;
+  auto ref = decodeCable(buffer, seenRef, false);
+  auto fast = decodeCable(buffer, seenFast, true);
+  BOOST_REQUIRE_EQUAL(ref.size(), fast.size());
+  for (size_t i = 0; i < ref.size(); i++) {
+    BOOST_CHECK_EQUAL(ref[i].ret, fast[i].ret);
+    BOOST_CHECK_EQUAL(ref[i].chipID, fast[i].chipID);
+    BOOST_CHECK_EQUAL(ref[i].roFlags, fast[i].roFlags);
+    BOOST_CHECK_EQUAL(ref[i].errors, fast[i].errors);
+    BOOST_CHECK_EQUAL(ref[i].errorInfo, fast[i].errorInfo);
+    BOOST_CHECK_EQUAL(ref[i].offset, fast[i].offset);
+    BOOST_REQUIRE_EQUAL(ref[i].pixels.size(), fast[i].pixels.size());
+    for (size_t ip = 0; ip < ref[i].pixels.size(); ip++) {
+      BOOST_CHECK_EQUAL(ref[i].pixels[ip].getRowDirect(), fast[i].pixels[ip].getRowDirect());
+      BOOST_CHECK_EQUAL(ref[i].pixels[ip].getCol(), fast[i].pixels[ip].getCol());
+    }
+  }
+  BOOST_CHECK(seenRef == seenFast);
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(AlpideDecoder_valid_data)
+{
+  std::mt19937 gen(12345);
+  for (int nClustersMax : {0, 1, 10, 100, 1000}) {
+    for (int iter = 0; iter < 20; iter++) {
+      PayLoadCont buffer;
+      encodeCable(buffer, gen, nClustersMax);
+      compareDecoders(buffer);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(AlpideDecoder_corrupted_data)
+{
+  // errors are handled by the reference decoder, check that the fast one falls back to it correctly
+  std::mt19937 gen(54321);
+  for (int iter = 0; iter < 500; iter++) {
+    PayLoadCont buffer;
+    encodeCable(buffer, gen, 20);
+    std::uniform_int_distribution<size_t> posDist(0, buffer.getSize() - 1);
+    std::uniform_int_distribution<int> byteDist(0, 0xff), nFlipsDist(1, 3);
+    int nFlips = nFlipsDist(gen);
+    for (int i = 0; i < nFlips; i++) {
+      buffer[posDist(gen)] = byteDist(gen);
+    }
+    compareDecoders(buffer);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(AlpideDecoder_hitmap_table)
+{
+  // every DATALONG hit map must be expanded as the hits loop of decodeChip does
+  for (int pixID = 0; pixID <= int(AlpideCoder::MaskPixID); pixID++) {
+    for (int hitMap = 0; hitMap <= int(AlpideCoder::MaskHitMap); hitMap++) {
+      PayLoadCont buffer(16);
+      uint16_t dataLong = AlpideCoder::DATALONG | pixID;
+      buffer.addFast(uint8_t(AlpideCoder::CHIPHEADER));
+      buffer.addFast(uint8_t(0));
+      buffer.addFast(uint8_t(AlpideCoder::REGION));
+      buffer.addFast(dataLong);
+      buffer.addFast(uint8_t(hitMap));
+      buffer.addFast(uint8_t(AlpideCoder::CHIPTRAILER));
+      compareDecoders(buffer);
+    }
+  }
+}
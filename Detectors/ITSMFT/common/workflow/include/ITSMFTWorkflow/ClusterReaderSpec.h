@@ -19,6 +19,7 @@
 
 #include "Framework/DataProcessorSpec.h"
 #include "Framework/Task.h"
+#include "DPLUtils/RootTreeBulkReader.h"
 #include "Headers/DataHeader.h"
 #include "DataFormatsITSMFT/CompCluster.h"
 #include "SimulationDataFormat/MCCompLabel.h"
@@ -45,16 +46,11 @@ class ClusterReader : public Task
  protected:
   void connectTree(const std::string& filename);
 
-  std::vector<o2::itsmft::ROFRecord> mClusROFRec, *mClusROFRecPtr = &mClusROFRec;
-  std::vector<o2::itsmft::CompClusterExt> mClusterCompArray, *mClusterCompArrayPtr = &mClusterCompArray;
-  std::vector<unsigned char> mPatternsArray, *mPatternsArrayPtr = &mPatternsArray;
-  o2::dataformats::MCTruthContainer<o2::MCCompLabel> mClusterMCTruth, *mClusterMCTruthPtr = &mClusterMCTruth;
-  std::vector<o2::itsmft::MC2ROFRecord> mClusMC2ROFs, *mClusMC2ROFsPtr = &mClusMC2ROFs;
-
   o2::header::DataOrigin mOrigin = o2::header::gDataOriginInvalid;
 
   std::unique_ptr<TFile> mFile;
   std::unique_ptr<TTree> mTree;
+  std::unique_ptr<RootTreeBulkReader> mReader;
 
   bool mUseMC = true;     // use MC truth
   bool mUsePatterns = true; // send patterns
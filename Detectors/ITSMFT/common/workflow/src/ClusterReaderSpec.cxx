@@ -50,28 +50,32 @@ void ClusterReader::init(InitContext& ic)
 
 void ClusterReader::run(ProcessingContext& pc)
 {
-  auto ent = mTree->GetReadEntry() + 1;
-  assert(ent < mTree->GetEntries()); // this should not happen
-  mTree->GetEntry(ent);
-  LOG(info) << mDetName << "ClusterReader pushes " << mClusROFRec.size() << " ROFRecords,"
-            << mClusterCompArray.size() << " compact clusters at entry " << ent;
+  auto ent = mReader->getReadEntry() + 1;
+  assert(ent < mReader->getNEntries()); // this should not happen
+  mReader->readEntry(ent);
+  LOG(info) << mDetName << "ClusterReader pushes " << mReader->get<std::vector<ROFRecord>>(mDetName + mClusROFBranchName).size() << " ROFRecords,"
+            << mReader->get<std::vector<CompClusterExt>>(mDetName + mClusterCompBranchName).size() << " compact clusters at entry " << ent;
 
   // This is a very ugly way of providing DataDescription, which anyway does not need to contain detector name.
   // To be fixed once the names-definition class is ready
-  pc.outputs().snapshot(Output{mOrigin, "CLUSTERSROF", 0}, mClusROFRec);
-  pc.outputs().snapshot(Output{mOrigin, "COMPCLUSTERS", 0}, mClusterCompArray);
+  mReader->publish<std::vector<ROFRecord>>(pc, Output{mOrigin, "CLUSTERSROF", 0}, mDetName + mClusROFBranchName);
+  mReader->publish<std::vector<CompClusterExt>>(pc, Output{mOrigin, "COMPCLUSTERS", 0}, mDetName + mClusterCompBranchName);
   if (mUsePatterns) {
-    pc.outputs().snapshot(Output{mOrigin, "PATTERNS", 0}, mPatternsArray);
+    if (mReader->hasBranch(mDetName + mClusterPattBranchName)) {
+      mReader->publish<std::vector<unsigned char>>(pc, Output{mOrigin, "PATTERNS", 0}, mDetName + mClusterPattBranchName);
+    } else {
+      RootTreeBulkReader::publishEmpty<std::vector<unsigned char>>(pc, Output{mOrigin, "PATTERNS", 0});
+    }
   }
   if (mUseMC) {
-    pc.outputs().snapshot(Output{mOrigin, "CLUSTERSMCTR", 0}, mClusterMCTruth);
-    pc.outputs().snapshot(Output{mOrigin, "CLUSTERSMC2ROF", 0}, mClusMC2ROFs);
+    mReader->publish<o2::dataformats::MCTruthContainer<o2::MCCompLabel>>(pc, Output{mOrigin, "CLUSTERSMCTR", 0}, mDetName + mClustMCTruthBranchName);
+    mReader->publish<std::vector<MC2ROFRecord>>(pc, Output{mOrigin, "CLUSTERSMC2ROF", 0}, mDetName + mClustMC2ROFBranchName);
   }
   if (mTriggerOut) {
     std::vector<o2::itsmft::PhysTrigger> dummyTrig;
     pc.outputs().snapshot(Output{mOrigin, "PHYSTRIG", 0}, dummyTrig);
   }
-  if (mTree->GetReadEntry() + 1 >= mTree->GetEntries()) {
+  if (mReader->isLastEntry()) {
     pc.services().get<ControlService>().endOfStream();
     pc.services().get<ControlService>().readyToQuit(QuitRequest::Me);
   }
@@ -79,22 +83,26 @@ void ClusterReader::run(ProcessingContext& pc)
 
 void ClusterReader::connectTree(const std::string& filename)
 {
+  mReader.reset(nullptr);
   mTree.reset(nullptr); // in case it was already loaded
   mFile.reset(TFile::Open(filename.c_str()));
   assert(mFile && !mFile->IsZombie());
   mTree.reset((TTree*)mFile->Get(mClusTreeName.c_str()));
   assert(mTree);
 
-  mTree->SetBranchAddress((mDetName + mClusROFBranchName).c_str(), &mClusROFRecPtr);
-  mTree->SetBranchAddress((mDetName + mClusterCompBranchName).c_str(), &mClusterCompArrayPtr);
+  mReader = std::make_unique<RootTreeBulkReader>(mTree.get());
+  mReader->addBranch<std::vector<ROFRecord>>(mDetName + mClusROFBranchName);
+  mReader->addBranch<std::vector<CompClusterExt>>(mDetName + mClusterCompBranchName);
   if (mUsePatterns) {
-    mTree->SetBranchAddress((mDetName + mClusterPattBranchName).c_str(), &mPatternsArrayPtr);
+    if (!mReader->addBranch<std::vector<unsigned char>>(mDetName + mClusterPattBranchName, true)) {
+      LOG(warning) << "No " << mDetName + mClusterPattBranchName << " branch in " << mClusTreeName << " -> patterns will be empty";
+    }
   }
   if (mUseMC) {
     if (mTree->GetBranch((mDetName + mClustMCTruthBranchName).c_str()) &&
         mTree->GetBranch((mDetName + mClustMC2ROFBranchName).c_str())) {
-      mTree->SetBranchAddress((mDetName + mClustMCTruthBranchName).c_str(), &mClusterMCTruthPtr);
-      mTree->SetBranchAddress((mDetName + mClustMC2ROFBranchName).c_str(), &mClusMC2ROFsPtr);
+      mReader->addBranch<o2::dataformats::MCTruthContainer<o2::MCCompLabel>>(mDetName + mClustMCTruthBranchName);
+      mReader->addBranch<std::vector<MC2ROFRecord>>(mDetName + mClustMC2ROFBranchName);
     } else {
       LOG(info) << "MC-truth is missing";
       mUseMC = false;
@@ -108,6 +108,7 @@ void STFDecoder<Mapping>::init(InitContext& ic)
     mDecoder->setRawDumpDirectory(dumpDir);
     mDecoder->setFillCalibData(mDoCalibData);
     mDecoder->setVerifyDecoder(mVerifyDecoder);
+    mDecoder->setFastAlpideDecoder(ic.options().get<bool>("fast-alpide-decoder"));
     bool ignoreRampUp = !ic.options().get<bool>("accept-rof-rampup-data");
     mDecoder->setSkipRampUpData(ignoreRampUp);
   } catch (const std::exception& e) {
@@ -432,6 +433,7 @@ DataProcessorSpec getSTFDecoderSpec(const STFDecoderInp& inp)
       {"nthreads", VariantType::Int, 1, {"Number of decoding/clustering threads"}},
       {"decoder-verbosity", VariantType::Int, 0, {"Verbosity level (-1: silent, 0: errors, 1: headers, 2: data, 3: raw data dump) of 1st lane"}},
       {"always-parse-trigger", VariantType::Bool, false, {"parse trigger word even if flags continuation of old trigger"}},
+      {"fast-alpide-decoder", VariantType::Bool, false, {"use the table driven ALPIDE decoder (same output as the default one)"}},
       {"raw-data-dumps", VariantType::Int, int(GBTLink::RawDataDumps::DUMP_NONE), {"Raw data dumps on error (0: none, 1: HBF for link, 2: whole TF for all links. If negative, dump only on from 1st pipeline."}},
       {"raw-data-dumps-directory", VariantType::String, "", {"Destination directory for the raw data dumps"}},
       {"stop-raw-data-dumps-after-size", VariantType::Int, 1024, {"Stop dumping once this size in MB is accumulated. 0: no limit"}},
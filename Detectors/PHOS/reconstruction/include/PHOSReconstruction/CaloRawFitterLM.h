@@ -0,0 +1,60 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \class CaloRawFitterLM
+/// \brief  Raw data fitting with Levenberg-Marquardt minimization
+///
+/// Extraction of amplitude and time from CALO raw data
+/// with a least square fit of the Gamma2 function
+/// (same shape as in CaloRawFitterGS) using Levenberg-Marquardt
+/// iterations on the samples, without any allocation per channel.
+/// Saturated samples are not fitted, the maximal sample is kept as amplitude.
+///
+
+#ifndef PHOSRAWFITTERLM_H
+#define PHOSRAWFITTERLM_H
+#include "PHOSReconstruction/CaloRawFitter.h"
+
+namespace o2
+{
+
+namespace phos
+{
+
+class CaloRawFitterLM : public CaloRawFitter
+{
+
+ public:
+  static constexpr int NMAXSAMPLES = 40; ///< maximal expected number of samples per bunch
+  /// \brief Constructor
+  CaloRawFitterLM();
+
+  /// \brief Destructor
+  ~CaloRawFitterLM() final = default;
+
+  /// \brief Evaluation Amplitude and TOF
+  FitStatus evaluate(gsl::span<short unsigned int> signal) final;
+
+ protected:
+  FitStatus evalFit(gsl::span<short unsigned int> signal);
+
+ private:
+  short mMinTimeCalc = 10;      ///< minimal sample amplitude to calculate time and amp
+  float mDecTime = 0.058823529; ///< decay time constant
+  int mNiterationsMax = 30;     ///< max number of iterations
+
+  ClassDef(CaloRawFitterLM, 1);
+}; // End of CaloRawFitterLM
+
+} // namespace phos
+
+} // namespace o2
+#endif
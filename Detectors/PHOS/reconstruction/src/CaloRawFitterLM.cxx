@@ -0,0 +1,132 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file CaloRawFitterLM.cxx
+
+#include <algorithm>
+#include <array>
+#include <gsl/span>
+
+#include "MathUtils/fit.h"
+#include "PHOSReconstruction/CaloRawFitterLM.h"
+#include "PHOSBase/PHOSSimParams.h"
+
+using namespace o2::phos;
+CaloRawFitterLM::CaloRawFitterLM() : CaloRawFitter()
+{
+  mDecTime = o2::phos::PHOSSimParams::Instance().mSampleDecayTime;
+}
+
+CaloRawFitterLM::FitStatus CaloRawFitterLM::evaluate(gsl::span<short unsigned int> signal)
+{
+  // Pedestal analysis mode, same as in the default fitter
+  if (mPedestalRun) {
+    return CaloRawFitter::evaluate(signal);
+  }
+
+  mStatus = kNotEvaluated;
+  // Extract amplitude and time
+  mStatus = evalFit(signal);
+  return mStatus;
+}
+
+CaloRawFitterLM::FitStatus CaloRawFitterLM::evalFit(gsl::span<short unsigned int> signal)
+{
+  int nSamples = signal.size();
+  if (nSamples == 0) {
+    mAmp = 0;
+    mTime = 0.;
+    mChi2 = 0.;
+    return kEmptyBunch;
+  }
+  if (nSamples == 1) {
+    mAmp = signal[0];
+    mTime = 0.;
+    mChi2 = 1.;
+    return kOK;
+  }
+
+  mOverflow = false;
+
+  // if pedestal should be subtracted first evaluate it
+  float pedMean = 0;
+  int nPed = 0;
+  if (mPedSubtract) {
+    // remember inverse time order
+    for (auto it = signal.rbegin(); (nPed < mPreSamples) && it != signal.rend(); ++it) {
+      nPed++;
+      pedMean += *it;
+    }
+    if (nPed > 0) {
+      pedMean /= nPed;
+    }
+    nSamples -= mPreSamples;
+    if (nSamples <= 0) { // empty bunch left
+      mAmp = 0;
+      mTime = 0.;
+      mChi2 = 0.;
+      return kEmptyBunch;
+    }
+  }
+
+  // samples in time order, starting with the first sample after the pre-samples
+  std::array<float, NMAXSAMPLES> samples;
+  int n = std::min(nSamples, NMAXSAMPLES - 1);
+  float maxSample = 0.; // maximal sample value
+  int iMax = 0;         // position of the maximal sample
+  int nMax = 0;         // number of consequitive maximal samples
+  for (int i = 0; i < n; i++) {
+    samples[i] = signal[nSamples - 1 - i] - pedMean; // remember inverse order of samples
+    if (samples[i] > maxSample) {
+      maxSample = samples[i];
+      iMax = i;
+      nMax = 1;
+    } else if (samples[i] == maxSample) {
+      nMax++;
+    }
+  }
+
+  // too small amplitude, assing max to max Amp and time to zero and do not calculate height
+  if (maxSample < mMinTimeCalc) {
+    mAmp = maxSample;
+    mTime = 0.;
+    mChi2 = 0.;
+    return kOK;
+  }
+
+  // saturated samples can not be described by the response function, keep the estimate
+  if (maxSample > 900 && nMax >= 3) {
+    mOverflow = true;
+    mAmp = maxSample;
+    mTime = 0.;
+    mChi2 = 900.;
+    return kOverflow;
+  }
+
+  // Gamma2 function 0.25*amp*x^2*exp(2-x), x = k*(t-t0) has its maximum at t0 + 2/k.
+  // The time is the start of the signal, with the first sample at time 1 as in CaloRawFitterGS
+  const double tau = 2. / mDecTime;
+  std::array<double, 2> param{maxSample, double(iMax)};
+  std::array<double, 4> limits{0.5 * maxSample, 2. * maxSample, iMax - 4., iMax + 4.};
+  double chi2 = o2::math_utils::fitGammaPulse(n, samples.data(), 2., tau, param, limits, mNiterationsMax);
+
+  if (chi2 >= 0. && param[0] < 1.2 * maxSample) { // converged and estimated amplitude is not mush larger than Max
+    mAmp = param[0];
+    mTime = param[1] - tau + 1.;
+    mChi2 = chi2 / n;
+    return kOK;
+  } else { // fit failed
+    mAmp = maxSample;
+    mTime = 0; // First count in sample
+    mChi2 = 999.;
+    return kFitFailed;
+  }
+}
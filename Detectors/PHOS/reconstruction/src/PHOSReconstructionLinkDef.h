@@ -17,6 +17,7 @@
 
 #pragma link C++ class o2::phos::CaloRawFitter + ;
 #pragma link C++ class o2::phos::CaloRawFitterGS + ;
+#pragma link C++ class o2::phos::CaloRawFitterLM + ;
 #pragma link C++ class o2::phos::Clusterer + ;
 
 #endif
@@ -0,0 +1,113 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#define BOOST_TEST_MODULE Test PHOS Reconstruction
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "PHOSBase/PHOSSimParams.h"
+#include "PHOSReconstruction/CaloRawFitterGS.h"
+#include "PHOSReconstruction/CaloRawFitterLM.h"
+
+namespace o2
+{
+namespace phos
+{
+
+/// Create the samples of a Gamma2 pulse as in the raw simulation (RawWriter::fillGamma2)
+/// \param amp Amplitude of the pulse
+/// \param time Start of the pulse in time bins, relative to the first sample
+/// \param noise Gaussian noise added to each sample
+std::vector<unsigned short> createPulse(double amp, double time, double noise, std::mt19937& generator)
+{
+  const int nSamples = 30;
+  const double decayTime = PHOSSimParams::Instance().mSampleDecayTime;
+  std::normal_distribution<double> noisedist(0., noise);
+  std::vector<unsigned short> signal(nSamples);
+  for (int i = 0; i < nSamples; i++) {
+    double adc = noise > 0 ? noisedist(generator) : 0.;
+    if (i >= time) {
+      double x = decayTime * (i - time);
+      adc += 0.25 * amp * x * x * std::exp(2. - x);
+    }
+    // samples are stored in reversed time order
+    signal[nSamples - 1 - i] = static_cast<unsigned short>(std::max(std::lround(adc), 0l));
+  }
+  return signal;
+}
+
+BOOST_AUTO_TEST_CASE(CaloRawFitterLM_pulse_test)
+{
+  std::mt19937 generator(1);
+  CaloRawFitterLM fitter;
+  for (auto amp : {50., 300., 800.}) {
+    for (auto time : {0., 0.5, 1.3, 2.7}) {
+      auto signal = createPulse(amp, time, 0., generator);
+      BOOST_CHECK_EQUAL(fitter.evaluate(signal), CaloRawFitter::kOK);
+      BOOST_CHECK_CLOSE(fitter.getAmp(), amp, 1.);
+      // the first sample is at time 1
+      BOOST_CHECK_SMALL(fitter.getTime() - (time + 1.), 0.05);
+      BOOST_CHECK(!fitter.isOverflow());
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(CaloRawFitterLM_special_cases_test)
+{
+  CaloRawFitterLM fitter;
+  std::vector<unsigned short> empty;
+  BOOST_CHECK_EQUAL(fitter.evaluate(empty), CaloRawFitter::kEmptyBunch);
+
+  // below the threshold for the time calculation the maximal sample is kept
+  std::mt19937 generator(2);
+  auto small = createPulse(5., 1., 0., generator);
+  BOOST_CHECK_EQUAL(fitter.evaluate(small), CaloRawFitter::kOK);
+  BOOST_CHECK_EQUAL(fitter.getAmp(), *std::max_element(small.begin(), small.end()));
+  BOOST_CHECK_EQUAL(fitter.getTime(), 0.f);
+
+  // saturated samples are not fitted
+  auto saturated = createPulse(2000., 1., 0., generator);
+  for (auto& adc : saturated) {
+    adc = std::min<unsigned short>(adc, 1000);
+  }
+  BOOST_CHECK_EQUAL(fitter.evaluate(saturated), CaloRawFitter::kOverflow);
+  BOOST_CHECK(fitter.isOverflow());
+  BOOST_CHECK_EQUAL(fitter.getAmp(), 1000.f);
+}
+
+BOOST_AUTO_TEST_CASE(CaloRawFitterLM_compare_GS_test)
+{
+  // compare with the semi-analytic fit of the same Gamma2 shape, for pulses starting in the first time bin,
+  // which are described by the shape of CaloRawFitterGS
+  std::mt19937 generator(3);
+  std::uniform_real_distribution<double> ampdist(50., 800.), timedist(0., 1.);
+  CaloRawFitterLM fitterLM;
+  CaloRawFitterGS fitterGS;
+  const int npulses = 200;
+  int ncompared = 0;
+  for (int ipulse = 0; ipulse < npulses; ipulse++) {
+    auto signal = createPulse(ampdist(generator), timedist(generator), 1., generator);
+    if (fitterLM.evaluate(signal) != CaloRawFitter::kOK || fitterGS.evaluate(signal) != CaloRawFitter::kOK) {
+      continue;
+    }
+    ncompared++;
+    BOOST_CHECK_CLOSE(fitterLM.getAmp(), fitterGS.getAmp(), 1.);
+    BOOST_CHECK_SMALL(fitterLM.getTime() - fitterGS.getTime(), 0.1f);
+  }
+  BOOST_CHECK_GT(ncompared, 0.9 * npulses);
+}
+
+} // namespace phos
+} // namespace o2
@@ -25,6 +25,7 @@
 #include "PHOSBase/PHOSSimParams.h"
 #include "PHOSReconstruction/CaloRawFitter.h"
 #include "PHOSReconstruction/CaloRawFitterGS.h"
+#include "PHOSReconstruction/CaloRawFitterLM.h"
 #include "PHOSReconstruction/RawDecodingError.h"
 #include "PHOSWorkflow/RawToCellConverterSpec.h"
 #include "CommonUtils/VerbosityConfig.h"
@@ -48,6 +49,10 @@ void RawToCellConverterSpec::init(framework::InitContext& ctx)
     LOG(info) << "Using SemiGauss raw fitter";
     mRawFitter = std::unique_ptr<o2::phos::CaloRawFitter>(new o2::phos::CaloRawFitterGS);
   }
+  if (fitmethod == "lm") {
+    LOG(info) << "Using Levenberg-Marquardt raw fitter";
+    mRawFitter = std::unique_ptr<o2::phos::CaloRawFitter>(new o2::phos::CaloRawFitterLM);
+  }
 
   mFillChi2 = (ctx.options().get<std::string>("fillchi2").compare("on") == 0);
   if (mFillChi2) {
@@ -318,7 +323,7 @@ o2::framework::DataProcessorSpec o2::phos::reco_workflow::getRawToCellConverterS
                                           o2::framework::adaptFromTask<o2::phos::reco_workflow::RawToCellConverterSpec>(flpId),
                                           o2::framework::Options{
                                             {"presamples", o2::framework::VariantType::Int, 2, {"presamples time offset"}},
-                                            {"fitmethod", o2::framework::VariantType::String, "default", {"Fit method (default or semigaus)"}},
+                                            {"fitmethod", o2::framework::VariantType::String, "default", {"Fit method (default, semigaus or lm)"}},
                                             {"mappingpath", o2::framework::VariantType::String, "", {"Path to mapping files"}},
                                             {"fillchi2", o2::framework::VariantType::String, "off", {"Fill sample qualities on/off"}},
                                             {"keepHGLG", o2::framework::VariantType::String, "off", {"keep HighGain and Low Gain signals on/off"}},
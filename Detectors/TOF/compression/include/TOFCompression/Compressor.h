@@ -69,6 +69,8 @@ class Compressor
 
   void checkSummary();
   void resetCounters();
+  /** add the counters of another compressor, e.g. to summarise those working in parallel **/
+  void addCounters(const Compressor& other);
 
   void setDecoderCONET(bool val)
   {
@@ -119,6 +121,26 @@ class Compressor
   /** decoder private functions and data members **/
 
   bool decoderParanoid();
+  /** number of consecutive TDC hit words from the given position, words are classified in blocks **/
+  static inline int decoderCountHits(const uint32_t* pointer, const uint32_t* pointerMax)
+  {
+    constexpr int blockSize = 8;
+    auto start = pointer;
+    while (pointer + blockSize <= pointerMax) {
+      uint32_t block = 0xFFFFFFFF;
+      for (int i = 0; i < blockSize; ++i) {
+        block &= pointer[i];
+      }
+      if (!(block & 0x80000000)) {
+        break;
+      }
+      pointer += blockSize;
+    }
+    while (pointer < pointerMax && (*pointer & 0x80000000)) {
+      pointer++;
+    }
+    return pointer - start;
+  };
   inline void decoderRewind() { mDecoderPointer = reinterpret_cast<const uint32_t*>(mDecoderBuffer); };
   inline void decoderNext()
   {
@@ -19,7 +19,7 @@
 
 #include "Framework/Task.h"
 #include "Framework/DataProcessorSpec.h"
-#include "TOFCompression/Compressor.h"
+#include "TOFCompression/ParallelCompressor.h"
 #include <fstream>
 
 using namespace o2::framework;
@@ -39,7 +39,7 @@ class CompressorTask : public Task
   void run(ProcessingContext& pc) final;
 
  private:
-  Compressor<RDH, verbose, paranoid> mCompressor;
+  ParallelCompressor<RDH, verbose, paranoid> mCompressor;
   int mOutputBufferSize;
   long mPayloadLimit = -1;
 };
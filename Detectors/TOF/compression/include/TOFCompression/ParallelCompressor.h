@@ -0,0 +1,83 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// @file   ParallelCompressor.h
+/// @brief  TOF raw data compressor running on several links in parallel
+
+#ifndef O2_TOF_PARALLELCOMPRESSOR
+#define O2_TOF_PARALLELCOMPRESSOR
+
+#include "TOFCompression/Compressor.h"
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace o2
+{
+namespace tof
+{
+
+/** The links (i.e. the CRU links, one per subspec) are independent
+    and are compressed by separate Compressor instances, one per thread.
+    The parts of each link are compressed sequentially in the output buffer
+    of the link, therefore the output is identical to the one obtained
+    with a single compressor. Each compressor holds its own decoder save
+    buffer, which costs 32 MB of memory per thread. **/
+
+template <typename RDH, bool verbose, bool paranoid>
+class ParallelCompressor
+{
+
+ public:
+  using Compressor_t = Compressor<RDH, verbose, paranoid>;
+
+  struct Link {
+    std::vector<std::pair<const char*, long>> parts; /** input payloads and their sizes **/
+    char* buffer = nullptr;                          /** output buffer **/
+    long bufferSize = 0;                             /** output buffer size **/
+    long payloadSize = 0;                            /** output payload size, filled by run **/
+  };
+
+  ParallelCompressor(int nThreads = 1) { setNThreads(nThreads); };
+  ~ParallelCompressor() = default;
+
+  void setNThreads(int n);
+  int getNThreads() const { return mNThreads; };
+
+  /** apply a setting to all compressors, e.g. [](auto& c) { c.setDecoderVerbose(true); } **/
+  template <typename F>
+  void configure(F&& f)
+  {
+    mConfigure = f;
+    for (auto& compressor : mCompressors) {
+      mConfigure(*compressor);
+    }
+  };
+
+  /** compress all links, the links are distributed over the threads **/
+  void run(std::vector<Link>& links);
+
+  /** check summary of the counters of all compressors **/
+  void checkSummary();
+
+ private:
+  void runLink(Compressor_t& compressor, Link& link);
+
+  int mNThreads = 1;
+  std::vector<std::unique_ptr<Compressor_t>> mCompressors;
+  std::function<void(Compressor_t&)> mConfigure = [](Compressor_t&) {};
+};
+
+} // namespace tof
+} // namespace o2
+
+#endif /** O2_TOF_PARALLELCOMPRESSOR **/
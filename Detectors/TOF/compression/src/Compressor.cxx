@@ -775,6 +775,24 @@ bool Compressor<RDH, verbose, paranoid>::processTRMchain(int itrm, int ichain)
     if (nsteps > 99 && !(nsteps % 100)) {
       LOG(debug) << "processTRMchain: nsteps in while loop = " << nsteps << ", infity loop?";
     }
+    /** TDC hits detected in contiguous words, process the whole sequence **/
+    if (!(verbose && mDecoderVerbose) && mDecoderNextWordStep == 0 && IS_TDC_HIT(*mDecoderPointer)) {
+      mDecoderSummary.hasHits[itrm][ichain] = true;
+      auto nhits = decoderCountHits(mDecoderPointer, mDecoderPointerMax);
+      for (int i = 0; i < nhits; ++i, ++mDecoderPointer) {
+        auto itdc = GET_TRMDATAHIT_TDCID(*mDecoderPointer);
+        auto ihit = mDecoderSummary.trmDataHits[ichain][itdc];
+        mDecoderSummary.trmDataHit[ichain][itdc][ihit] = mDecoderPointer;
+        mDecoderSummary.trmDataHits[ichain][itdc]++;
+      }
+      if (nhits > 0) {
+        if (paranoid && decoderParanoid()) {
+          return true;
+        }
+        continue;
+      }
+    }
+
     /** TDC hit detected **/
     if (IS_TDC_HIT(*mDecoderPointer)) {
       mDecoderSummary.hasHits[itrm][ichain] = true;
@@ -1436,6 +1454,35 @@ void Compressor<RDH, verbose, paranoid>::resetCounters()
   }
 }
 
+template <typename RDH, bool verbose, bool paranoid>
+void Compressor<RDH, verbose, paranoid>::addCounters(const Compressor& other)
+{
+  mEventCounter += other.mEventCounter;
+  mFatalCounter += other.mFatalCounter;
+  mErrorCounter += other.mErrorCounter;
+  mDRMCounters.Headers += other.mDRMCounters.Headers;
+  mDRMCounters.EventWordsMismatch += other.mDRMCounters.EventWordsMismatch;
+  mDRMCounters.clockStatus += other.mDRMCounters.clockStatus;
+  mDRMCounters.Fault += other.mDRMCounters.Fault;
+  mDRMCounters.RTOBit += other.mDRMCounters.RTOBit;
+  for (int itrm = 0; itrm < 10; ++itrm) {
+    mTRMCounters[itrm].Headers += other.mTRMCounters[itrm].Headers;
+    mTRMCounters[itrm].Empty += other.mTRMCounters[itrm].Empty;
+    mTRMCounters[itrm].EventCounterMismatch += other.mTRMCounters[itrm].EventCounterMismatch;
+    mTRMCounters[itrm].EventWordsMismatch += other.mTRMCounters[itrm].EventWordsMismatch;
+    mTRMCounters[itrm].EBit += other.mTRMCounters[itrm].EBit;
+    for (int ichain = 0; ichain < 2; ++ichain) {
+      auto& counters = mTRMChainCounters[itrm][ichain];
+      auto& otherCounters = other.mTRMChainCounters[itrm][ichain];
+      counters.Headers += otherCounters.Headers;
+      counters.EventCounterMismatch += otherCounters.EventCounterMismatch;
+      counters.BadStatus += otherCounters.BadStatus;
+      counters.BunchIDMismatch += otherCounters.BunchIDMismatch;
+      counters.TDCerror += otherCounters.TDCerror;
+    }
+  }
+}
+
 template <typename RDH, bool verbose, bool paranoid>
 void Compressor<RDH, verbose, paranoid>::checkSummary()
 {
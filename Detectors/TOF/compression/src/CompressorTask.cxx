@@ -41,11 +41,18 @@ void CompressorTask<RDH, verbose, paranoid>::init(InitContext& ic)
   auto encoderVerbose = ic.options().get<bool>("tof-compressor-encoder-verbose");
   auto checkerVerbose = ic.options().get<bool>("tof-compressor-checker-verbose");
   mOutputBufferSize = ic.options().get<int>("tof-compressor-output-buffer-size");
-
-  mCompressor.setDecoderCONET(decoderCONET);
-  mCompressor.setDecoderVerbose(decoderVerbose);
-  mCompressor.setEncoderVerbose(encoderVerbose);
-  mCompressor.setCheckerVerbose(checkerVerbose);
+  auto nThreads = ic.options().get<int>("tof-compressor-threads");
+
+  mCompressor.setNThreads(nThreads);
+  mCompressor.configure([=](auto& compressor) {
+    compressor.setDecoderCONET(decoderCONET);
+    compressor.setDecoderVerbose(decoderVerbose);
+    compressor.setEncoderVerbose(encoderVerbose);
+    compressor.setCheckerVerbose(checkerVerbose);
+  });
+  if (mCompressor.getNThreads() > 1) {
+    LOG(info) << "Compressor running on " << mCompressor.getNThreads() << " threads";
+  }
 
   auto finishFunction = [this]() {
     mCompressor.checkSummary();
@@ -111,15 +118,24 @@ void CompressorTask<RDH, verbose, paranoid>::run(ProcessingContext& pc)
     //  }
   }
 
+  /** prepare the output message of each subspec, the links are compressed afterwards **/
+  using Link = typename ParallelCompressor<RDH, verbose, paranoid>::Link;
+  std::vector<Link> links;
+  std::vector<o2::header::DataHeader> headers;
+  std::vector<o2::pmr::vector<char>> buffers;
+  links.reserve(subspecPartMap.size());
+  headers.reserve(subspecPartMap.size());
+  buffers.reserve(subspecPartMap.size());
+
   /** loop over subspecs **/
   for (auto& subspecPartEntry : subspecPartMap) {
 
     auto subspec = subspecPartEntry.first;
-    auto parts = subspecPartEntry.second;
+    auto& parts = subspecPartEntry.second;
     auto& firstPart = parts.at(0);
 
     /** use the first part to define output headers **/
-    auto headerOut = *DataRefUtils::getHeader<o2::header::DataHeader*>(firstPart);
+    auto& headerOut = headers.emplace_back(*DataRefUtils::getHeader<o2::header::DataHeader*>(firstPart));
     headerOut.dataDescription = "CRAWDATA";
     headerOut.payloadSize = 0;
     headerOut.splitPayloadParts = 1;
@@ -128,12 +144,14 @@ void CompressorTask<RDH, verbose, paranoid>::run(ProcessingContext& pc)
     auto bufferSize = mOutputBufferSize >= 0 ? mOutputBufferSize + subspecBufferSize[subspec] : std::abs(mOutputBufferSize);
     auto bufferSizeDouble = bufferSize * 2;
     auto output = Output{headerOut.dataOrigin, "CRAWDATA", headerOut.subSpecification};
-    auto&& v = pc.outputs().makeVector<char>(output);
+    auto& v = buffers.emplace_back(pc.outputs().makeVector<char>(output));
     v.resize(bufferSizeDouble);
     // Better way of doing this would be to used an offset, so that we can resize the vector
     // as well. However, this should be good enough because bufferSize overestimates the size
     // of the payload.
-    auto bufferPointer = v.data();
+    auto& link = links.emplace_back();
+    link.buffer = v.data();
+    link.bufferSize = bufferSize;
 
     /** loop over subspec parts **/
     for (const auto& ref : parts) {
@@ -145,25 +163,24 @@ void CompressorTask<RDH, verbose, paranoid>::run(ProcessingContext& pc)
         LOG(error) << "Payload larger than limit (" << mPayloadLimit << "), payload = " << payloadInSize;
         continue;
       }
-
-      /** prepare compressor **/
-      mCompressor.setDecoderBuffer(payloadIn);
-      mCompressor.setDecoderBufferSize(payloadInSize);
-      mCompressor.setEncoderBuffer(bufferPointer);
-      mCompressor.setEncoderBufferSize(bufferSize);
-
-      /** run **/
-      mCompressor.run();
-      auto payloadOutSize = mCompressor.getEncoderByteCounter();
-      bufferPointer += payloadOutSize;
-      bufferSize -= payloadOutSize;
-      headerOut.payloadSize += payloadOutSize;
+      link.parts.emplace_back(payloadIn, payloadInSize);
     }
+  }
+
+  /** run, links are compressed in parallel **/
+  mCompressor.run(links);
 
-    if (headerOut.payloadSize > bufferSizeDouble) {
+  /** loop over subspecs and ship the output **/
+  for (int ilink = 0; ilink < links.size(); ++ilink) {
+    auto& headerOut = headers[ilink];
+    auto& v = buffers[ilink];
+    headerOut.payloadSize = links[ilink].payloadSize;
+
+    if (headerOut.payloadSize > v.size()) {
       headerOut.payloadSize = 0; // put payload to zero, otherwise it will trigger a crash
     }
 
+    auto output = Output{headerOut.dataOrigin, "CRAWDATA", headerOut.subSpecification};
     v.resize(headerOut.payloadSize);
     pc.outputs().adoptContainer(output, std::move(v));
   }
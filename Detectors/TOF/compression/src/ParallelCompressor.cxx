@@ -0,0 +1,110 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// @file   ParallelCompressor.cxx
+/// @brief  TOF raw data compressor running on several links in parallel
+
+#include "TOFCompression/ParallelCompressor.h"
+#include "Headers/RAWDataHeader.h"
+
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+
+namespace o2
+{
+namespace tof
+{
+
+template <typename RDH, bool verbose, bool paranoid>
+void ParallelCompressor<RDH, verbose, paranoid>::setNThreads(int n)
+{
+#ifdef WITH_OPENMP
+  mNThreads = n > 0 ? n : 1;
+#else
+  mNThreads = 1;
+#endif
+  while (mCompressors.size() < mNThreads) {
+    mCompressors.emplace_back(std::make_unique<Compressor_t>());
+    mCompressors.back()->resetCounters();
+    mConfigure(*mCompressors.back());
+  }
+}
+
+template <typename RDH, bool verbose, bool paranoid>
+void ParallelCompressor<RDH, verbose, paranoid>::runLink(Compressor_t& compressor, Link& link)
+{
+  auto bufferPointer = link.buffer;
+  auto bufferSize = link.bufferSize;
+  link.payloadSize = 0;
+
+  /** loop over link parts **/
+  for (const auto& [payloadIn, payloadInSize] : link.parts) {
+
+    /** prepare compressor **/
+    compressor.setDecoderBuffer(payloadIn);
+    compressor.setDecoderBufferSize(payloadInSize);
+    compressor.setEncoderBuffer(bufferPointer);
+    compressor.setEncoderBufferSize(bufferSize);
+
+    /** run **/
+    compressor.run();
+    auto payloadOutSize = compressor.getEncoderByteCounter();
+    bufferPointer += payloadOutSize;
+    bufferSize -= payloadOutSize;
+    link.payloadSize += payloadOutSize;
+  }
+}
+
+template <typename RDH, bool verbose, bool paranoid>
+void ParallelCompressor<RDH, verbose, paranoid>::run(std::vector<Link>& links)
+{
+  if (mNThreads == 1 || links.size() < 2) {
+    for (auto& link : links) {
+      runLink(*mCompressors[0], link);
+    }
+    return;
+  }
+
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNThreads)
+#endif
+  for (int ilink = 0; ilink < links.size(); ++ilink) {
+    int ithread = 0;
+#ifdef WITH_OPENMP
+    ithread = omp_get_thread_num();
+#endif
+    runLink(*mCompressors[ithread], links[ilink]);
+  }
+}
+
+template <typename RDH, bool verbose, bool paranoid>
+void ParallelCompressor<RDH, verbose, paranoid>::checkSummary()
+{
+  if (mCompressors.size() == 1) {
+    mCompressors[0]->checkSummary();
+    return;
+  }
+  Compressor_t summary;
+  summary.resetCounters();
+  for (auto& compressor : mCompressors) {
+    summary.addCounters(*compressor);
+  }
+  summary.checkSummary();
+}
+
+template class ParallelCompressor<o2::header::RAWDataHeader, false, false>;
+template class ParallelCompressor<o2::header::RAWDataHeader, false, true>;
+template class ParallelCompressor<o2::header::RAWDataHeader, true, false>;
+template class ParallelCompressor<o2::header::RAWDataHeader, true, true>;
+
+} // namespace tof
+} // namespace o2
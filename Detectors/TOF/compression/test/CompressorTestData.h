@@ -0,0 +1,96 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file CompressorTestData.h
+/// \brief Synthetic TOF raw data for the compressor test and benchmark
+
+#ifndef O2_TOF_COMPRESSORTESTDATA_H
+#define O2_TOF_COMPRESSORTESTDATA_H
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "Headers/RAWDataHeader.h"
+
+namespace o2
+{
+namespace tof
+{
+
+// raw data of one link: each HBF is one CRU page holding one DRM event with
+// hits randomly distributed over the 10 TRMs, followed by the closing RDH.
+// The words are not padded (TOF-like data format 1), as in the CRU output.
+inline std::vector<char> createLink(int feeId, int nHBF, int nHits)
+{
+  using RDH = o2::header::RAWDataHeader;
+  std::mt19937 generator(feeId);
+  std::uniform_int_distribution<uint32_t> chain(0, 19);
+  std::uniform_int_distribution<uint32_t> tdc(0, 14);
+  std::uniform_int_distribution<uint32_t> channel(0, 7);
+  std::uniform_int_distribution<uint32_t> time(0, 0x1FFFFF);
+
+  std::vector<char> data;
+  std::vector<uint32_t> words;
+  std::vector<uint32_t> hits[20];
+  for (int ihbf = 0; ihbf < nHBF; ++ihbf) {
+    for (auto& chainHits : hits) {
+      chainHits.clear();
+    }
+    for (int ihit = 0; ihit < nHits; ++ihit) {
+      hits[chain(generator)].push_back(0xA0000000 | (tdc(generator) << 24) | (channel(generator) << 21) | time(generator));
+    }
+
+    words.clear();
+    words.push_back(0x40000000); // TOF data header
+    words.push_back(ihbf);       // TOF orbit
+    words.push_back(0x40000001); // DRM data header
+    words.push_back(0x00007FF0); // DRM header words 1-5
+    words.push_back(0x00007FF0);
+    words.push_back(0x00000000);
+    words.push_back(0x00000000);
+    words.push_back(0x00000000);
+    for (uint32_t slotId = 3; slotId < 13; ++slotId) {
+      words.push_back(0x40000000 | slotId); // TRM data header
+      for (uint32_t ichain = 0; ichain < 2; ++ichain) {
+        auto& chainHits = hits[(slotId - 3) * 2 + ichain];
+        words.push_back((ichain == 0 ? 0x00000000 : 0x20000000) | slotId); // TRM chain header
+        words.insert(words.end(), chainHits.begin(), chainHits.end());
+        words.push_back(ichain == 0 ? 0x10000000 : 0x30000000); // TRM chain trailer
+      }
+      words.push_back(0x50000003); // TRM data trailer
+    }
+    words.push_back(0x50000001); // DRM data trailer
+
+    RDH rdh;
+    rdh.feeId = feeId;
+    rdh.orbit = ihbf;
+    rdh.dataFormat = 1;
+    rdh.memorySize = sizeof(RDH) + words.size() * sizeof(uint32_t);
+    rdh.offsetToNext = rdh.memorySize;
+    auto size = data.size();
+    data.resize(size + rdh.memorySize + sizeof(RDH));
+    std::memcpy(data.data() + size, &rdh, sizeof(RDH));
+    std::memcpy(data.data() + size + sizeof(RDH), words.data(), words.size() * sizeof(uint32_t));
+
+    rdh.pageCnt = 1;
+    rdh.stop = 1;
+    rdh.memorySize = sizeof(RDH);
+    rdh.offsetToNext = sizeof(RDH);
+    std::memcpy(data.data() + size + sizeof(RDH) + words.size() * sizeof(uint32_t), &rdh, sizeof(RDH));
+  }
+  return data;
+}
+
+} // namespace tof
+} // namespace o2
+
+#endif
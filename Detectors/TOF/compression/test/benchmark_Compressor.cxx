@@ -0,0 +1,76 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <vector>
+#include "Headers/RAWDataHeader.h"
+#include "TOFCompression/ParallelCompressor.h"
+#include "CompressorTestData.h"
+
+using namespace o2::tof;
+using RDH = o2::header::RAWDataHeader;
+using ParallelCompressor_t = ParallelCompressor<RDH, false, false>;
+
+struct LinkData {
+  std::vector<std::vector<char>> inputs;
+  std::vector<std::vector<char>> outputs;
+  std::vector<ParallelCompressor_t::Link> links;
+  long nBytes = 0;
+
+  LinkData(int nLinks, int nHits)
+  {
+    for (int ilink = 0; ilink < nLinks; ++ilink) {
+      auto& input = inputs.emplace_back(createLink(ilink, 64, nHits));
+      // generous output buffer, the encoder only fills the first quarter of the given size
+      auto& output = outputs.emplace_back(8 * input.size());
+      auto& link = links.emplace_back();
+      link.parts.emplace_back(input.data(), input.size());
+      link.buffer = output.data();
+      link.bufferSize = output.size();
+      nBytes += input.size();
+    }
+  }
+};
+
+// compress the links with the given number of threads; the output must be identical
+// to the one of a single compressor working on the links one after the other
+static void BM_CompressLinks(benchmark::State& state)
+{
+  LinkData data(state.range(0), state.range(2));
+  LinkData reference(state.range(0), state.range(2));
+  ParallelCompressor_t serial(1);
+  serial.run(reference.links);
+
+  ParallelCompressor_t compressor(state.range(1));
+  compressor.run(data.links);
+  for (int ilink = 0; ilink < data.links.size(); ++ilink) {
+    auto& link = data.links[ilink];
+    auto& referenceLink = reference.links[ilink];
+    if (link.payloadSize == 0 || link.payloadSize != referenceLink.payloadSize ||
+        std::memcmp(link.buffer, referenceLink.buffer, link.payloadSize) != 0) {
+      state.SkipWithError("compressed output differs from the serial compressor");
+      return;
+    }
+  }
+
+  for (auto _ : state) {
+    compressor.run(data.links);
+    benchmark::DoNotOptimize(data.links.data());
+  }
+  state.SetBytesProcessed(state.iterations() * data.nBytes);
+}
+
+// links, threads, hits per HBF
+BENCHMARK(BM_CompressLinks)->Args({24, 1, 600})->Args({24, 2, 600})->Args({24, 4, 600})->Args({24, 8, 600})->UseRealTime();
+BENCHMARK(BM_CompressLinks)->Args({1, 1, 100})->Args({1, 1, 600})->Args({1, 1, 1500})->UseRealTime();
+
+BENCHMARK_MAIN();
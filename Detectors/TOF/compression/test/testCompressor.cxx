@@ -0,0 +1,68 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#define BOOST_TEST_MODULE Test TOF Compressor
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include <vector>
+#include "Headers/RAWDataHeader.h"
+#include "TOFCompression/Compressor.h"
+#include "CompressorTestData.h"
+
+namespace o2
+{
+namespace tof
+{
+
+using RDH = o2::header::RAWDataHeader;
+
+/// compress the payload and return the compressed output
+template <bool verbose, bool paranoid>
+std::vector<char> compress(const std::vector<char>& payload)
+{
+  Compressor<RDH, verbose, paranoid> compressor;
+  compressor.resetCounters();
+  compressor.setDecoderVerbose(verbose);
+  // generous output buffer, the encoder only fills the first quarter of the given size
+  std::vector<char> output(8 * payload.size());
+  compressor.setDecoderBuffer(payload.data());
+  compressor.setDecoderBufferSize(payload.size());
+  compressor.setEncoderBuffer(output.data());
+  compressor.setEncoderBufferSize(output.size());
+  compressor.run();
+  output.resize(compressor.getEncoderByteCounter());
+  return output;
+}
+
+// the TDC hits are classified in blocks of words, unless the decoder is verbose,
+// in which case they are decoded one by one: both must give the same output
+BOOST_AUTO_TEST_CASE(Compressor_blockHits)
+{
+  // hits per HBF, spread over the 20 chains: empty chains, runs shorter
+  // and longer than a block and runs with a partial last block
+  for (int nHits : {0, 7, 20, 160, 170, 600}) {
+    auto payload = createLink(nHits, 2, nHits);
+
+    auto blockOutput = compress<false, false>(payload);
+    auto wordOutput = compress<true, false>(payload);
+    BOOST_REQUIRE_GT(blockOutput.size(), 0);
+    BOOST_CHECK_EQUAL_COLLECTIONS(blockOutput.begin(), blockOutput.end(), wordOutput.begin(), wordOutput.end());
+
+    auto blockOutputParanoid = compress<false, true>(payload);
+    auto wordOutputParanoid = compress<true, true>(payload);
+    BOOST_CHECK_EQUAL_COLLECTIONS(blockOutputParanoid.begin(), blockOutputParanoid.end(), wordOutputParanoid.begin(), wordOutputParanoid.end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(blockOutputParanoid.begin(), blockOutputParanoid.end(), blockOutput.begin(), blockOutput.end());
+  }
+}
+
+} // namespace tof
+} // namespace o2
@@ -21,12 +21,12 @@
 #include "DataFormatsTPC/TrackTPC.h"
 #include "TPCBase/CalDet.h"
 #include "TPCCalibration/CalibPadGainTracksBase.h"
+#include "TPCCalibration/PadHistogramStore.h"
 #include "CalibdEdxTrackTopologyPol.h"
 #include "TPCFastTransform.h"
 
 #include <vector>
 #include <gsl/span>
-#include <tuple>
 
 class TCanvas;
 
@@ -69,6 +69,7 @@ class VDriftCorrFact;
 /// cGain.setMomentumRange(.1, 3);
 /// cGain.processTracks();
 /// after looping of the data (filling the histograms) is done
+/// cGain.finalizeHistos(); // add the content of the internal pad histogram store to the pad-by-pad histograms
 /// cGain.fillgainMap(); // fill the gainmap with the truncated mean from each histogram
 /// cGain.dumpGainMap(); // write the gainmap to file
 
@@ -90,16 +91,35 @@ class CalibPadGainTracks : public CalibPadGainTracksBase
   };
 
   /// default constructor
+  /// the values are filled in a dense pad histogram store, the pad-by-pad histograms are only allocated by finalizeHistos()
   /// \param initCalPad initialisation of the calpad for the gain map (if the gainmap is not extracted it can be false to save some memory)
-  CalibPadGainTracks(const bool initCalPad = true) : CalibPadGainTracksBase(initCalPad) { reserveMemory(); }
+  CalibPadGainTracks(const bool initCalPad = true);
 
   /// default destructor
-  ~CalibPadGainTracks() = default;
+  ~CalibPadGainTracks() override = default;
 
   /// processes input tracks and filling the histograms with self calibrated probe qMax/dEdx
+  /// The values are filled in a dense pad histogram store. Call finalizeHistos() to add them to the pad-by-pad histograms
   /// \param nMaxTracks max number of tracks to process (-1 to process all tracks)
   void processTracks(const int nMaxTracks = -1);
 
+  /// initialize the binning of the pad histogram store
+  /// \param nBins number of bins used in the histograms
+  /// \param xmin minimum value in histogram
+  /// \param xmax maximum value in histogram
+  /// \param useUnderflow set usage of underflow bin
+  /// \param useOverflow set usage of overflow bin
+  void init(const unsigned int nBins, const float xmin, const float xmax, const bool useUnderflow, const bool useOverflow) override;
+
+  /// add the content of the pad histogram store to the pad-by-pad histograms, which are allocated if needed, and reset the store
+  void finalizeHistos();
+
+  /// resetting the pad histogram store and freeing the pad-by-pad histograms
+  void resetHistos() override;
+
+  /// \return returns the dense store which is filled during processTracks()
+  const PadHistogramStore& getPadHistogramStore() const { return mPadHistoStore; }
+
   /// set the member variables
   /// \param vTPCTracksArrayInp vector of tpc tracks
   /// \param tpcTrackClIdxVecInput set the TPCClRefElem member variable
@@ -217,6 +237,13 @@ class CalibPadGainTracks : public CalibPadGainTracksBase
   void setTPCCorrMaps(o2::gpu::CorrectionMapsHelper* maph);
 
  private:
+  /// cluster information stored per track until the dE/dx of the track is known
+  struct ClusterInfo {
+    uint32_t pad{};      ///< global pad index in the pad histogram store
+    unsigned char row{}; ///< global pad row
+    float chargeNorm{};  ///< normalized cluster charge
+  };
+
   gsl::span<const TrackTPC>* mTracks{nullptr};                                        ///<! vector containing the tpc tracks which will be processed. Cant be const due to the propagate function
   gsl::span<const TPCClRefElem>* mTPCTrackClIdxVecInput{nullptr};                     ///<! input vector with TPC tracks cluster indicies
   const o2::tpc::ClusterNativeAccess* mClusterIndex{nullptr};                         ///<! needed to access clusternative with tpctracks
@@ -241,7 +268,9 @@ class CalibPadGainTracks : public CalibPadGainTracksBase
   ChargeType mChargeType{ChargeType::Max};                                            ///< charge type which is used for calculating the dE/dx and filling the pad-by-pad histograms
   o2::gpu::CorrectionMapsHelper* mTPCCorrMapsHelper = nullptr;                        ///< cluster corrections map helper
   std::vector<std::vector<float>> mDEdxBuffer{};                                      ///<! memory for dE/dx
-  std::vector<std::tuple<unsigned char, unsigned char, unsigned char, float>> mClTrk; ///<! memory for cluster informations
+  std::vector<ClusterInfo> mClTrk;                                                    ///<! memory for cluster informations
+  std::vector<PadHistogramStore::Entry> mPadEntries;                                  ///<! values of the current track which will be filled in the pad histograms
+  PadHistogramStore mPadHistoStore;                                                   ///<! dense storage of the pad-by-pad histograms
   std::vector<float> mDedxTmp{};                                                      ///<! memory for dE/dx calculation
   std::unique_ptr<CalPad> mGainMapRef;                                                ///<! static Gain map object used for correcting the cluster charge
   std::unique_ptr<CalibdEdxTrackTopologyPol> mCalibTrackTopologyPol;                  ///<! calibration container for the cluster charge
@@ -49,7 +49,11 @@ class CalibPadGainTracksBase
 
   /// constructor
   /// \param initCalPad initialisation of the calpad for the gain map (if the gainmap is not extracted it can be false to save some memory)
-  CalibPadGainTracksBase(const bool initCalPad = true);
+  /// \param initHistos initialisation of the pad-by-pad histograms (derived classes filling a different storage can allocate them when needed)
+  CalibPadGainTracksBase(const bool initCalPad = true, const bool initHistos = true);
+
+  /// default destructor
+  virtual ~CalibPadGainTracksBase() = default;
 
   /// initializing CalPad object for gainmap
   void initCalPadMemory() { mGainMap = std::make_unique<CalPad>("GainMap"); }
@@ -61,7 +65,7 @@ class CalibPadGainTracksBase
   void initCalPadStat() { mNClMap = std::make_unique<CalPad>("NClustersMap"); }
 
   /// copy constructor
-  CalibPadGainTracksBase(const CalibPadGainTracksBase& other) : mPadHistosDet(std::make_unique<DataTHistos>(*other.mPadHistosDet)), mGainMap(std::make_unique<CalPad>(*other.mGainMap)) {}
+  CalibPadGainTracksBase(const CalibPadGainTracksBase& other) : mPadHistosDet(other.mPadHistosDet ? std::make_unique<DataTHistos>(*other.mPadHistosDet) : nullptr), mGainMap(other.mGainMap ? std::make_unique<CalPad>(*other.mGainMap) : nullptr) {}
 
   /// filling the pad-by-pad histograms
   /// \param caldets span of caldets containing pad-by-pad histograms
@@ -90,7 +94,7 @@ class CalibPadGainTracksBase
   /// \param minStDev to exlude outliers (histograms with a very narrow distributions) a min std dev cut is used
   void finalize(const int minEntries = 10, const float minRelgain = 0.1f, const float maxRelgain = 2.f, const float low = 0.05f, const float high = 0.6f, const float minStDev = 0.01);
 
-  /// returns calpad containing pad-by-pad histograms
+  /// returns calpad containing pad-by-pad histograms (nullptr if they are not allocated)
   const auto& getHistos() const { return mPadHistosDet; }
 
   /// \return returns the gainmap object as const reference
@@ -210,21 +214,25 @@ class CalibPadGainTracksBase
   bool getLogTransformQ() const { return mLogTransformQ; }
 
   /// resetting the histograms which are used for extraction of the gain map
-  void resetHistos();
+  virtual void resetHistos();
 
-  /// initialize the histograms with custom parameters
+  /// initialize the histograms with custom parameters (allocates them if needed)
   /// \param nBins number of bins used in the histograms
   /// \param xmin minimum value in histogram
   /// \param xmax maximum value in histogram
   /// \param useUnderflow set usage of underflow bin
   /// \param useOverflow set usage of overflow bin
-  void init(const unsigned int nBins, const float xmin, const float xmax, const bool useUnderflow, const bool useOverflow);
+  virtual void init(const unsigned int nBins, const float xmin, const float xmax, const bool useUnderflow, const bool useOverflow);
 
   /// \param roc numerical ROC value
   /// \param padInROC pad number in ROC
   /// \param val value which is filled in the pad-by-pad histogram
   void fillPadByPadHistogram(const size_t roc, const size_t padInROC, const float val) { mPadHistosDet->getCalArray(roc).getData()[padInROC].fill(val); }
 
+ protected:
+  /// free the memory of the pad-by-pad histograms
+  void releaseHistos() { mPadHistosDet.reset(); }
+
  private:
   std::unique_ptr<DataTHistos> mPadHistosDet; ///< Calibration object containing for each pad a histogram with normalized charge
   std::unique_ptr<CalPad> mGainMap;           ///< Extracted gain map from tracks
@@ -28,6 +28,7 @@
 #include "DataFormatsTPC/CalibdEdxCorrection.h"
 #include "DetectorsBase/Propagator.h"
 #include "CommonUtils/TreeStreamRedirector.h"
+#include "DetectorsCalibration/HistogramShards.h"
 
 // boost includes
 #include <boost/histogram.hpp>
@@ -109,6 +110,19 @@ class CalibdEdx
   /// setting the material type for track propagation
   void setMaterialType(o2::base::Propagator::MatCorrType materialType) { mMatType = materialType; }
 
+  /// \brief Number of threads used to fill the histograms from a span of tracks.
+  /// Each thread fills its own copy of the histogram, the copies are added to the main histogram when it is accessed.
+  /// \note The parallel filling is not used if the track debug output is enabled
+  void setNThreads(int nThreads)
+  {
+    mergeShards();
+    mHistShards.setNThreads(nThreads);
+  }
+  int getNThreads() const { return mHistShards.getNThreads(); }
+
+  /// add the entries filled by the threads to the histogram, done by all functions accessing the full histogram
+  void mergeShards() const { mHistShards.mergeTo(mHist); }
+
   /// Fill histograms using tracks data.
   void fill(const TrackTPC& tracks);
   void fill(const gsl::span<const TrackTPC>);
@@ -130,7 +144,11 @@ class CalibdEdx
   void finalize(const bool useGausFits = true);
 
   /// Return calib data histogram
-  const Hist& getHist() const { return mHist; }
+  const Hist& getHist() const
+  {
+    mergeShards();
+    return mHist;
+  }
   /// Return calib data as a THn
   THnF* getRootHist() const;
 
@@ -199,7 +217,7 @@ class CalibdEdx
   float mSigmaUpper = 1.;        ///< mSigma*sigma_gaus used for cutting electrons in case gaussian fits are performed
   float mSigmaLower = 1.5;       ///< mSigma*sigma_gaus used for cutting electrons in case gaussian fits are performed
 
-  Hist mHist;                     ///<! dEdx multidimensional histogram
+  mutable Hist mHist;             ///<! dEdx multidimensional histogram
   CalibdEdxCorrection mCalib{};   ///< Calibration output
   CalibdEdxCorrection mCalibIn{}; ///< Calibration output
 
@@ -207,8 +225,13 @@ class CalibdEdx
 
   std::unique_ptr<o2::utils::TreeStreamRedirector> mDebugOutputStreamer; ///<! Debug output streamer
 
+  mutable o2::calibration::HistogramShards<Hist> mHistShards; ///<! per thread histograms used for parallel filling, merged into mHist when it is accessed
+
   THnF* getTHnF() const;
 
+  /// fill the data of one track to the passed histogram
+  void fillTrack(Hist& hist, const TrackTPC& track) const;
+
   /// make fits of dEdx as a function of tgl and perform the calibration fit
   void fitHistGaus(TLinearFitter& fitter, CalibdEdxCorrection& corr, const CalibdEdxCorrection* stackMean = nullptr);
 
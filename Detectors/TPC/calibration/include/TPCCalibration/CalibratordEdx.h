@@ -61,6 +61,8 @@ class CalibratordEdx final : public o2::calibration::TimeSlotCalibration<o2::tpc
   void setElectronCut(std::tuple<float, int, float> values) { mElectronCut = values; }
   void setMaterialType(o2::base::Propagator::MatCorrType materialType) { mMatType = materialType; }
   void setMakeGaussianFits(const bool makeGaussianFits) { mMakeGaussianFits = makeGaussianFits; }
+  /// \param nThreads number of threads used to fill the histograms of each time slot
+  void setNThreads(int nThreads) { mNThreads = nThreads; }
 
   /// \brief Check if there are enough data to compute the calibration.
   /// \return false if any of the histograms has less entries than mMinEntries
@@ -118,6 +120,7 @@ class CalibratordEdx final : public o2::calibration::TimeSlotCalibration<o2::tpc
   std::tuple<float, int, float> mElectronCut{}; ///< Values passed to CalibdEdx::setElectronCut
   TrackCuts mCuts;                              ///< Cut object
   o2::base::Propagator::MatCorrType mMatType{}; ///< material type for track propagation
+  int mNThreads{1};                             ///< number of threads used for filling the histograms
   bool mMakeGaussianFits{};                     ///< fit mean of gaussian fits instead of mean dedx
 
   TFinterval mTFIntervals;     ///< start and end time frame IDs of each calibration time slots
@@ -126,7 +129,7 @@ class CalibratordEdx final : public o2::calibration::TimeSlotCalibration<o2::tpc
 
   std::unique_ptr<o2::utils::TreeStreamRedirector> mDebugOutputStreamer; ///< Debug output streamer
 
-  ClassDefOverride(CalibratordEdx, 3);
+  ClassDefOverride(CalibratordEdx, 4);
 };
 
 } // namespace o2::tpc
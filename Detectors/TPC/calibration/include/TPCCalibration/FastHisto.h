@@ -91,6 +91,15 @@ class FastHisto
     mBinCont[index] += weight;
   }
 
+  /// this function adds the content of a bin which was filled externally with unit weights
+  /// \param index the index (bin) for which the bin content is increased
+  /// \param entries number of entries which were filled in the bin
+  void addBinEntries(int index, unsigned int entries)
+  {
+    mBinCount += entries;
+    mBinCont[index] += entries;
+  }
+
   /// this function prints out the histogram
   /// \param type printing type e.g 'vertical printing: type=0', 'horizontal printing: type=1'
   /// \param prec sets the precision of the x axis label
@@ -0,0 +1,170 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file PadHistogramStore.h
+/// \brief compact storage of one 1D histogram per TPC pad
+
+#ifndef ALICEO2_TPC_PADHISTOGRAMSTORE_H_
+#define ALICEO2_TPC_PADHISTOGRAMSTORE_H_
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include <gsl/span>
+
+#include "TPCBase/CalDet.h"
+#include "TPCBase/Mapper.h"
+#include "TPCCalibration/FastHisto.h"
+
+namespace o2::tpc
+{
+
+/// \brief Dense pad-major histogram storage for all pads of the TPC.
+///
+/// The bins of all pads are stored in one contiguous array (all bins of pad 0, all bins of pad 1, ...)
+/// using 16 bit counters. If a counter overflows, the carry is stored in a sparse map, which is
+/// only accessed when reading the bin content. The binning follows the conventions of FastHisto
+/// (optional underflow and overflow bin), so that the content can be exported to CalDet<FastHisto>.
+///
+/// Usage:
+/// 1. o2::tpc::PadHistogramStore store;
+/// 2. store.init(20, 0, 3, false, true);
+/// 3. store.fill(PadHistogramStore::getPadIndex(sector, padInSector), value); // or batched fill with a span of entries
+/// 4. store.exportTo(calDet); // add the content to CalDet<FastHisto<unsigned int>>
+class PadHistogramStore
+{
+ public:
+  using Counter = uint16_t;
+  using DataTHistos = CalDet<FastHisto<unsigned int>>;
+
+  /// entry used for batched filling
+  struct Entry {
+    uint32_t pad{}; ///< global pad index as returned by getPadIndex()
+    float value{};  ///< value which will be filled
+  };
+
+  /// total number of pads of the TPC
+  static constexpr uint32_t NPads = Mapper::getPadsInSector() * Mapper::NSECTORS;
+
+  /// \return global pad index used in the store
+  /// \param sector sector of the TPC
+  /// \param padInSector pad number in the sector
+  static constexpr uint32_t getPadIndex(const unsigned int sector, const unsigned int padInSector) { return sector * Mapper::getPadsInSector() + padInSector; }
+
+  /// \return global pad index used in the store
+  /// \param roc numerical ROC value
+  /// \param padInROC pad number in the ROC
+  static uint32_t getPadIndexFromROC(const unsigned int roc, const unsigned int padInROC) { return getPadIndex(roc % Mapper::NSECTORS, (roc < Mapper::NSECTORS) ? padInROC : padInROC + Mapper::getPadsInIROC()); }
+
+  /// initialize the binning of the histograms and allocate the memory
+  /// \param nBins number of bins used in the histograms
+  /// \param xmin minimum value in histogram
+  /// \param xmax maximum value in histogram (value not included)
+  /// \param useUnderflow set usage of underflow bin
+  /// \param useOverflow set usage of overflow bin
+  void init(const unsigned int nBins, const float xmin, const float xmax, const bool useUnderflow, const bool useOverflow);
+
+  /// \return returns if the memory of the store is allocated
+  bool isInitialized() const { return !mBinCont.empty(); }
+
+  /// fill one value in the histogram of the given pad
+  /// \param pad global pad index
+  /// \param val value which will be filled
+  void fill(const uint32_t pad, const float val)
+  {
+    const int bin = findBin(val);
+    if (bin >= 0) {
+      fillBin(static_cast<size_t>(pad) * mNBinsTotal + bin);
+    }
+  }
+
+  /// fill a batch of values
+  /// \param entries pads and values which will be filled
+  void fill(const gsl::span<const Entry> entries);
+
+  /// \return bin content for given pad and bin
+  /// \param pad global pad index
+  /// \param bin index of the bin (including the underflow bin if used)
+  unsigned int getBinContent(const uint32_t pad, const unsigned int bin) const;
+
+  /// \return number of entries in the histogram of the given pad
+  unsigned int getEntries(const uint32_t pad) const;
+
+  /// \return total number of filled entries
+  uint64_t getTotalEntries() const { return mTotalEntries; }
+
+  /// \return number of bins including underflow and overflow bin
+  unsigned int getNBinsTotal() const { return mNBinsTotal; }
+
+  /// \return number of bins (excluding underflow and overflow bin)
+  unsigned int getNBins() const { return mNBins; }
+
+  /// \return minimum x value in the histograms
+  float getXmin() const { return mXmin; }
+
+  /// \return maximum x value in the histograms (value not included)
+  float getXmax() const { return mXmax; }
+
+  /// \return returns if the underflow bin is used
+  bool isUnderflowSet() const { return mUseUnderflow; }
+
+  /// \return returns if the overflow bin is used
+  bool isOverflowSet() const { return mUseOverflow; }
+
+  /// \return number of bin counters which overflowed the 16 bit range
+  size_t getNPromotedBins() const { return mOverflow.size(); }
+
+  /// add the content of another store with the same binning
+  void merge(const PadHistogramStore& other);
+
+  /// add the content of the store to the pad-by-pad histograms. The binning of the histograms has to match.
+  void exportTo(DataTHistos& histos) const;
+
+  /// reset the content of all histograms
+  void reset();
+
+ private:
+  unsigned int mNBins{};                            ///< number of bins
+  unsigned int mNBinsTotal{};                       ///< number of bins including underflow and overflow bin
+  float mXmin{};                                    ///< minimum x value in the histogram
+  float mXmax{};                                    ///< maximum x value in the histogram (value not included)
+  float mBinWidth{};                                ///< width of the bins
+  bool mUseUnderflow{false};                        ///< if true underflow bin used in the histogram
+  bool mUseOverflow{true};                          ///< if true overflow bin is used in the histogram
+  uint64_t mTotalEntries{};                         ///< total number of filled entries
+  std::vector<Counter> mBinCont;                    ///< pad-major bin content
+  std::unordered_map<uint32_t, uint32_t> mOverflow; ///< carry of bins which exceeded the range of Counter
+
+  /// \return index of the bin for given value or -1 if the value is out of range
+  int findBin(const float val) const
+  {
+    if (val < mXmin) {
+      return mUseUnderflow ? 0 : -1;
+    }
+    if (val >= mXmax) {
+      return mUseOverflow ? static_cast<int>(mNBinsTotal) - 1 : -1;
+    }
+    return static_cast<int>((val - mXmin) / mBinWidth) + mUseUnderflow; // same as FastHisto::findBin
+  }
+
+  /// increment the given bin and promote the counter in case of an overflow
+  void fillBin(const size_t index)
+  {
+    ++mTotalEntries;
+    if (++mBinCont[index] == 0) {
+      mOverflow[index] += (1u << (8 * sizeof(Counter)));
+    }
+  }
+};
+
+} // namespace o2::tpc
+
+#endif
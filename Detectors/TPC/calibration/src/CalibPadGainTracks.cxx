@@ -72,6 +72,7 @@ void CalibPadGainTracks::processTrack(o2::tpc::TrackTPC track, o2::gpu::GPUO2Int
     buffer.clear();
   }
   mClTrk.clear();
+  mPadEntries.clear();
 
   for (int iCl = 0; iCl < nClusters; iCl++) { // loop over cluster
     const o2::tpc::ClusterNative& cl = track.getCluster(*mTPCTrackClIdxVecInput, iCl, *mClusterIndex);
@@ -157,12 +158,8 @@ void CalibPadGainTracks::processTrack(o2::tpc::TrackTPC track, o2::gpu::GPUO2Int
       }
 
       const float fillVal = mDoNotNormCharge ? chargeNorm : chargeNorm / dedx;
-      int index = Mapper::GLOBALPADOFFSET[region] + Mapper::OFFSETCRUGLOBAL[rowIndex] + pad;
-      if (cru.isOROC()) {
-        index -= Mapper::getPadsInIROC();
-      }
-
-      fillPadByPadHistogram(cru.roc().getRoc(), index, fillVal);
+      const int padInSector = Mapper::GLOBALPADOFFSET[region] + Mapper::OFFSETCRUGLOBAL[rowIndex] + pad;
+      mPadEntries.emplace_back(PadHistogramStore::Entry{PadHistogramStore::getPadIndex(sectorIndex, padInSector), fillVal});
     }
 
     if (mMode == dedxTrack) {
@@ -176,7 +173,8 @@ void CalibPadGainTracks::processTrack(o2::tpc::TrackTPC track, o2::gpu::GPUO2Int
         mDEdxBuffer[indexBuffer].emplace_back(chargeNorm);
       }
 
-      mClTrk.emplace_back(std::make_tuple(sectorIndex, rowIndex, pad, chargeNorm)); // fill with dummy dedx value
+      const int padInSector = Mapper::GLOBALPADOFFSET[region] + Mapper::OFFSETCRUGLOBAL[rowIndex] + pad;
+      mClTrk.emplace_back(ClusterInfo{PadHistogramStore::getPadIndex(sectorIndex, padInSector), rowIndex, chargeNorm});
     }
   }
 
@@ -184,9 +182,8 @@ void CalibPadGainTracks::processTrack(o2::tpc::TrackTPC track, o2::gpu::GPUO2Int
     getTruncMean();
 
     // set the dEdx
-    for (auto& x : mClTrk) {
-      const unsigned char globRow = std::get<1>(x);
-      const int region = Mapper::REGION[globRow];
+    for (const auto& cl : mClTrk) {
+      const int region = Mapper::REGION[cl.row];
       const int indexBuffer = getdEdxBufferIndex(region);
 
       const float dedxTmp = mDedxTmp[indexBuffer];
@@ -194,22 +191,37 @@ void CalibPadGainTracks::processTrack(o2::tpc::TrackTPC track, o2::gpu::GPUO2Int
         continue;
       }
 
-      const unsigned char pad = std::get<2>(x);
-      int index = Mapper::GLOBALPADOFFSET[region] + Mapper::OFFSETCRUGLOBAL[globRow] + pad;
-      const ROC roc = CRU(Sector(std::get<0>(x)), region).roc();
-      if (roc.isOROC()) {
-        index -= Mapper::getPadsInIROC();
-      }
-
       // fill the normalizes charge in pad histogram
-      float fillVal = mDoNotNormCharge ? std::get<3>(x) : std::get<3>(x) / dedxTmp;
+      float fillVal = mDoNotNormCharge ? cl.chargeNorm : cl.chargeNorm / dedxTmp;
       if (getLogTransformQ()) {
         fillVal = std::log(1 + fillVal);
       }
-      fillPadByPadHistogram(roc.getRoc(), index, fillVal);
+      mPadEntries.emplace_back(PadHistogramStore::Entry{cl.pad, fillVal});
     }
-  } else {
   }
+
+  mPadHistoStore.fill(mPadEntries);
+}
+
+void CalibPadGainTracks::init(const unsigned int nBins, const float xmin, const float xmax, const bool useUnderflow, const bool useOverflow)
+{
+  releaseHistos();
+  mPadHistoStore.init(nBins, xmin, xmax, useUnderflow, useOverflow);
+}
+
+void CalibPadGainTracks::finalizeHistos()
+{
+  if (!getHistos()) {
+    CalibPadGainTracksBase::init(mPadHistoStore.getNBins(), mPadHistoStore.getXmin(), mPadHistoStore.getXmax(), mPadHistoStore.isUnderflowSet(), mPadHistoStore.isOverflowSet());
+  }
+  mPadHistoStore.exportTo(*getHistos());
+  mPadHistoStore.reset();
+}
+
+void CalibPadGainTracks::resetHistos()
+{
+  releaseHistos();
+  mPadHistoStore.reset();
 }
 
 void CalibPadGainTracks::getTruncMean(float low, float high)
@@ -268,9 +280,17 @@ float CalibPadGainTracks::getTrackTopologyCorrectionPol(const o2::tpc::TrackTPC&
   return effectiveLength;
 }
 
+CalibPadGainTracks::CalibPadGainTracks(const bool initCalPad) : CalibPadGainTracksBase(initCalPad, false)
+{
+  reserveMemory();
+  const DataTHisto histo; // default binning of the pad-by-pad histograms
+  mPadHistoStore.init(histo.getNBins(), histo.getXmin(), histo.getXmax(), histo.isUnderflowSet(), histo.isOverflowSet());
+}
+
 void CalibPadGainTracks::reserveMemory()
 {
   mClTrk.reserve(Mapper::PADROWS);
+  mPadEntries.reserve(Mapper::PADROWS);
   resizedEdxBuffer();
 }
 
@@ -25,8 +25,11 @@
 
 using namespace o2::tpc;
 
-CalibPadGainTracksBase::CalibPadGainTracksBase(const bool initCalPad) : mPadHistosDet(std::make_unique<DataTHistos>("Histo"))
+CalibPadGainTracksBase::CalibPadGainTracksBase(const bool initCalPad, const bool initHistos)
 {
+  if (initHistos) {
+    mPadHistosDet = std::make_unique<DataTHistos>("Histo");
+  }
   if (initCalPad) {
     initCalPadMemory();
     initCalPadStdDevMemory();
@@ -36,6 +39,9 @@ CalibPadGainTracksBase::CalibPadGainTracksBase(const bool initCalPad) : mPadHist
 
 void CalibPadGainTracksBase::init(const unsigned int nBins, const float xmin, const float xmax, const bool useUnderflow, const bool useOverflow)
 {
+  if (!mPadHistosDet) {
+    mPadHistosDet = std::make_unique<DataTHistos>("Histo");
+  }
   DataTHisto hist(nBins, xmin, xmax, useUnderflow, useOverflow);
   for (auto& calArray : mPadHistosDet->getData()) {
     for (auto& tHist : calArray.getData()) {
@@ -133,6 +139,9 @@ TCanvas* CalibPadGainTracksBase::drawExtractedGainMapPainter() const
 
 void CalibPadGainTracksBase::resetHistos()
 {
+  if (!mPadHistosDet) {
+    return;
+  }
   for (auto& calArray : mPadHistosDet->getData()) {
     for (auto& tHist : calArray.getData()) {
       tHist.reset();
@@ -156,6 +165,10 @@ void CalibPadGainTracksBase::fill(const gsl::span<const DataTHistos>& caldets)
 
 void CalibPadGainTracksBase::print() const
 {
+  if (!mPadHistosDet) {
+    LOGP(info, "Pad-by-pad histograms are not allocated");
+    return;
+  }
   unsigned int totEntries = 0;
   int minEntries = -1;
   for (auto& calArray : mPadHistosDet->getData()) {
@@ -177,6 +190,10 @@ bool CalibPadGainTracksBase::hasEnoughData(const int minEntries) const
     return true;
   }
 
+  if (!mPadHistosDet) {
+    return false;
+  }
+
   unsigned long totalEntries = 0;
   for (auto& calArray : mPadHistosDet->getData()) {
     for (auto& tHist : calArray.getData()) {
@@ -206,6 +223,11 @@ void CalibPadGainTracksBase::finalize(const int minEntries, const float minRelga
     initCalPadStat();
   }
 
+  if (!mPadHistosDet) {
+    LOGP(error, "Pad-by-pad histograms are not allocated. Returning");
+    return;
+  }
+
   for (int roc = 0; roc < ROC::MaxROC; ++roc) {
     const auto padsInRoc = ROC(roc).isIROC() ? Mapper::getPadsInIROC() : Mapper::getPadsInOROC();
     for (int pad = 0; pad < padsInRoc; ++pad) {
@@ -13,6 +13,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <string>
 #include <vector>
 #include <cmath>
@@ -72,16 +73,22 @@ CalibdEdx::CalibdEdx(const CalibdEdx& other)
   mFitPasses = other.mFitPasses;
   mTFID = other.mTFID;
 
-  mHist = other.mHist;
+  mHist = other.getHist();
   mCalib = other.mCalib;
   mCalibIn = other.mCalibIn;
 
   mMatType = other.mMatType;
+  mHistShards.setNThreads(other.getNThreads());
 
   // debug streamer not copied on purpose
 }
 
 void CalibdEdx::fill(const TrackTPC& track)
+{
+  fillTrack(mHist, track);
+}
+
+void CalibdEdx::fillTrack(Hist& hist, const TrackTPC& track) const
 {
   // applying cuts
   if (track.hasBothSidesClusters() || (mApplyCuts && !mCuts.goodTrack(track))) {
@@ -138,15 +145,14 @@ void CalibdEdx::fill(const TrackTPC& track)
     dEdxMaxCorr[roc] = corrMax;
     dEdxTotCorr[roc] = corrTot;
 
-    static bool reported = false;
-    if (!reported && mCalibIn.getDims() >= 0) {
+    static std::atomic<bool> reported{false};
+    if (mCalibIn.getDims() >= 0 && !reported.exchange(true)) {
       const auto meanParamTot = mCalibIn.getMeanParams(ChargeType::Tot);
       LOGP(info, "Undoing previously applied corrections with mean qTot Params {}", utils::elementsToString(meanParamTot));
-      reported = true;
     }
 
-    mHist(dEdxMax[roc] * dEdxScale * corrMax, scaledTgl, snp, sector, roc, ChargeType::Max);
-    mHist(dEdxTot[roc] * dEdxScale * corrTot, scaledTgl, snp, sector, roc, ChargeType::Tot);
+    hist(dEdxMax[roc] * dEdxScale * corrMax, scaledTgl, snp, sector, roc, ChargeType::Max);
+    hist(dEdxTot[roc] * dEdxScale * corrTot, scaledTgl, snp, sector, roc, ChargeType::Tot);
   }
 
   if (mDebugOutputStreamer) {
@@ -167,9 +173,16 @@ void CalibdEdx::fill(const TrackTPC& track)
 
 void CalibdEdx::fill(const gsl::span<const TrackTPC> tracks)
 {
-  for (const auto& track : tracks) {
-    fill(track);
+  // the debug streamer is not thread safe
+  if (mHistShards.getNThreads() == 1 || mDebugOutputStreamer) {
+    for (const auto& track : tracks) {
+      fill(track);
+    }
+    return;
   }
+
+  // the shards are merged only when the full histogram is needed, as merging adds all bins
+  mHistShards.fill(mHist, tracks, [this](Hist& hist, const TrackTPC& track) { fillTrack(hist, track); });
 }
 
 void CalibdEdx::merge(const CalibdEdx* other)
@@ -534,6 +547,7 @@ void CalibdEdx::fitHistGaus(TLinearFitter& fitter, CalibdEdxCorrection& corr, co
 
 void CalibdEdx::finalize(const bool useGausFits)
 {
+  mergeShards();
   const float entries = minStackEntries();
   mCalib.clear();
 
@@ -581,6 +595,7 @@ void CalibdEdx::finalize(const bool useGausFits)
 int CalibdEdx::minStackEntries() const
 {
   // sum over the dEdx and track-param bins to get the number of entries per stack and charge
+  mergeShards();
   auto projection = bh::algorithm::project(mHist, std::vector<int>{Axis::Sector, Axis::Stack, Axis::Charge});
   auto dEdxCounts = bh::indexed(projection);
   // find the stack with the least number of entries
@@ -614,6 +629,7 @@ THnF* CalibdEdx::getTHnF() const
 
 THnF* CalibdEdx::getRootHist() const
 {
+  mergeShards();
   auto hn = getTHnF();
   const size_t histRank = mHist.rank();
   std::vector<double> xs(histRank);
@@ -632,6 +648,9 @@ THnF* CalibdEdx::getRootHist() const
 
 void CalibdEdx::setFromRootHist(const THnF* hist)
 {
+  // drop the thread-local histograms, they have the binning of the replaced histogram
+  mHistShards.setNThreads(getNThreads());
+
   // Get the number of dimensions
   int n_dim = hist->GetNdimensions();
 
@@ -686,12 +705,14 @@ void CalibdEdx::setFromRootHist(const THnF* hist)
 
 void CalibdEdx::print() const
 {
+  mergeShards();
   const int uniqueEntries = std::accumulate(mHist.begin(), mHist.end(), 0.0) / GEMSTACKSPERSECTOR / 2;
   LOGP(info, "Total number of track entries: {}. Min. entries per GEM stack: {}", uniqueEntries, minStackEntries());
 }
 
 void CalibdEdx::writeTTree(std::string_view fileName) const
 {
+  mergeShards();
   TFile f(fileName.data(), "recreate");
 
   TTree tree("hist", "Saving boost histogram to TTree");
@@ -745,6 +766,7 @@ void CalibdEdx::finalizeDebugOutput() const
 
 void CalibdEdx::dumpToFile(const char* outFile, const char* outName) const
 {
+  mergeShards();
   TFile f(outFile, "RECREATE");
   f.WriteObject(this, outName);
   const auto* thn = getRootHist();
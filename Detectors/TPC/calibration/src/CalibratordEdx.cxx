@@ -94,6 +94,7 @@ CalibratordEdx::Slot& CalibratordEdx::emplaceNewSlot(bool front, TFType tstart,
   const auto [cut, iterations, cutLowFactor] = mElectronCut;
   container->setElectronCut(cut, iterations, cutLowFactor);
   container->setMaterialType(mMatType);
+  container->setNThreads(mNThreads);
   if (mEnableTrackDebug) {
     const auto fileName = fmt::format("o2tpc_CalibratordEdx_TrackDebug_{}_{}.root", tstart, tend);
     container->enableDebugOutput(fileName);
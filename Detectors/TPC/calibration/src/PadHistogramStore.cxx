@@ -0,0 +1,114 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#include "TPCCalibration/PadHistogramStore.h"
+#include "TPCBase/ROC.h"
+#include "Framework/Logger.h"
+
+#include <algorithm>
+
+using namespace o2::tpc;
+
+void PadHistogramStore::init(const unsigned int nBins, const float xmin, const float xmax, const bool useUnderflow, const bool useOverflow)
+{
+  mNBins = nBins;
+  mXmin = xmin;
+  mXmax = xmax;
+  mBinWidth = (mXmax - mXmin) / mNBins;
+  mUseUnderflow = useUnderflow;
+  mUseOverflow = useOverflow;
+  mNBinsTotal = mNBins + mUseUnderflow + mUseOverflow;
+  mBinCont.assign(static_cast<size_t>(NPads) * mNBinsTotal, 0);
+  mOverflow.clear();
+  mTotalEntries = 0;
+}
+
+void PadHistogramStore::fill(const gsl::span<const Entry> entries)
+{
+  for (const auto& entry : entries) {
+    fill(entry.pad, entry.value);
+  }
+}
+
+unsigned int PadHistogramStore::getBinContent(const uint32_t pad, const unsigned int bin) const
+{
+  const uint32_t index = pad * mNBinsTotal + bin;
+  unsigned int content = mBinCont[index];
+  if (!mOverflow.empty()) {
+    const auto it = mOverflow.find(index);
+    if (it != mOverflow.end()) {
+      content += it->second;
+    }
+  }
+  return content;
+}
+
+unsigned int PadHistogramStore::getEntries(const uint32_t pad) const
+{
+  unsigned int entries = 0;
+  for (unsigned int bin = 0; bin < mNBinsTotal; ++bin) {
+    entries += getBinContent(pad, bin);
+  }
+  return entries;
+}
+
+void PadHistogramStore::merge(const PadHistogramStore& other)
+{
+  if ((other.mNBinsTotal != mNBinsTotal) || (other.mXmin != mXmin) || (other.mXmax != mXmax)) {
+    LOGP(error, "Binning of the pad histogram stores does not match. Not merging");
+    return;
+  }
+
+  for (size_t index = 0; index < mBinCont.size(); ++index) {
+    const Counter before = mBinCont[index];
+    mBinCont[index] += other.mBinCont[index];
+    if (mBinCont[index] < before) {
+      mOverflow[index] += (1u << (8 * sizeof(Counter)));
+    }
+  }
+  for (const auto& [index, carry] : other.mOverflow) {
+    mOverflow[index] += carry;
+  }
+  mTotalEntries += other.mTotalEntries;
+}
+
+void PadHistogramStore::exportTo(DataTHistos& histos) const
+{
+  if (mTotalEntries == 0) {
+    return;
+  }
+
+  for (int roc = 0; roc < ROC::MaxROC; ++roc) {
+    auto& rocHistos = histos.getCalArray(roc).getData();
+    const auto padsInRoc = ROC(roc).isIROC() ? Mapper::getPadsInIROC() : Mapper::getPadsInOROC();
+    for (int padInROC = 0; padInROC < padsInRoc; ++padInROC) {
+      auto& histo = rocHistos[padInROC];
+      if ((histo.getNBins() != mNBins) || (histo.isUnderflowSet() != mUseUnderflow) || (histo.isOverflowSet() != mUseOverflow)) {
+        LOGP(error, "Binning of the pad-by-pad histograms does not match the binning of the store. Not exporting");
+        return;
+      }
+      const uint32_t pad = getPadIndexFromROC(roc, padInROC);
+      for (unsigned int bin = 0; bin < mNBinsTotal; ++bin) {
+        const auto content = getBinContent(pad, bin);
+        if (content) {
+          histo.addBinEntries(bin, content);
+        }
+      }
+    }
+  }
+}
+
+void PadHistogramStore::reset()
+{
+  std::fill(mBinCont.begin(), mBinCont.end(), 0);
+  mOverflow.clear();
+  mTotalEntries = 0;
+}
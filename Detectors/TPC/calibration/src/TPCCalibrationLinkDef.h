@@ -85,6 +85,7 @@
 #pragma link C++ class o2::tpc::TrackDump::TrackInfo + ;
 #pragma link C++ class std::vector < o2::tpc::TrackDump::TrackInfo> + ;
 #pragma link C++ class o2::tpc::CalibPadGainTracksBase + ;
+#pragma link C++ class o2::tpc::PadHistogramStore + ;
 #pragma link C++ class o2::tpc::CalDet < o2::tpc::FastHisto < unsigned int>> + ;
 #pragma link C++ class o2::calibration::TimeSlot < o2::tpc::CalibPadGainTracksBase> + ;
 #pragma link C++ class o2::calibration::TimeSlotCalibration < o2::tpc::CalibPadGainTracksBase> + ;
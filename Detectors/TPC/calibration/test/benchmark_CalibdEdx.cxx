@@ -0,0 +1,89 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file benchmark_CalibdEdx.cxx
+/// \brief Benchmark of the dE/dx histogram filling with a varying number of threads
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <random>
+#include <vector>
+
+#include "TGeoGlobalMagField.h"
+#include "Field/MagneticField.h"
+#include "DataFormatsTPC/TrackTPC.h"
+#include "DataFormatsTPC/dEdxInfo.h"
+#include "TPCCalibration/CalibdEdx.h"
+
+using namespace o2::tpc;
+
+namespace
+{
+void initField()
+{
+  if (TGeoGlobalMagField::Instance()->GetField()) {
+    return;
+  }
+  auto fld = o2::field::MagneticField::createFieldMap();
+  TGeoGlobalMagField::Instance()->SetField(fld);
+  TGeoGlobalMagField::Instance()->Lock();
+}
+
+std::vector<TrackTPC> generateTracks(size_t nTracks)
+{
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<float> alphaDist(-3.14f, 3.14f);
+  std::uniform_real_distribution<float> tglDist(-1.f, 1.f);
+  std::uniform_real_distribution<float> snpDist(-0.3f, 0.3f);
+  std::uniform_real_distribution<float> q2ptDist(-2.f, 2.f);
+  std::normal_distribution<float> dEdxDist(50.f, 4.f);
+
+  std::vector<TrackTPC> tracks;
+  tracks.reserve(nTracks);
+  const std::array<float, 15> cov{1e-2, 0, 1e-2, 0, 0, 1e-4, 0, 0, 0, 1e-4, 0, 0, 0, 0, 1e-2};
+  for (size_t i = 0; i < nTracks; ++i) {
+    const float tgl = tglDist(gen);
+    auto& track = tracks.emplace_back(85.f, alphaDist(gen), std::array<float, 5>{0.f, 0.f, snpDist(gen), tgl, q2ptDist(gen)}, cov);
+    (tgl > 0) ? track.setHasASideClusters() : track.setHasCSideClusters();
+    dEdxInfo dEdx;
+    dEdx.dEdxMaxIROC = dEdxDist(gen);
+    dEdx.dEdxMaxOROC1 = dEdxDist(gen);
+    dEdx.dEdxMaxOROC2 = dEdxDist(gen);
+    dEdx.dEdxMaxOROC3 = dEdxDist(gen);
+    dEdx.dEdxTotIROC = dEdxDist(gen);
+    dEdx.dEdxTotOROC1 = dEdxDist(gen);
+    dEdx.dEdxTotOROC2 = dEdxDist(gen);
+    dEdx.dEdxTotOROC3 = dEdxDist(gen);
+    track.setdEdx(dEdx);
+  }
+  return tracks;
+}
+} // namespace
+
+static void BM_CalibdEdxFill(benchmark::State& state)
+{
+  initField();
+  const auto tracks = generateTracks(state.range(0));
+  CalibdEdx calib;
+  calib.setApplyCuts(false);
+  calib.setNThreads(state.range(1));
+
+  for (auto _ : state) {
+    calib.fill(tracks);
+  }
+  state.SetItemsProcessed(state.iterations() * tracks.size());
+  state.counters["tracks/s"] = benchmark::Counter(state.iterations() * tracks.size(), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_CalibdEdxFill)->ArgsProduct({{10000, 100000}, {1, 2, 4, 8, 16}})->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
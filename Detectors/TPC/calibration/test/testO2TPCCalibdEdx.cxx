@@ -0,0 +1,162 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file  testO2TPCCalibdEdx.cxx
+/// \brief this task tests that the dE/dx histograms filled with several threads are identical to the ones filled with one thread
+
+#define BOOST_TEST_MODULE Test TPC O2TPCCalibdEdx class
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "TPCCalibration/CalibdEdx.h"
+#include "DataFormatsTPC/TrackTPC.h"
+#include "DataFormatsTPC/dEdxInfo.h"
+#include "Field/MagneticField.h"
+#include "TGeoGlobalMagField.h"
+#include "THn.h"
+#include <array>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace o2
+{
+namespace tpc
+{
+
+void initField()
+{
+  if (TGeoGlobalMagField::Instance()->GetField()) {
+    return;
+  }
+  auto fld = o2::field::MagneticField::createFieldMap();
+  TGeoGlobalMagField::Instance()->SetField(fld);
+  TGeoGlobalMagField::Instance()->Lock();
+}
+
+/// tracks with random parameters and dE/dx, on the A and C side
+std::vector<TrackTPC> generateTracks(size_t nTracks, unsigned int seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<float> alphaDist(-3.14f, 3.14f);
+  std::uniform_real_distribution<float> tglDist(-1.f, 1.f);
+  std::uniform_real_distribution<float> snpDist(-0.3f, 0.3f);
+  std::uniform_real_distribution<float> q2ptDist(-2.f, 2.f);
+  std::normal_distribution<float> dEdxDist(50.f, 4.f);
+
+  std::vector<TrackTPC> tracks;
+  const std::array<float, 15> cov{1e-2, 0, 1e-2, 0, 0, 1e-4, 0, 0, 0, 1e-4, 0, 0, 0, 0, 1e-2};
+  for (size_t i = 0; i < nTracks; ++i) {
+    const float tgl = tglDist(gen);
+    auto& track = tracks.emplace_back(85.f, alphaDist(gen), std::array<float, 5>{0.f, 0.f, snpDist(gen), tgl, q2ptDist(gen)}, cov);
+    (tgl > 0) ? track.setHasASideClusters() : track.setHasCSideClusters();
+    dEdxInfo dEdx;
+    dEdx.dEdxMaxIROC = dEdxDist(gen);
+    dEdx.dEdxMaxOROC1 = dEdxDist(gen);
+    dEdx.dEdxMaxOROC2 = dEdxDist(gen);
+    dEdx.dEdxMaxOROC3 = dEdxDist(gen);
+    dEdx.dEdxTotIROC = dEdxDist(gen);
+    dEdx.dEdxTotOROC1 = dEdxDist(gen);
+    dEdx.dEdxTotOROC2 = dEdxDist(gen);
+    dEdx.dEdxTotOROC3 = dEdxDist(gen);
+    track.setdEdx(dEdx);
+  }
+  return tracks;
+}
+
+/// fill the tracks in several calls, with single tracks in between
+void fillCalib(CalibdEdx& calib, const std::vector<TrackTPC>& tracks)
+{
+  const size_t nChunks = 5;
+  for (size_t iChunk = 0; iChunk < nChunks; ++iChunk) {
+    const size_t first = tracks.size() * iChunk / nChunks;
+    const size_t last = tracks.size() * (iChunk + 1) / nChunks;
+    calib.fill(gsl::span<const TrackTPC>(tracks.data() + first, last - first - 1));
+    calib.fill(tracks[last - 1]);
+  }
+}
+
+void compareHistos(const CalibdEdx& calib, const CalibdEdx& calibRef)
+{
+  const auto& hist = calib.getHist();
+  const auto& histRef = calibRef.getHist();
+  BOOST_REQUIRE_EQUAL(hist.size(), histRef.size());
+  auto itRef = histRef.begin();
+  for (auto it = hist.begin(); it != hist.end(); ++it, ++itRef) {
+    BOOST_REQUIRE_EQUAL(double(*it), double(*itRef));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(CalibdEdx_threads_test)
+{
+  initField();
+  const auto tracks = generateTracks(20000, 1);
+
+  CalibdEdx calibRef;
+  calibRef.setApplyCuts(false);
+  fillCalib(calibRef, tracks);
+  BOOST_REQUIRE_GT(calibRef.minStackEntries(), 0);
+
+  for (const int nThreads : {2, 4, 7}) {
+    CalibdEdx calib;
+    calib.setApplyCuts(false);
+    calib.setNThreads(nThreads);
+    fillCalib(calib, tracks);
+
+    // the statistics and the histograms exposed by the accessors include the entries filled by the threads
+    BOOST_CHECK_EQUAL(calib.minStackEntries(), calibRef.minStackEntries());
+    compareHistos(calib, calibRef);
+
+    std::unique_ptr<THnF> rootHist(calib.getRootHist());
+    std::unique_ptr<THnF> rootHistRef(calibRef.getRootHist());
+    BOOST_REQUIRE_EQUAL(rootHist->GetNbins(), rootHistRef->GetNbins());
+    for (Long64_t bin = 0; bin < rootHist->GetNbins(); ++bin) {
+      BOOST_REQUIRE_EQUAL(rootHist->GetBinContent(bin), rootHistRef->GetBinContent(bin));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(CalibdEdx_threads_merge_test)
+{
+  initField();
+  const auto tracksA = generateTracks(5000, 2);
+  const auto tracksB = generateTracks(5000, 3);
+
+  CalibdEdx calibRef;
+  calibRef.setApplyCuts(false);
+  fillCalib(calibRef, tracksA);
+  fillCalib(calibRef, tracksB);
+
+  // containers filled with several threads and merged, or copied, before their histograms are accessed
+  CalibdEdx calibA;
+  CalibdEdx calibB;
+  for (auto calib : {&calibA, &calibB}) {
+    calib->setApplyCuts(false);
+    calib->setNThreads(4);
+  }
+  fillCalib(calibA, tracksA);
+  fillCalib(calibB, tracksB);
+  CalibdEdx calibCopy(calibB);
+  calibA.merge(&calibCopy);
+  compareHistos(calibA, calibRef);
+
+  // changing the number of threads keeps the entries already filled
+  CalibdEdx calibSwitch;
+  calibSwitch.setApplyCuts(false);
+  calibSwitch.setNThreads(4);
+  fillCalib(calibSwitch, tracksA);
+  calibSwitch.setNThreads(3);
+  fillCalib(calibSwitch, tracksB);
+  compareHistos(calibSwitch, calibRef);
+}
+
+} // namespace tpc
+} // namespace o2
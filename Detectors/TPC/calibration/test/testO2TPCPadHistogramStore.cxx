@@ -0,0 +1,229 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file  testO2TPCPadHistogramStore.cxx
+/// \brief this task tests the filling, the promotion of overflowing bin counters, the merging and the export of the pad histogram store
+
+#define BOOST_TEST_MODULE Test TPC O2TPCPadHistogramStore class
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include "TPCCalibration/PadHistogramStore.h"
+#include "TPCBase/ROC.h"
+#include <random>
+#include <vector>
+
+namespace o2
+{
+namespace tpc
+{
+
+static constexpr unsigned int NBINS = 4;
+static constexpr float XMIN = 0.f;
+static constexpr float XMAX = 2.f;
+static constexpr unsigned int MAXCOUNTER = 1u << 16; // range of the counters of the store
+
+/// pad-by-pad histograms with the binning of the store
+PadHistogramStore::DataTHistos makeHistos(const unsigned int nBins, const bool useUnderflow, const bool useOverflow)
+{
+  PadHistogramStore::DataTHistos histos("Histo");
+  const FastHisto<unsigned int> histo(nBins, XMIN, XMAX, useUnderflow, useOverflow);
+  for (auto& calArray : histos.getData()) {
+    for (auto& tHist : calArray.getData()) {
+      tHist = histo;
+    }
+  }
+  return histos;
+}
+
+BOOST_AUTO_TEST_CASE(PadHistogramStore_fill_test)
+{
+  PadHistogramStore store;
+  store.init(NBINS, XMIN, XMAX, true, true);
+  BOOST_CHECK_EQUAL(store.getNBinsTotal(), NBINS + 2);
+
+  // the values are filled in the same bins as in FastHisto, including the underflow and overflow bin
+  FastHisto<unsigned int> histo(NBINS, XMIN, XMAX, true, true);
+  const std::vector<float> values{-1.f, 0.f, 0.49f, 0.5f, 1.2f, 1.99f, 2.f, 3.f};
+  const uint32_t pad = PadHistogramStore::getPadIndex(17, 1000);
+  for (const auto val : values) {
+    store.fill(pad, val);
+    histo.fill(val);
+  }
+  for (unsigned int bin = 0; bin < store.getNBinsTotal(); ++bin) {
+    BOOST_CHECK_EQUAL(store.getBinContent(pad, bin), histo.getBinContent(bin));
+  }
+  BOOST_CHECK_EQUAL(store.getEntries(pad), values.size());
+  BOOST_CHECK_EQUAL(store.getTotalEntries(), values.size());
+  BOOST_CHECK_EQUAL(store.getEntries(pad + 1), 0);
+
+  // batched filling gives the same content as the filling of single values
+  PadHistogramStore storeBatch;
+  storeBatch.init(NBINS, XMIN, XMAX, true, true);
+  std::vector<PadHistogramStore::Entry> entries;
+  for (const auto val : values) {
+    entries.emplace_back(PadHistogramStore::Entry{pad, val});
+  }
+  storeBatch.fill(entries);
+  for (unsigned int bin = 0; bin < store.getNBinsTotal(); ++bin) {
+    BOOST_CHECK_EQUAL(storeBatch.getBinContent(pad, bin), store.getBinContent(pad, bin));
+  }
+
+  // values out of range are not filled without underflow and overflow bin
+  PadHistogramStore storeNoFlow;
+  storeNoFlow.init(NBINS, XMIN, XMAX, false, false);
+  storeNoFlow.fill(entries);
+  BOOST_CHECK_EQUAL(storeNoFlow.getEntries(pad), 5);
+  BOOST_CHECK_EQUAL(storeNoFlow.getTotalEntries(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(PadHistogramStore_overflow_test)
+{
+  PadHistogramStore store;
+  store.init(NBINS, XMIN, XMAX, false, true);
+  const uint32_t pad = PadHistogramStore::NPads - 1;
+
+  // the counter reaches the maximum value of 16 bit without promotion
+  for (unsigned int i = 0; i < MAXCOUNTER - 1; ++i) {
+    store.fill(pad, 0.1f);
+  }
+  BOOST_CHECK_EQUAL(store.getBinContent(pad, 0), MAXCOUNTER - 1);
+  BOOST_CHECK_EQUAL(store.getNPromotedBins(), 0);
+
+  // the counter wraps around and the bin is promoted
+  store.fill(pad, 0.1f);
+  BOOST_CHECK_EQUAL(store.getBinContent(pad, 0), MAXCOUNTER);
+  BOOST_CHECK_EQUAL(store.getNPromotedBins(), 1);
+
+  // a second wrap around
+  const unsigned int nFill = 2 * MAXCOUNTER + 12345;
+  for (unsigned int i = MAXCOUNTER; i < nFill; ++i) {
+    store.fill(pad, 0.1f);
+  }
+  store.fill(pad, 5.f); // overflow bin
+  BOOST_CHECK_EQUAL(store.getBinContent(pad, 0), nFill);
+  BOOST_CHECK_EQUAL(store.getBinContent(pad, NBINS), 1);
+  BOOST_CHECK_EQUAL(store.getNPromotedBins(), 1);
+  BOOST_CHECK_EQUAL(store.getEntries(pad), nFill + 1);
+  BOOST_CHECK_EQUAL(store.getTotalEntries(), nFill + 1);
+
+  store.reset();
+  BOOST_CHECK_EQUAL(store.getBinContent(pad, 0), 0);
+  BOOST_CHECK_EQUAL(store.getNPromotedBins(), 0);
+  BOOST_CHECK_EQUAL(store.getTotalEntries(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(PadHistogramStore_merge_test)
+{
+  PadHistogramStore storeA;
+  PadHistogramStore storeB;
+  storeA.init(NBINS, XMIN, XMAX, true, true);
+  storeB.init(NBINS, XMIN, XMAX, true, true);
+
+  const uint32_t padWrap = PadHistogramStore::getPadIndex(3, 10);     // counters wrap around in the merging
+  const uint32_t padPromoted = PadHistogramStore::getPadIndex(20, 7); // bin already promoted in the merged store
+  const uint32_t padLow = PadHistogramStore::getPadIndex(35, 12000);  // no promotion at all
+  const unsigned int nA = 40000;
+  const unsigned int nB = 30000;
+  for (unsigned int i = 0; i < nA; ++i) {
+    storeA.fill(padWrap, 1.f);
+  }
+  for (unsigned int i = 0; i < nB; ++i) {
+    storeB.fill(padWrap, 1.f);
+  }
+  for (unsigned int i = 0; i < MAXCOUNTER + 10; ++i) {
+    storeB.fill(padPromoted, 0.f);
+  }
+  storeA.fill(padPromoted, 0.f);
+  storeA.fill(padLow, -1.f);
+  storeB.fill(padLow, -1.f);
+  storeB.fill(padLow, 0.6f);
+  BOOST_CHECK_EQUAL(storeA.getNPromotedBins(), 0);
+  BOOST_CHECK_EQUAL(storeB.getNPromotedBins(), 1);
+
+  const auto totalEntries = storeA.getTotalEntries() + storeB.getTotalEntries();
+  storeA.merge(storeB);
+  BOOST_CHECK_EQUAL(storeA.getBinContent(padWrap, 3), nA + nB);
+  BOOST_CHECK_EQUAL(storeA.getBinContent(padPromoted, 1), MAXCOUNTER + 11);
+  BOOST_CHECK_EQUAL(storeA.getBinContent(padLow, 0), 2);
+  BOOST_CHECK_EQUAL(storeA.getBinContent(padLow, 2), 1);
+  BOOST_CHECK_EQUAL(storeA.getNPromotedBins(), 2);
+  BOOST_CHECK_EQUAL(storeA.getTotalEntries(), totalEntries);
+
+  // the merged store is not modified
+  BOOST_CHECK_EQUAL(storeB.getBinContent(padWrap, 3), nB);
+
+  // stores with different binning are not merged
+  PadHistogramStore storeC;
+  storeC.init(NBINS + 1, XMIN, XMAX, true, true);
+  storeC.fill(padLow, 0.6f);
+  storeA.merge(storeC);
+  BOOST_CHECK_EQUAL(storeA.getBinContent(padLow, 2), 1);
+  BOOST_CHECK_EQUAL(storeA.getTotalEntries(), totalEntries);
+}
+
+BOOST_AUTO_TEST_CASE(PadHistogramStore_export_test)
+{
+  PadHistogramStore store;
+  store.init(NBINS, XMIN, XMAX, true, true);
+  auto histosRef = makeHistos(NBINS, true, true);
+
+  // random values in random pads, filled in the store and directly in the pad-by-pad histograms
+  std::mt19937 generator(1);
+  std::uniform_int_distribution<int> rocDist(0, ROC::MaxROC - 1);
+  std::uniform_real_distribution<float> valDist(-0.5f, 2.5f);
+  for (int i = 0; i < 100000; ++i) {
+    const int roc = rocDist(generator);
+    const int padsInRoc = ROC(roc).isIROC() ? Mapper::getPadsInIROC() : Mapper::getPadsInOROC();
+    const int padInROC = generator() % padsInRoc;
+    const float val = valDist(generator);
+    store.fill(PadHistogramStore::getPadIndexFromROC(roc, padInROC), val);
+    histosRef.getCalArray(roc).getData()[padInROC].fill(val);
+  }
+  // promoted bin in an OROC pad
+  const int rocPromoted = 36 + 5;
+  const int padPromoted = 4000;
+  for (unsigned int i = 0; i < MAXCOUNTER + 3; ++i) {
+    store.fill(PadHistogramStore::getPadIndexFromROC(rocPromoted, padPromoted), 1.5f);
+    histosRef.getCalArray(rocPromoted).getData()[padPromoted].fill(1.5f);
+  }
+  BOOST_CHECK_EQUAL(store.getNPromotedBins(), 1);
+
+  // the pad index of a ROC pad is the index of the pad in the sector
+  BOOST_CHECK_EQUAL(PadHistogramStore::getPadIndexFromROC(rocPromoted, padPromoted), PadHistogramStore::getPadIndex(5, padPromoted + Mapper::getPadsInIROC()));
+
+  auto histos = makeHistos(NBINS, true, true);
+  store.exportTo(histos);
+  for (int roc = 0; roc < ROC::MaxROC; ++roc) {
+    const auto& data = histos.getCalArray(roc).getData();
+    const auto& dataRef = histosRef.getCalArray(roc).getData();
+    const int padsInRoc = ROC(roc).isIROC() ? Mapper::getPadsInIROC() : Mapper::getPadsInOROC();
+    for (int pad = 0; pad < padsInRoc; ++pad) {
+      BOOST_REQUIRE_EQUAL(data[pad].getEntries(), dataRef[pad].getEntries());
+      for (unsigned int bin = 0; bin < store.getNBinsTotal(); ++bin) {
+        BOOST_REQUIRE_EQUAL(data[pad].getBinContent(bin), dataRef[pad].getBinContent(bin));
+      }
+    }
+  }
+  BOOST_CHECK_GE(histos.getCalArray(rocPromoted).getData()[padPromoted].getBinContent(4), MAXCOUNTER + 3);
+
+  // the content is added to the histograms
+  store.exportTo(histos);
+  BOOST_CHECK_EQUAL(histos.getCalArray(rocPromoted).getData()[padPromoted].getEntries(), 2 * histosRef.getCalArray(rocPromoted).getData()[padPromoted].getEntries());
+
+  // histograms with a different binning are not modified
+  auto histosOtherBinning = makeHistos(NBINS, false, true);
+  store.exportTo(histosOtherBinning);
+  BOOST_CHECK_EQUAL(histosOtherBinning.getCalArray(rocPromoted).getData()[padPromoted].getEntries(), 0);
+}
+
+} // namespace tpc
+} // namespace o2
@@ -100,7 +100,8 @@ class PoissonSolver
   const ParamSpaceCharge mParamGrid{mGrid3D.getParamSC()};           ///< parameters of the grid on which the calculations are performed
   inline static DataT sConvergenceError{1e-6};                       ///< Error tolerated
   static constexpr DataT INVTWOPI = 1. / o2::constants::math::TwoPI; ///< inverse of 2*pi
-  inline static int sNThreads{4};                                    ///< number of threads which are used during some of the calculations (increasing this number has no big impact)
+  inline static int sNThreads{4};                                    ///< number of threads which are used during some of the calculations (increasing this number has no big impact unless MGParameters::redBlackTiles is set)
+  static constexpr int NZTILE{16};                                   ///< number of z rows in one tile of the red-black relaxation and of the residue calculation
 
   /// \returns inverse grid size in phi (either 1/2Pi or NSECTORSPERSIDE/2Pi)
   static DataT getGridSizePhiInv();
@@ -241,6 +242,15 @@ class PoissonSolver
   void relax3D(Vector& matricesCurrentV, const Vector& matricesCurrentCharge, const int tnRRow, const int tnZColumn, const int iPhi, const int symmetry, const DataT h2, const DataT tempRatioZ,
                const std::vector<DataT>& coefficient1, const std::vector<DataT>& coefficient2, const std::vector<DataT>& coefficient3, const std::vector<DataT>& coefficient4) const;
 
+  /// Red-black Gauss-Seidel relaxation as in relax3D, used if MGParameters::redBlackTiles is set
+  ///
+  /// The points of one colour only depend on points of the other colour, so that for each colour the tiles of one phi slice
+  /// and NZTILE z rows are relaxed in parallel. The static assignment of the tiles to the threads keeps the same part of the grid
+  /// in the cache of each thread for both colours. The result is identical to the one of relax3D for any number of threads.
+  /// The parameters are the same as for relax3D
+  void relax3DRedBlackTiles(Vector& matricesCurrentV, const Vector& matricesCurrentCharge, const int tnRRow, const int tnZColumn, const int iPhi, const int symmetry, const DataT h2, const DataT tempRatioZ,
+                            const std::vector<DataT>& coefficient1, const std::vector<DataT>& coefficient2, const std::vector<DataT>& coefficient3, const std::vector<DataT>& coefficient4) const;
+
   /// Relax2D
   ///
   ///    Relaxation operation for multiGrid
@@ -956,8 +956,13 @@ template <typename DataT>
 void PoissonSolver<DataT>::residue3D(Vector& residue, const Vector& matricesCurrentV, const Vector& matricesCurrentCharge, const int tnRRow, const int tnZColumn, const int tnPhi, const int symmetry,
                                      const DataT ih2, const DataT tempRatioZ, const std::vector<DataT>& coefficient1, const std::vector<DataT>& coefficient2, const std::vector<DataT>& coefficient3, const std::vector<DataT>& inverseCoefficient4) const
 {
-#pragma omp parallel for num_threads(sNThreads) // parallising this loop is possible - but using more than 2 cores makes it slower -
-  for (int m = 0; m < tnPhi; ++m) {
+  // loop over tiles of one phi slice and NZTILE z rows
+  const int nTilesZ = (tnZColumn - 2 + NZTILE - 1) / NZTILE;
+#pragma omp parallel for num_threads(sNThreads) schedule(static)
+  for (int tile = 0; tile < tnPhi * nTilesZ; ++tile) {
+    const int m = tile / nTilesZ;
+    const int jFirst = 1 + (tile % nTilesZ) * NZTILE;
+    const int jLast = std::min(jFirst + NZTILE, tnZColumn - 1);
     int mp1 = m + 1;
     int signPlus = 1;
     int mm1 = m - 1;
@@ -991,7 +996,7 @@ void PoissonSolver<DataT>::residue3D(Vector& residue, const Vector& matricesCurr
       }
     }
 
-    for (int j = 1; j < tnZColumn - 1; ++j) {
+    for (int j = jFirst; j < jLast; ++j) {
       for (int i = 1; i < tnRRow - 1; ++i) {
         residue(i, j, m) = ih2 * (coefficient2[i] * matricesCurrentV(i - 1, j, m) + tempRatioZ * (matricesCurrentV(i, j - 1, m) + matricesCurrentV(i, j + 1, m)) + coefficient1[i] * matricesCurrentV(i + 1, j, m) +
                                   coefficient3[i] * (signPlus * matricesCurrentV(i, j, mp1) + signMinus * matricesCurrentV(i, j, mm1)) - inverseCoefficient4[i] * matricesCurrentV(i, j, m)) +
@@ -1006,6 +1011,7 @@ void PoissonSolver<DataT>::interp3D(Vector& matricesCurrentV, const Vector& matr
 {
   // Do restrict 2 D for each slice
   if (newPhiSlice == 2 * oldPhiSlice) {
+#pragma omp parallel for num_threads(sNThreads)
     for (int m = 0; m < newPhiSlice; m += 2) {
       // assuming no symmetry
       int mm = m / 2;
@@ -1114,6 +1120,7 @@ void PoissonSolver<DataT>::addInterp3D(Vector& matricesCurrentV, const Vector& m
 {
   // Do restrict 2 D for each slice
   if (newPhiSlice == 2 * oldPhiSlice) {
+#pragma omp parallel for num_threads(sNThreads)
     for (int m = 0; m < newPhiSlice; m += 2) {
       // assuming no symmetry
       int mm = m / 2;
@@ -1221,7 +1228,9 @@ void PoissonSolver<DataT>::relax3D(Vector& matricesCurrentV, const Vector& matri
                                    const DataT tempRatioZ, const std::vector<DataT>& coefficient1, const std::vector<DataT>& coefficient2, const std::vector<DataT>& coefficient3, const std::vector<DataT>& coefficient4) const
 {
   // Gauss-Seidel (Read Black}
-  if (MGParameters::relaxType == RelaxType::GaussSeidel) {
+  if (MGParameters::relaxType == RelaxType::GaussSeidel && MGParameters::redBlackTiles) {
+    relax3DRedBlackTiles(matricesCurrentV, matricesCurrentCharge, tnRRow, tnZColumn, iPhi, symmetry, h2, tempRatioZ, coefficient1, coefficient2, coefficient3, coefficient4);
+  } else if (MGParameters::relaxType == RelaxType::GaussSeidel) {
     // for each slice
     for (int iPass = 1; iPass <= 2; ++iPass) {
       const int msw = (iPass % 2) ? 1 : 2;
@@ -1314,6 +1323,75 @@ void PoissonSolver<DataT>::relax3D(Vector& matricesCurrentV, const Vector& matri
   }
 }
 
+template <typename DataT>
+void PoissonSolver<DataT>::relax3DRedBlackTiles(Vector& matricesCurrentV, const Vector& matricesCurrentCharge, const int tnRRow, const int tnZColumn, const int iPhi, const int symmetry, const DataT h2,
+                                                const DataT tempRatioZ, const std::vector<DataT>& coefficient1, const std::vector<DataT>& coefficient2, const std::vector<DataT>& coefficient3, const std::vector<DataT>& coefficient4) const
+{
+  // relax the points of one colour in the z rows [jFirst, jLast) of the slice m
+  // the scalars are captured by value, as they could alias the potential otherwise
+  auto relaxTile = [&matricesCurrentV, &matricesCurrentCharge, &coefficient1, &coefficient2, &coefficient3, &coefficient4, tnRRow, iPhi, symmetry, h2, tempRatioZ](const int iPass, const int m, const int jFirst, const int jLast) {
+    const int msw = (iPass % 2) ? 1 : 2;
+    const int jsw = ((msw + m) % 2) ? 1 : 2;
+    int mp1 = m + 1;
+    int signPlus = 1;
+    int mm1 = m - 1;
+    int signMinus = 1;
+    // Reflection symmetry in phi (e.g. symmetry at sector boundaries, or half sectors, etc.)
+    if (symmetry == 1) {
+      if (mp1 > iPhi - 1) {
+        mp1 = iPhi - 2;
+      }
+      if (mm1 < 0) {
+        mm1 = 1;
+      }
+    }
+    // Anti-symmetry in phi
+    else if (symmetry == -1) {
+      if (mp1 > iPhi - 1) {
+        mp1 = iPhi - 2;
+        signPlus = -1;
+      }
+      if (mm1 < 0) {
+        mm1 = 1;
+        signMinus = -1;
+      }
+    } else { // No Symmetries in phi, no boundaries, the calculation is continuous across all phi
+      if (mp1 > iPhi - 1) {
+        mp1 = m + 1 - iPhi;
+      }
+      if (mm1 < 0) {
+        mm1 = m - 1 + iPhi;
+      }
+    }
+    int isw = ((jFirst - 1) % 2) ? 3 - jsw : jsw;
+    for (int j = jFirst; j < jLast; ++j, isw = 3 - isw) {
+      for (int i = isw; i < tnRRow - 1; i += 2) {
+        (matricesCurrentV)(i, j, m) = (coefficient2[i] * (matricesCurrentV)(i - 1, j, m) + tempRatioZ * ((matricesCurrentV)(i, j - 1, m) + (matricesCurrentV)(i, j + 1, m)) + coefficient1[i] * (matricesCurrentV)(i + 1, j, m) + coefficient3[i] * (signPlus * (matricesCurrentV)(i, j, mp1) + signMinus * (matricesCurrentV)(i, j, mm1)) + (h2 * (matricesCurrentCharge)(i, j, m))) * coefficient4[i];
+      }
+    }
+  };
+
+  // without symmetry and with an odd number of slices the first and the last slice are neighbours of the same colour:
+  // the last slice is relaxed after all the others as in the sequential sweep
+  const int nPhiParallel = (symmetry == 0 && (iPhi % 2)) ? iPhi - 1 : iPhi;
+  const int nTilesZ = (tnZColumn - 2 + NZTILE - 1) / NZTILE;
+  const int nTiles = nPhiParallel * nTilesZ;
+
+#pragma omp parallel num_threads(sNThreads)
+  for (int iPass = 1; iPass <= 2; ++iPass) {
+#pragma omp for schedule(static)
+    for (int tile = 0; tile < nTiles; ++tile) {
+      const int m = tile / nTilesZ;
+      const int jFirst = 1 + (tile % nTilesZ) * NZTILE;
+      relaxTile(iPass, m, jFirst, std::min(jFirst + NZTILE, tnZColumn - 1));
+    }
+#pragma omp single
+    for (int m = nPhiParallel; m < iPhi; ++m) {
+      relaxTile(iPass, m, 1, tnZColumn - 1);
+    }
+  }
+}
+
 template <typename DataT>
 void PoissonSolver<DataT>::relax2D(Vector& matricesCurrentV, const Vector& matricesCurrentCharge, const int tnRRow, const int tnZColumn, const DataT h2, const DataT tempFourth, const DataT tempRatio,
                                    std::vector<DataT>& coefficient1, std::vector<DataT>& coefficient2)
@@ -1389,9 +1467,10 @@ template <typename DataT>
 void PoissonSolver<DataT>::restrict3D(Vector& matricesCurrentCharge, const Vector& residue, const int tnRRow, const int tnZColumn, const int newPhiSlice, const int oldPhiSlice) const
 {
   if (2 * newPhiSlice == oldPhiSlice) {
-    int mm = 0;
-    for (int m = 0; m < newPhiSlice; m++, mm += 2) {
+#pragma omp parallel for num_threads(sNThreads)
+    for (int m = 0; m < newPhiSlice; m++) {
       // assuming no symmetry
+      const int mm = 2 * m;
       int mp1 = mm + 1;
       int mm1 = mm - 1;
 
@@ -1402,8 +1481,8 @@ void PoissonSolver<DataT>::restrict3D(Vector& matricesCurrentCharge, const Vecto
         mm1 = mm - 1 + (oldPhiSlice);
       }
 
-      for (int i = 1, ii = 2; i < tnRRow - 1; ++i, ii += 2) {
-        for (int j = 1, jj = 2; j < tnZColumn - 1; ++j, jj += 2) {
+      for (int j = 1, jj = 2; j < tnZColumn - 1; ++j, jj += 2) {
+        for (int i = 1, ii = 2; i < tnRRow - 1; ++i, ii += 2) {
 
           // at the same plane
           const int iip1 = ii + 1;
@@ -1437,6 +1516,7 @@ void PoissonSolver<DataT>::restrict3D(Vector& matricesCurrentCharge, const Vecto
     } // end phis
 
   } else {
+#pragma omp parallel for num_threads(sNThreads)
     for (int m = 0; m < newPhiSlice; ++m) {
       restrict2D(matricesCurrentCharge, residue, tnRRow, tnZColumn, m);
     }
@@ -1479,15 +1559,14 @@ DataT PoissonSolver<DataT>::getConvergenceError(const Vector& matricesCurrentV,
 {
   std::vector<DataT> errorArr(prevArrayV.getNphi());
 
-  // subtract the two matrices
-  std::transform(prevArrayV.begin(), prevArrayV.end(), matricesCurrentV.begin(), prevArrayV.begin(), std::minus<DataT>());
-
-#pragma omp parallel for num_threads(sNThreads) // parallising this loop is possible - but using more than 2 cores makes it slower -
+#pragma omp parallel for num_threads(sNThreads)
   for (unsigned int m = 0; m < prevArrayV.getNphi(); ++m) {
-    // square each entry in the vector and sum them up
     const auto phiStep = prevArrayV.getNr() * prevArrayV.getNz(); // number of points in one phi slice
     const auto start = prevArrayV.begin() + m * phiStep;
     const auto end = start + phiStep;
+    // subtract the two matrices
+    std::transform(start, end, matricesCurrentV.begin() + m * phiStep, start, std::minus<DataT>());
+    // square each entry in the vector and sum them up
     errorArr[m] = std::inner_product(start, end, start, DataT(0)); // inner product "Sum (matrix[a]*matrix[a])"
   }
   // return largest error
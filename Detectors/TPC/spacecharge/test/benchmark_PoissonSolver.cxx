@@ -0,0 +1,90 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include "TPCSpaceCharge/PoissonSolver.h"
+#include "TPCSpaceCharge/PoissonSolverHelpers.h"
+#include "TPCSpaceCharge/SpaceChargeHelpers.h"
+#include "TPCSpaceCharge/DataContainer3D.h"
+
+using namespace o2::tpc;
+using DataT = double;
+using DataContainer = DataContainer3D<DataT>;
+using GridProp = GridProperties<DataT>;
+
+// standard grid used for the space-charge maps
+constexpr unsigned short NR = 129, NZ = 129, NPHI = 180;
+
+static const RegularGrid3D<DataT>& getGrid()
+{
+  static const ParamSpaceCharge params{NR, NZ, NPHI};
+  static const RegularGrid3D<DataT> grid{GridProp::ZMIN, GridProp::RMIN, GridProp::PHIMIN, GridProp::getGridSpacingZ(NZ), GridProp::getGridSpacingR(NR), GridProp::getGridSpacingPhi(NPHI), params};
+  return grid;
+}
+
+// charge density and boundary potential from the analytical formulas as in the unit test
+static void setInput(DataContainer& charge, DataContainer& potential)
+{
+  const AnalyticalFields<DataT> formulas;
+  const auto& grid = getGrid();
+  for (size_t iPhi = 0; iPhi < NPHI; ++iPhi) {
+    const DataT phi = grid.getPhiVertex(iPhi);
+    for (size_t iR = 0; iR < NR; ++iR) {
+      const DataT radius = grid.getRVertex(iR);
+      for (size_t iZ = 0; iZ < NZ; ++iZ) {
+        const DataT z = grid.getZVertex(iZ);
+        charge(iZ, iR, iPhi) = formulas.evalDensity(z, radius, phi);
+        if (iR == 0 || iR == NR - 1 || iZ == 0 || iZ == NZ - 1) {
+          potential(iZ, iR, iPhi) = formulas.evalPotential(z, radius, phi);
+        }
+      }
+    }
+  }
+}
+
+static DataContainer solve(bool redBlackTiles, int nThreads)
+{
+  DataContainer charge(NZ, NR, NPHI);
+  DataContainer potential(NZ, NR, NPHI);
+  setInput(charge, potential);
+  MGParameters::isFull3D = true;
+  MGParameters::redBlackTiles = redBlackTiles;
+  PoissonSolver<DataT>::setNThreads(nThreads);
+  PoissonSolver<DataT> solver(getGrid());
+  solver.poissonSolver3D(potential, charge, 0);
+  return potential;
+}
+
+static void BM_PoissonSolver3D(benchmark::State& state)
+{
+  // reference potential from the default solver mode
+  static const DataContainer reference = solve(false, 4);
+  const bool redBlackTiles = state.range(0);
+  const int nThreads = state.range(1) ? state.range(1) : std::thread::hardware_concurrency();
+  DataT maxDiff = 0;
+  for (auto _ : state) {
+    const auto potential = solve(redBlackTiles, nThreads);
+    for (size_t i = 0; i < potential.getData().size(); ++i) {
+      maxDiff = std::max(maxDiff, std::abs(potential.getData()[i] - reference.getData()[i]));
+    }
+  }
+  state.counters["threads"] = nThreads;
+  state.counters["maxDiff"] = maxDiff;
+  MGParameters::redBlackTiles = false;
+}
+
+// arguments: use of the red-black tiles, number of threads (0: all cores)
+BENCHMARK(BM_PoissonSolver3D)->Args({0, 4})->Args({1, 4})->Args({0, 0})->Args({1, 0})->Unit(benchmark::kSecond)->Iterations(1);
+
+BENCHMARK_MAIN();
@@ -198,6 +198,42 @@ void poissonSolver3D()
   testAlmostEqualArray<DataT>(potentialAnalytical, potentialNumerical);
 }
 
+/// solve the same problem with the sequential Gauss-Seidel sweep and with the red-black tiles on several threads: the potentials have to be identical
+template <typename DataT>
+void poissonSolver3DRedBlackTilesExact(const int symmetry)
+{
+  using GridProp = GridProperties<DataT>;
+  const ParamSpaceCharge params{NR, NZ, NPHI};
+  const o2::tpc::RegularGrid3D<DataT> grid3D{GridProp::ZMIN, GridProp::RMIN, GridProp::PHIMIN, GridProp::getGridSpacingZ(NZ), GridProp::getGridSpacingR(NR), GridProp::getGridSpacingPhi(NPHI), params};
+
+  using DataContainer = o2::tpc::DataContainer3D<DataT>;
+  DataContainer potentialSequential(NZ, NR, NPHI);
+  DataContainer charge(NZ, NR, NPHI);
+
+  const o2::tpc::AnalyticalFields<DataT> analyticalFields;
+  setChargeDensityFromFormula<DataT>(analyticalFields, grid3D, charge);
+  setPotentialBoundaryFromFormula<DataT>(analyticalFields, grid3D, potentialSequential);
+  DataContainer potentialTiles = potentialSequential;
+
+  PoissonSolver<DataT> poissonSolver(grid3D);
+  const int nThreads = PoissonSolver<DataT>::getNThreads();
+  PoissonSolver<DataT>::setNThreads(4);
+  o2::tpc::MGParameters::redBlackTiles = false;
+  poissonSolver.poissonSolver3D(potentialSequential, charge, symmetry);
+  o2::tpc::MGParameters::redBlackTiles = true;
+  poissonSolver.poissonSolver3D(potentialTiles, charge, symmetry);
+  o2::tpc::MGParameters::redBlackTiles = false;
+  PoissonSolver<DataT>::setNThreads(nThreads);
+
+  for (size_t iPhi = 0; iPhi < potentialTiles.getNPhi(); ++iPhi) {
+    for (size_t iR = 0; iR < potentialTiles.getNR(); ++iR) {
+      for (size_t iZ = 0; iZ < potentialTiles.getNZ(); ++iZ) {
+        BOOST_CHECK_EQUAL(potentialTiles(iZ, iR, iPhi), potentialSequential(iZ, iR, iPhi));
+      }
+    }
+  }
+}
+
 template <typename DataT>
 void poissonSolver2D()
 {
@@ -232,6 +268,21 @@ BOOST_AUTO_TEST_CASE(PoissonSolver3D_test)
   poissonSolver3D<DataT>();
 }
 
+BOOST_AUTO_TEST_CASE(PoissonSolver3DRedBlackTiles_test)
+{
+  o2::tpc::MGParameters::isFull3D = true; // 3D
+  o2::tpc::MGParameters::redBlackTiles = true;
+  poissonSolver3D<DataT>();
+  o2::tpc::MGParameters::redBlackTiles = false;
+}
+
+BOOST_AUTO_TEST_CASE(PoissonSolver3DRedBlackTilesExact_test)
+{
+  o2::tpc::MGParameters::isFull3D = true; // 3D
+  poissonSolver3DRedBlackTilesExact<DataT>(0); // no symmetry in phi
+  poissonSolver3DRedBlackTilesExact<DataT>(1); // reflection symmetry in phi
+}
+
 BOOST_AUTO_TEST_CASE(PoissonSolver3D2D_test)
 {
   o2::tpc::MGParameters::isFull3D = false; // 3D2D
@@ -215,6 +215,7 @@ class TPCCalibPadGainTracksDevice : public o2::framework::Task
       LOGP(info, "Publishing after {} TFs", mProcessedTFs);
       mProcessedTFs = 0;
       mFirstTFSend = 0; // set to zero in order to only trigger once
+      mPadGainTracks.finalizeHistos();
       if (mDebug) {
         mPadGainTracks.dumpToFile(fmt::format("calPadGain_TF{}.root", currentTF).data());
       }
@@ -71,6 +71,7 @@ class CalibratordEdxDevice : public Task
     const auto dumpHistograms = ic.options().get<uint32_t>("dump-histograms");
     const auto trackDebug = ic.options().get<bool>("track-debug");
     const bool makeGaussianFits = !ic.options().get<bool>("disable-gaussian-fits");
+    const auto nThreads = ic.options().get<int>("nthreads");
 
     mCalibrator = std::make_unique<tpc::CalibratordEdx>();
     mCalibrator->setHistParams(dEdxBins, mindEdx, maxdEdx, angularBins, fitSnp);
@@ -85,6 +86,7 @@ class CalibratordEdxDevice : public Task
     mCalibrator->setDumpHistograms(dumpHistograms);
     mCalibrator->setTrackDebug(trackDebug);
     mCalibrator->setMakeGaussianFits(makeGaussianFits);
+    mCalibrator->setNThreads(nThreads);
 
     mCustomdEdxFileName = o2::gpu::GPUConfigurableParamGPUSettingsO2::Instance().dEdxCorrFile;
     mDisableTimeGain = o2::gpu::GPUConfigurableParamGPUSettingsO2::Instance().dEdxDisableResidualGain;
@@ -257,6 +259,7 @@ DataProcessorSpec getCalibratordEdxSpec(const o2::base::Propagator::MatCorrType
       {"file-dump-name", VariantType::String, "calibratordEdx.root", {"name of the file dump output file"}},
       {"track-debug", VariantType::Bool, false, {"track dEdx debugging"}},
       {"disable-gaussian-fits", VariantType::Bool, false, {"disable calibration with gaussian fits and use mean instead"}},
+      {"nthreads", VariantType::Int, 1, {"number of threads used to fill the dE/dx histograms"}},
     }};
 }
 
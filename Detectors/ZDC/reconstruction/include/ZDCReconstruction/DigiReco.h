@@ -118,6 +118,14 @@ class DigiReco
     LOG(warn) << __func__ << " Full waveform interpolation: " << (mFullInterpolation ? "enabled" : "disabled");
   };
   bool getFullInterpolation() { return mFullInterpolation; };
+  // Interpolate on the samples of each channel laid out contiguously across bunches with vectorized kernels
+  void setVectorizedInterpolation(bool val = true)
+  {
+    mVectorizedInterpolation = val;
+    mVectorizedInterpolationSet = true;
+    LOG(warn) << __func__ << " Vectorized waveform interpolation: " << (mVectorizedInterpolation ? "enabled" : "disabled");
+  };
+  bool getVectorizedInterpolation() { return mVectorizedInterpolation; };
   // Enable or disable TDC corrections
   void setCorrSignal(bool val = true)
   {
@@ -159,6 +167,8 @@ class DigiReco
   bool mFullInterpolationSet = false;                       /// Full waveform interpolation set via function call
   int mFullInterpolationMinLength = 2;                      /// Minimum length to perform full interpolation
   int mInterpolationStep = 25;                              /// Coarse interpolation step
+  bool mVectorizedInterpolation = false;                    /// Vectorized waveform interpolation
+  bool mVectorizedInterpolationSet = false;                 /// Vectorized waveform interpolation set via function call
   bool mCorrSignal = true;                                  /// Enable TDC signal correction
   bool mCorrSignalSet = false;                              /// TDC signal correction set via function call
   bool mCorrBackground = true;                              /// Enable TDC pile-up correction
@@ -171,6 +181,9 @@ class DigiReco
 
   O2_ZDC_DIGIRECO_FLT getPoint(int itdc, int ibeg, int iend, int i); /// Interpolation for current TDC
   void setPoint(int itdc, int ibeg, int iend, int i);                /// Interpolation for current TDC
+  void fillSamples(int isig, int ibeg, int iend);                    /// Contiguous samples for vectorized interpolation
+  const O2_ZDC_DIGIRECO_FLT* getRow(int ip);                         /// Vectorized interpolation after acquired sample ip
+  void setPoints(int isig, int ibeg, int iend);                      /// Vectorized interpolation of all points
 
   void assignTDC(int ibun, int ibeg, int iend, int itdc, int tdc, float amp); /// Set reconstructed TDC values
   void findSignals(int ibeg, int iend);                                       /// Find signals around main-main that satisfy condition on TDC
@@ -189,6 +202,12 @@ class DigiReco
   const RecoConfigZDC* mRecoConfigZDC = nullptr; /// CCDB configuration parameters
   int32_t mVerbosity = DbgMinimal;
   O2_ZDC_DIGIRECO_FLT mTS[NTS];                     /// Tapered sinc function
+  static constexpr int NTSW = 2 * TSL;              /// Number of samples contributing to an interpolated point
+  alignas(64) O2_ZDC_DIGIRECO_FLT mTSW[NTSW][TSN];  /// Tapered sinc weights by contributing sample and by phase
+  O2_ZDC_DIGIRECO_FLT mTSWNorm[TSN];                /// Sum of weights by phase
+  std::vector<O2_ZDC_DIGIRECO_FLT> mSamples;        /// Padded samples of current signal for vectorized interpolation
+  alignas(64) O2_ZDC_DIGIRECO_FLT mRow[2][TSN];     /// Cache of interpolated points following two acquired samples
+  int mRowSample[2] = {-1, -1};                     /// Acquired sample of the cached interpolated points
   bool mTreeDbg = false;                            /// Write reconstructed data in debug output file
   std::unique_ptr<TFile> mDbg = nullptr;            /// Debug output file
   std::unique_ptr<TTree> mTDbg = nullptr;           /// Debug tree
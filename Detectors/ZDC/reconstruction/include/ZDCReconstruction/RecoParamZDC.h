@@ -36,6 +36,7 @@ struct RecoParamZDC : public o2::conf::ConfigurableParamHelper<RecoParamZDC> {
   int low_pass_filter = -1;               // Low pass filtering
   int full_interpolation = -1;            // Full interpolation of waveform
   int full_interpolation_min_length = -1; // Minimum length to perform full interpolation
+  int vectorized_interpolation = -1;      // Vectorized waveform interpolation
   int corr_signal = -1;                   // TDC signal correction
   int corr_background = -1;               // TDC pile-up correction
 
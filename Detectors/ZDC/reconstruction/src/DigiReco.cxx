@@ -9,6 +9,7 @@
 // granted to it by virtue of its status as an Intergovernmental Organization
 // or submit itself to any jurisdiction.
 
+#include <algorithm>
 #include <TMath.h>
 #include "Framework/Logger.h"
 #include "ZDCReconstruction/DigiReco.h"
@@ -112,6 +113,12 @@ void DigiReco::init()
     LOG(info) << "Full waveform interpolation is " << (mFullInterpolation ? "enabled" : "disabled") << " min length is " << mFullInterpolationMinLength;
   }
 
+  // Vectorized interpolation of waveform (N.B. function call overrides other settings)
+  if (mVectorizedInterpolationSet == false) {
+    mVectorizedInterpolation = ropt.vectorized_interpolation > 0 ? true : false;
+  }
+  LOG(info) << "Vectorized waveform interpolation is " << (mVectorizedInterpolation ? "enabled" : "disabled");
+
   if (ropt.triggerCondition == 0) {
     if (!mRecoConfigZDC) {
       LOG(fatal) << "Trigger condition: missing configuration object and no manual override";
@@ -486,6 +493,21 @@ void DigiReco::prepareInterpolation()
     mTS[n + tsi] = fs * fg;
     mTS[n - tsi] = mTS[n + tsi]; // Function is even
   }
+  // Weights for vectorized interpolation: mTSW[k][im] is the weight of the k-th sample contributing
+  // to the point at phase im after an acquired sample, in the same order as in getPoint(..)
+  // Phase 0 is the acquired sample itself
+  for (int im = 0; im < TSN; im++) {
+    O2_ZDC_DIGIRECO_FLT sum = 0;
+    for (int k = 0; k < NTSW; k++) {
+      if (im == 0) {
+        mTSW[k][im] = k == (TSL - 1) ? 1 : 0;
+      } else {
+        mTSW[k][im] = mTS[TSN - im + k * TSN];
+      }
+      sum += mTSW[k][im];
+    }
+    mTSWNorm[im] = sum;
+  }
   LOG(info) << "Interpolation numeric precision is " << sizeof(O2_ZDC_DIGIRECO_FLT);
   LOG(info) << "Interpolation alpha = " << mAlpha;
 }
@@ -1390,6 +1412,10 @@ O2_ZDC_DIGIRECO_FLT DigiReco::getPoint(int isig, int ibeg, int iend, int i)
   } else if (i >= mIlast) {
     // Return value of last sample
     return mLastSample;
+  } else if (mVectorizedInterpolation) {
+    // Points following an acquired sample are computed all together
+    i = i - TSNH;
+    return getRow(i / TSN)[i % TSN];
   } else {
     // Identification of the point to be assigned
     int ibun = ibeg + i / nsbun;
@@ -1465,6 +1491,78 @@ void DigiReco::setPoint(int isig, int ibeg, int iend, int i)
   }
 } // setPoint
 
+void DigiReco::fillSamples(int isig, int ibeg, int iend)
+{
+  // Lay out the samples of signal isig in consecutive bunches from ibeg to iend in a contiguous array
+  // mSamples[ip + k] is the k-th sample contributing to the points following acquired sample ip.
+  // The array is padded with the first and last sample, as for constant extrapolation in getPoint(..)
+  mSamples.resize(mNsam + NTSW);
+  for (int is = 0; is < TSL; is++) {
+    mSamples[is] = mFirstSample;
+  }
+  auto* samples = mSamples.data() + TSL - 1;
+  for (int ibun = ibeg; ibun <= iend; ibun++) {
+    for (int ip = 0; ip < NTimeBinsPerBC; ip++) {
+      samples[ip] = mReco[ibun].data[isig][ip];
+    }
+    samples += NTimeBinsPerBC;
+  }
+  for (int is = mNsam + TSL - 1; is < mNsam + NTSW; is++) {
+    mSamples[is] = mLastSample;
+  }
+  mRowSample[0] = -1;
+  mRowSample[1] = -1;
+}
+
+const O2_ZDC_DIGIRECO_FLT* DigiReco::getRow(int ip)
+{
+  // Interpolated points from acquired sample ip (included) to the next one (excluded)
+  // Two rows are cached since the search of a peak can span two acquired samples
+  int slot = ip & 0x1;
+  if (mRowSample[slot] != ip) {
+    // The loops on phases do not depend on each other and are vectorized by the compiler
+    // The contributions to each point are summed in the same order as in getPoint(..)
+    alignas(64) O2_ZDC_DIGIRECO_FLT y[TSN] = {0};
+    const O2_ZDC_DIGIRECO_FLT* samples = mSamples.data() + ip;
+    for (int k = 0; k < NTSW; k++) {
+      const O2_ZDC_DIGIRECO_FLT yy = samples[k];
+      const O2_ZDC_DIGIRECO_FLT* w = mTSW[k];
+      for (int im = 0; im < TSN; im++) {
+        y[im] += yy * w[im];
+      }
+    }
+    O2_ZDC_DIGIRECO_FLT* row = mRow[slot];
+    for (int im = 0; im < TSN; im++) {
+      row[im] = y[im] / mTSWNorm[im];
+    }
+    mRowSample[slot] = ip;
+  }
+  return mRow[slot];
+}
+
+void DigiReco::setPoints(int isig, int ibeg, int iend)
+{
+  // Vectorized equivalent of setPoint(..) for all points
+  constexpr int nsbun = TSN * NTimeBinsPerBC; // Total number of interpolated points per bunch crossing
+  for (int i = 0; i < TSNH; i++) {
+    mReco[ibeg].inter[isig][i] = mFirstSample;
+  }
+  // Rows start at TSNH after an acquired sample: the last row of a bunch crossing continues in the next one
+  for (int ip = 0, i = TSNH; i < mIlast; ip++, i += TSN) {
+    const O2_ZDC_DIGIRECO_FLT* row = getRow(ip);
+    int ibun = ibeg + i / nsbun;
+    int isam = i % nsbun;
+    int n = std::min(TSN, nsbun - isam);
+    std::copy(row, row + n, mReco[ibun].inter[isig].begin() + isam);
+    if (n < TSN) {
+      std::copy(row + n, row + TSN, mReco[ibun + 1].inter[isig].begin());
+    }
+  }
+  for (int i = mIlast; i < mNtot; i++) {
+    mReco[iend].inter[isig][i % nsbun] = mLastSample;
+  }
+} // setPoints
+
 int DigiReco::fullInterpolation(int isig, int ibeg, int iend)
 {
   // Interpolation of signal isig, in consecutive bunches from ibeg to iend
@@ -1503,8 +1601,13 @@ int DigiReco::fullInterpolation(int isig, int ibeg, int iend)
   for (int ibun = ibeg; ibun <= iend; ibun++) {
     mReco[ibun].allocate(isig);
   }
-  for (int i = 0; i < mNtot; i++) {
-    setPoint(isig, ibeg, iend, i);
+  if (mVectorizedInterpolation) {
+    fillSamples(isig, ibeg, iend);
+    setPoints(isig, ibeg, iend);
+  } else {
+    for (int i = 0; i < mNtot; i++) {
+      setPoint(isig, ibeg, iend, i);
+    }
   }
   if (mInError) {
     return __LINE__;
@@ -1554,14 +1657,22 @@ int DigiReco::interpolate(int itdc, int ibeg, int iend)
   mFirstSample = mReco[ibeg].data[isig][0];
   mLastSample = mReco[iend].data[isig][MaxTimeBin];
 
+  if (mVectorizedInterpolation) {
+    fillSamples(isig, ibeg, iend);
+  }
+
   // mFullInterpolation turns on full interpolation for debugging
   // otherwise the interpolation is performed only around actual signal
   if (mFullInterpolation) {
     for (int ibun = ibeg; ibun <= iend; ibun++) {
       mReco[ibun].allocate(isig);
     }
-    for (int i = 0; i < mNtot; i++) {
-      setPoint(isig, ibeg, iend, i);
+    if (mVectorizedInterpolation) {
+      setPoints(isig, ibeg, iend);
+    } else {
+      for (int i = 0; i < mNtot; i++) {
+        setPoint(isig, ibeg, iend, i);
+      }
     }
   }
   if (mInError) {
@@ -26,7 +26,7 @@ void o2::zdc::RecoParamZDC::setBit(uint32_t ibit, bool val)
 void o2::zdc::RecoParamZDC::print()
 {
   bool printed = false;
-  if (low_pass_filter >= 0 || full_interpolation >= 0 || corr_signal >= 0 || corr_background >= 0) {
+  if (low_pass_filter >= 0 || full_interpolation >= 0 || vectorized_interpolation >= 0 || corr_signal >= 0 || corr_background >= 0) {
     if (!printed) {
       LOG(info) << "RecoParamZDC::print()";
       printed = true;
@@ -37,6 +37,9 @@ void o2::zdc::RecoParamZDC::print()
     if (full_interpolation >= 0) {
       printf(" FullInterpolation=%d", full_interpolation);
     }
+    if (vectorized_interpolation >= 0) {
+      printf(" VectorizedInterpolation=%d", vectorized_interpolation);
+    }
     if (corr_signal >= 0) {
       printf(" CorrSignal=%d", corr_signal);
     }
@@ -0,0 +1,124 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file DigiRecoTestInput.h
+/// \brief Configuration and synthetic digits to run the ZDC reconstruction without CCDB
+
+#ifndef ALICEO2_ZDC_DIGI_RECO_TEST_INPUT_H
+#define ALICEO2_ZDC_DIGI_RECO_TEST_INPUT_H
+
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "ZDCBase/Constants.h"
+#include "ZDCBase/ModuleConfig.h"
+#include "ZDCReconstruction/DigiReco.h"
+#include "ZDCReconstruction/RecoConfigZDC.h"
+#include "ZDCReconstruction/ZDCTDCParam.h"
+#include "DataFormatsZDC/BCData.h"
+#include "DataFormatsZDC/ChannelData.h"
+#include "DataFormatsZDC/OrbitData.h"
+
+namespace o2
+{
+namespace zdc
+{
+namespace test
+{
+
+struct DigiRecoTestInput {
+  ModuleConfig moduleConfig;
+  RecoConfigZDC recoConfig;
+  ZDCTDCParam tdcParam;
+  std::vector<OrbitData> orbitData;
+  std::vector<BCData> bcData;
+  std::vector<ChannelData> chData;
+
+  DigiRecoTestInput()
+  {
+    // All channels are read out, in order of channel ID
+    moduleConfig.baselineFactor = 1;
+    for (int im = 0; im < NModules; im++) {
+      auto& module = moduleConfig.modules[im];
+      module.id = im;
+      for (int ic = 0; ic < NChPerModule; ic++) {
+        int ich = im * NChPerModule + ic;
+        if (ich < NChannels) {
+          bool isTDC = TDCSignal[SignalTDC[ich]] == ich;
+          module.setChannel(ic, ich, 2 * im + ic / 2, true, isTDC, -5, 6, 4, 12);
+        }
+      }
+    }
+    for (int ich = 0; ich < NChannels; ich++) {
+      recoConfig.setIntegration(ich, 6, 8, -12, -8);
+    }
+  }
+
+  void configure(DigiReco& reco)
+  {
+    reco.setModuleConfig(&moduleConfig);
+    reco.setRecoConfigZDC(&recoConfig);
+    reco.setTDCParam(&tdcParam);
+    reco.setVerbosity(DbgZero);
+    reco.setCorrSignal(false);
+    reco.setCorrBackground(false);
+  }
+
+  /// Sequences of consecutive bunch crossings, one per orbit, with a signal of random
+  /// amplitude and position in each channel on top of pedestal and noise
+  void generate(int nSequences, int nBunches = 3, unsigned int seed = 1)
+  {
+    constexpr float pedestal = 100;
+    constexpr float sigma = 1.2; // Width of signal in samples
+    const int nSamples = nBunches * NTimeBinsPerBC;
+    std::mt19937 generator(seed);
+    std::normal_distribution<float> noise(0., 1.5);
+    std::uniform_real_distribution<float> amplitude(50., 1500.);
+    std::uniform_real_distribution<float> position(4., nSamples - 4.);
+    orbitData.clear();
+    bcData.clear();
+    chData.clear();
+    for (int iseq = 0; iseq < nSequences; iseq++) {
+      o2::InteractionRecord ir(100, iseq + 1);
+      OrbitData orbit;
+      orbit.ir = ir;
+      orbit.data.fill(pedestal);
+      orbitData.push_back(orbit);
+      std::array<float, NChannels> amp, pos;
+      for (int ich = 0; ich < NChannels; ich++) {
+        amp[ich] = amplitude(generator);
+        pos[ich] = position(generator);
+      }
+      for (int ib = 0; ib < nBunches; ib++) {
+        int first = chData.size();
+        uint32_t channels = 0;
+        for (int ich = 0; ich < NChannels; ich++) {
+          std::array<float, NTimeBinsPerBC> samples;
+          for (int is = 0; is < NTimeBinsPerBC; is++) {
+            float arg = (ib * NTimeBinsPerBC + is - pos[ich]) / sigma;
+            samples[is] = std::round(pedestal - amp[ich] * std::exp(-0.5 * arg * arg) + noise(generator));
+          }
+          chData.emplace_back(ich, samples);
+          channels |= 0x1 << ich;
+        }
+        bcData.emplace_back(first, NChannels, ir, channels, channels, 0);
+        ir++;
+      }
+    }
+  }
+};
+
+} // namespace test
+} // namespace zdc
+} // namespace o2
+
+#endif
@@ -0,0 +1,37 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+#include <benchmark/benchmark.h>
+
+#include "ZDCReconstruction/DigiReco.h"
+#include "DigiRecoTestInput.h"
+
+using namespace o2::zdc;
+
+// Arguments: vectorized interpolation, full interpolation
+static void BM_DigiReco(benchmark::State& state)
+{
+  test::DigiRecoTestInput input;
+  input.generate(500);
+  DigiReco reco;
+  input.configure(reco);
+  reco.setVectorizedInterpolation(state.range(0));
+  reco.setFullInterpolation(state.range(1));
+  reco.init();
+  for (auto _ : state) {
+    reco.process(input.orbitData, input.bcData, input.chData);
+    benchmark::DoNotOptimize(reco.getReco().data());
+  }
+  state.counters["BC/s"] = benchmark::Counter(state.iterations() * input.bcData.size(), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_DigiReco)->Args({0, 0})->Args({1, 0})->Args({0, 1})->Args({1, 1})->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
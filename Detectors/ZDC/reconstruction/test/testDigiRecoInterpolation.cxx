@@ -0,0 +1,125 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#define BOOST_TEST_MODULE Test ZDC DigiReco interpolation
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <cmath>
+#include "ZDCReconstruction/DigiReco.h"
+#include "DigiRecoTestInput.h"
+
+using namespace o2::zdc;
+
+// The vectorized interpolation adds the same terms in the same order as the scalar one, results
+// can only differ by rounding if the compiler contracts multiplications and additions differently
+constexpr float AmpTolerance = 0.01;
+
+// Reconstruct the same data with the scalar and the vectorized interpolation
+static void compareInterpolation(bool fullInterpolation)
+{
+  test::DigiRecoTestInput input;
+  input.generate(200);
+
+  DigiReco scalar, vectorized;
+  input.configure(scalar);
+  input.configure(vectorized);
+  scalar.setVectorizedInterpolation(false);
+  vectorized.setVectorizedInterpolation(true);
+  scalar.setFullInterpolation(fullInterpolation);
+  vectorized.setFullInterpolation(fullInterpolation);
+  scalar.init();
+  vectorized.init();
+  BOOST_REQUIRE(scalar.process(input.orbitData, input.bcData, input.chData) == 0);
+  BOOST_REQUIRE(vectorized.process(input.orbitData, input.bcData, input.chData) == 0);
+
+  auto& recS = scalar.getReco();
+  auto& recV = vectorized.getReco();
+  BOOST_REQUIRE(recS.size() == recV.size());
+  int nhits = 0;
+  float maxInterDiff = 0;
+  for (size_t ibc = 0; ibc < recS.size(); ibc++) {
+    for (int itdc = 0; itdc < NTDCChannels; itdc++) {
+      BOOST_REQUIRE(recS[ibc].TDCVal[itdc].size() == recV[ibc].TDCVal[itdc].size());
+      for (size_t ihit = 0; ihit < recS[ibc].TDCVal[itdc].size(); ihit++) {
+        // A tie between two points of the waveform can be resolved differently
+        BOOST_CHECK(std::abs(recS[ibc].TDCVal[itdc][ihit] - recV[ibc].TDCVal[itdc][ihit]) <= 1);
+        BOOST_CHECK_SMALL(recS[ibc].TDCAmp[itdc][ihit] - recV[ibc].TDCAmp[itdc][ihit], AmpTolerance);
+        nhits++;
+      }
+    }
+    BOOST_CHECK(recS[ibc].ezdc == recV[ibc].ezdc);
+    for (int isig = 0; isig < NChannels; isig++) {
+      BOOST_REQUIRE(recS[ibc].inter[isig].size() == recV[ibc].inter[isig].size());
+      for (size_t i = 0; i < recS[ibc].inter[isig].size(); i++) {
+        maxInterDiff = std::max(maxInterDiff, std::abs(recS[ibc].inter[isig][i] - recV[ibc].inter[isig][i]));
+      }
+    }
+  }
+  BOOST_CHECK(nhits > 0);
+  BOOST_CHECK_SMALL(maxInterDiff, AmpTolerance);
+}
+
+BOOST_AUTO_TEST_CASE(DigiReco_VectorizedInterpolation)
+{
+  compareInterpolation(false);
+}
+
+BOOST_AUTO_TEST_CASE(DigiReco_VectorizedFullInterpolation)
+{
+  compareInterpolation(true);
+}
+
+// Every interpolated point of sequences of consecutive bunch crossings, in particular the points
+// around the boundaries between bunches, must match the point by point interpolation (getPoint)
+BOOST_AUTO_TEST_CASE(DigiReco_VectorizedInterpolationBunchBoundaries)
+{
+  constexpr int nBunches = 5;
+  constexpr int nsbun = TSN * NTimeBinsPerBC; // Total number of interpolated points per bunch crossing
+  test::DigiRecoTestInput input;
+  input.generate(20, nBunches, 2);
+
+  DigiReco scalar, vectorized;
+  input.configure(scalar);
+  input.configure(vectorized);
+  scalar.setVectorizedInterpolation(false);
+  vectorized.setVectorizedInterpolation(true);
+  scalar.setFullInterpolation(true);
+  vectorized.setFullInterpolation(true);
+  scalar.init();
+  vectorized.init();
+  BOOST_REQUIRE(scalar.process(input.orbitData, input.bcData, input.chData) == 0);
+  BOOST_REQUIRE(vectorized.process(input.orbitData, input.bcData, input.chData) == 0);
+
+  auto& recS = scalar.getReco();
+  auto& recV = vectorized.getReco();
+  BOOST_REQUIRE(recS.size() == recV.size());
+  int nchecked = 0;
+  for (size_t ibc = 0; ibc < recS.size(); ibc++) {
+    for (int isig = 0; isig < NChannels; isig++) {
+      const auto& interS = recS[ibc].inter[isig];
+      const auto& interV = recV[ibc].inter[isig];
+      BOOST_REQUIRE(interS.size() == interV.size());
+      if (interS.empty()) {
+        continue;
+      }
+      BOOST_REQUIRE(interS.size() == nsbun);
+      for (int i = 0; i < nsbun; i++) {
+        if (std::abs(interS[i] - interV[i]) > AmpTolerance) {
+          BOOST_ERROR("bunch " << ibc << " signal " << isig << " point " << i << ": " << interV[i] << " != " << interS[i]);
+        }
+      }
+      nchecked++;
+    }
+  }
+  BOOST_CHECK(nchecked > 0);
+}
@@ -17,6 +17,8 @@
 #include "Framework/Output.h"
 #include "Framework/OutputRef.h"
 #include "Framework/OutputRoute.h"
+#include "Framework/OutputRouteIndex.h"
+#include "Framework/OutputHeaderTemplate.h"
 #include "Framework/DataChunk.h"
 #include "Framework/FairMQDeviceProxy.h"
 #include "Framework/TimingInfo.h"
@@ -551,6 +553,9 @@ class DataAllocator
 
  private:
   ServiceRegistryRef mRegistry;
+  /// Lookup table for the output routes, built on first use
+  OutputRouteIndex mRouteIndex;
+  OutputHeaderTemplate mHeaderTemplate;
 
   RouteIndex matchDataHeader(const Output& spec, size_t timeframeId);
   fair::mq::MessagePtr headerMessageFromOutput(Output const& spec,                                  //
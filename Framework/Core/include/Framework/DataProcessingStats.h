@@ -65,6 +65,8 @@ enum struct ProcessingStatsId : short {
   RESOURCES_MISSING,
   RESOURCES_INSUFFICIENT,
   RESOURCES_SATISFACTORY,
+  PREFORMATTED_HEADER_MESSAGES,
+  STACKED_HEADER_MESSAGES,
   AVAILABLE_MANAGED_SHM_BASE = 512,
 };
 
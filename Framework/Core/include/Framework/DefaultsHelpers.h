@@ -22,6 +22,10 @@ struct DefaultsHelpers {
   static bool onlineDeploymentMode();
   /// get max number of timeslices in the queue
   static unsigned int pipelineLength();
+  /// @true if header messages of outputs should be created from a preformatted template
+  static bool preformattedHeaders();
+  /// @true if the String and Arrow outputs going to the same channel should be sent as a single multipart message
+  static bool coalesceOutputs();
 };
 } // namespace o2::framework
 
@@ -0,0 +1,60 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+#ifndef O2_FRAMEWORK_OUTPUTHEADERTEMPLATE_H_
+#define O2_FRAMEWORK_OUTPUTHEADERTEMPLATE_H_
+
+#include "Framework/DataProcessingHeader.h"
+#include "Framework/Output.h"
+#include "Framework/TimingInfo.h"
+#include "Headers/DataHeader.h"
+
+#include <fairmq/FwdDecls.h>
+
+#include <cstddef>
+
+namespace o2::framework
+{
+
+/// Preformatted DataHeader + DataProcessingHeader stack for outputs
+/// without additional meta headers.
+///
+/// The constant part of the stack (header sizes, versions, types and the
+/// next header flags) is serialized once. Creating a header message is then
+/// a copy of the template into a new message of the output transport,
+/// followed by patching the per message fields in place, without going
+/// through the polymorphic allocator machinery of o2::header::Stack.
+/// The result is identical to the stack created by
+/// o2::header::Stack{alloc, DataHeader{...}, DataProcessingHeader{...}}.
+class OutputHeaderTemplate
+{
+ public:
+  OutputHeaderTemplate();
+
+  /// Size of the serialized header stack
+  static constexpr size_t size() { return sizeof(header::DataHeader) + sizeof(DataProcessingHeader); }
+
+  /// Serialize the header stack for @a spec into @a buffer, which must
+  /// hold at least size() bytes and be aligned as a DataHeader.
+  void writeTo(std::byte* buffer, Output const& spec, header::SerializationMethod method,
+               size_t payloadSize, TimingInfo const& timingInfo) const;
+
+  /// @return a new header message created by @a transport for the given output.
+  fair::mq::MessagePtr createMessage(fair::mq::TransportFactory& transport, Output const& spec,
+                                     header::SerializationMethod method, size_t payloadSize,
+                                     TimingInfo const& timingInfo) const;
+
+ private:
+  alignas(64) std::byte mTemplate[size()];
+};
+
+} // namespace o2::framework
+
+#endif // O2_FRAMEWORK_OUTPUTHEADERTEMPLATE_H_
@@ -0,0 +1,65 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+#ifndef O2_FRAMEWORK_OUTPUTROUTEINDEX_H_
+#define O2_FRAMEWORK_OUTPUTROUTEINDEX_H_
+
+#include "Framework/ConcreteDataMatcher.h"
+#include "Framework/OutputRoute.h"
+#include "Framework/RoutingIndices.h"
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+namespace o2::framework
+{
+
+/// Lookup table from a concrete (origin, description, subSpec) to the
+/// output routes of a device which can be used to send it.
+///
+/// For every route with a concrete matcher the list of candidate routes
+/// (including the wildcard ones which also match) is precomputed in
+/// build(), so that a lookup is a single hash access followed by the
+/// selection of the candidate matching the timeslice. Data types which
+/// are only covered by wildcard routes are resolved on first use and
+/// memoised. The resulting route is always the same one a linear scan
+/// over the routes would find.
+class OutputRouteIndex
+{
+ public:
+  /// Precompute the candidates for all the concrete routes.
+  /// @a routes must outlive the index.
+  void build(std::vector<OutputRoute> const& routes);
+
+  /// @return true if build() was invoked.
+  [[nodiscard]] bool isBuilt() const { return mRoutes != nullptr; }
+
+  /// @return the route matching @a matcher for the given @a timeslice,
+  /// or RouteIndex{-1} if there is none.
+  RouteIndex lookup(ConcreteDataMatcher const& matcher, size_t timeslice);
+
+ private:
+  struct MatcherHash {
+    size_t operator()(ConcreteDataMatcher const& matcher) const noexcept;
+  };
+
+  /// @return all the routes which match @a matcher, in route order.
+  std::vector<int> findCandidates(ConcreteDataMatcher const& matcher, std::vector<int> const& routes) const;
+
+  std::vector<OutputRoute> const* mRoutes = nullptr;
+  /// Indices of the routes which do not have a concrete matcher
+  std::vector<int> mWildcardRoutes;
+  std::unordered_map<ConcreteDataMatcher, std::vector<int>, MatcherHash> mCandidates;
+};
+
+} // namespace o2::framework
+
+#endif // O2_FRAMEWORK_OUTPUTROUTEINDEX_H_
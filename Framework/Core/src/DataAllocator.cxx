@@ -18,6 +18,8 @@
 #include "Framework/DataProcessingHeader.h"
 #include "Framework/FairMQResizableBuffer.h"
 #include "Framework/DataProcessingContext.h"
+#include "Framework/DataProcessingStats.h"
+#include "Framework/DefaultsHelpers.h"
 #include "Framework/DeviceSpec.h"
 #include "Framework/StreamContext.h"
 #include "Framework/Signpost.h"
@@ -55,16 +57,17 @@ RouteIndex DataAllocator::matchDataHeader(const Output& spec, size_t timeslice)
 {
   auto& allowedOutputRoutes = mRegistry.get<DeviceSpec const>().outputs;
   auto& stream = mRegistry.get<o2::framework::StreamContext>();
-  // FIXME: we should take timeframeId into account as well.
-  for (auto ri = 0; ri < allowedOutputRoutes.size(); ++ri) {
+  if (!mRouteIndex.isBuilt()) {
+    mRouteIndex.build(allowedOutputRoutes);
+  }
+  auto ri = mRouteIndex.lookup(ConcreteDataMatcher{spec.origin, spec.description, spec.subSpec}, timeslice).value;
+  if (ri >= 0) {
     auto& route = allowedOutputRoutes[ri];
-    if (DataSpecUtils::match(route.matcher, spec.origin, spec.description, spec.subSpec) && ((timeslice % route.maxTimeslices) == route.timeslice)) {
-      stream.routeCreated.at(ri) = true;
-      auto sid = _o2_signpost_id_t{(int64_t)&stream};
-      O2_SIGNPOST_EVENT_EMIT(stream_context, sid, "data_allocator", "Route %" PRIu64 " (%{public}s) created for timeslice %" PRIu64,
-                             (uint64_t)ri, DataSpecUtils::describe(route.matcher).c_str(), (uint64_t)timeslice);
-      return RouteIndex{ri};
-    }
+    stream.routeCreated.at(ri) = true;
+    auto sid = _o2_signpost_id_t{(int64_t)&stream};
+    O2_SIGNPOST_EVENT_EMIT(stream_context, sid, "data_allocator", "Route %" PRIu64 " (%{public}s) created for timeslice %" PRIu64,
+                           (uint64_t)ri, DataSpecUtils::describe(route.matcher).c_str(), (uint64_t)timeslice);
+    return RouteIndex{ri};
   }
   throw runtime_error_f(
     "Worker is not authorised to create message with "
@@ -110,6 +113,20 @@ fair::mq::MessagePtr DataAllocator::headerMessageFromOutput(Output const& spec,
                                                             size_t payloadSize)                     //
 {
   auto& timingInfo = mRegistry.get<TimingInfo>();
+  auto& proxy = mRegistry.get<FairMQDeviceProxy>();
+  auto* transport = proxy.getOutputTransport(routeIndex);
+
+  if (DefaultsHelpers::preformattedHeaders()) {
+    auto& stats = mRegistry.get<DataProcessingStats>();
+    // Extra headers change the layout of the stack, so those
+    // still go through the generic o2::header::Stack.
+    if (spec.metaHeader.size() == 0) {
+      stats.updateStats({static_cast<short>(ProcessingStatsId::PREFORMATTED_HEADER_MESSAGES), DataProcessingStats::Op::Add, 1});
+      return mHeaderTemplate.createMessage(*transport, spec, method, payloadSize, timingInfo);
+    }
+    stats.updateStats({static_cast<short>(ProcessingStatsId::STACKED_HEADER_MESSAGES), DataProcessingStats::Op::Add, 1});
+  }
+
   DataHeader dh;
   dh.dataOrigin = spec.origin;
   dh.dataDescription = spec.description;
@@ -122,8 +139,6 @@ fair::mq::MessagePtr DataAllocator::headerMessageFromOutput(Output const& spec,
 
   DataProcessingHeader dph{timingInfo.timeslice, 1, timingInfo.creation};
   static_cast<o2::header::BaseHeader&>(dph).flagsDerivedHeader |= timingInfo.keepAtEndOfStream ? DataProcessingHeader::KEEP_AT_EOS_FLAG : 0;
-  auto& proxy = mRegistry.get<FairMQDeviceProxy>();
-  auto* transport = proxy.getOutputTransport(routeIndex);
 
   auto channelAlloc = o2::pmr::getTransportAllocator(transport);
   return o2::pmr::getMessage(o2::header::Stack{channelAlloc, dh, dph, spec.metaHeader});
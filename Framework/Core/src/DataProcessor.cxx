@@ -19,6 +19,7 @@
 #include "Framework/FairMQResizableBuffer.h"
 #include "Framework/FairMQDeviceProxy.h"
 #include "Framework/DeviceState.h"
+#include "Framework/DefaultsHelpers.h"
 #include "Headers/DataHeader.h"
 #include "Headers/DataHeaderHelpers.h"
 
@@ -35,6 +36,57 @@ using DataHeader = o2::header::DataHeader;
 namespace o2::framework
 {
 
+namespace
+{
+/// Helper to either send the header / payload pair right away or to
+/// append it to the parts of its channel. If DefaultsHelpers::coalesceOutputs()
+/// is enabled, the outputs of the String and Arrow contexts which go to the same
+/// channel are sent as a single multipart message, like it is done for the
+/// MessageContext, rather than with one send per output.
+struct OutputBatcher {
+  OutputBatcher(DataSender& sender, FairMQDeviceProxy& proxy)
+    : sender{sender},
+      proxy{proxy},
+      coalesce{DefaultsHelpers::coalesceOutputs()}
+  {
+    if (coalesce) {
+      outputsPerChannel.resize(proxy.getNumOutputChannels());
+    }
+  }
+
+  void add(RouteIndex routeIndex, fair::mq::MessagePtr&& header, fair::mq::MessagePtr&& payload)
+  {
+    auto channelIndex = proxy.getOutputChannelIndex(routeIndex);
+    if (coalesce) {
+      outputsPerChannel[channelIndex.value].AddPart(std::move(header));
+      outputsPerChannel[channelIndex.value].AddPart(std::move(payload));
+      return;
+    }
+    fair::mq::Parts parts;
+    parts.AddPart(std::move(header));
+    parts.AddPart(std::move(payload));
+    sender.send(parts, channelIndex);
+  }
+
+  void flush()
+  {
+    for (int ci = 0; ci < outputsPerChannel.size(); ++ci) {
+      auto& parts = outputsPerChannel[ci];
+      if (parts.Size() == 0) {
+        continue;
+      }
+      sender.send(parts, {ci});
+    }
+    outputsPerChannel.clear();
+  }
+
+  DataSender& sender;
+  FairMQDeviceProxy& proxy;
+  bool coalesce = false;
+  std::vector<fair::mq::Parts> outputsPerChannel;
+};
+} // namespace
+
 void DataProcessor::doSend(DataSender& sender, MessageContext& context, ServiceRegistryRef services)
 {
   auto& proxy = services.get<FairMQDeviceProxy>();
@@ -61,9 +113,8 @@ void DataProcessor::doSend(DataSender& sender, MessageContext& context, ServiceR
 
 void DataProcessor::doSend(DataSender& sender, StringContext& context, ServiceRegistryRef services)
 {
-  auto& proxy = services.get<FairMQDeviceProxy>();
+  OutputBatcher batcher{sender, services.get<FairMQDeviceProxy>()};
   for (auto& messageRef : context) {
-    fair::mq::Parts parts;
     fair::mq::MessagePtr payload(sender.create(messageRef.routeIndex));
     auto a = messageRef.payload.get();
     // Rebuild the message using the string as input. For now it involves a copy.
@@ -73,10 +124,9 @@ void DataProcessor::doSend(DataSender& sender, StringContext& context, ServiceRe
     // exposing it to the user in the first place.
     auto* dh = const_cast<DataHeader*>(cdh);
     dh->payloadSize = payload->GetSize();
-    parts.AddPart(std::move(messageRef.header));
-    parts.AddPart(std::move(payload));
-    sender.send(parts, proxy.getOutputChannelIndex(messageRef.routeIndex));
+    batcher.add(messageRef.routeIndex, std::move(messageRef.header), std::move(payload));
   }
+  batcher.flush();
 }
 
 void DataProcessor::doSend(DataSender& sender, ArrowContext& context, ServiceRegistryRef registry)
@@ -89,9 +139,8 @@ void DataProcessor::doSend(DataSender& sender, ArrowContext& context, ServiceReg
   auto& stats = registry.get<DataProcessingStats>();
 
   static const std::regex invalid_metric(" ");
-  auto& proxy = registry.get<FairMQDeviceProxy>();
+  OutputBatcher batcher{sender, registry.get<FairMQDeviceProxy>()};
   for (auto& messageRef : context) {
-    fair::mq::Parts parts;
     // Depending on how the arrow table is constructed, we finalize
     // the writing here.
     messageRef.finalize(messageRef.buffer);
@@ -117,10 +166,9 @@ void DataProcessor::doSend(DataSender& sender, ArrowContext& context, ServiceReg
     LOGP(detail, "Creating {}MB for table {}/{}/{}.", payload->GetSize() / 1000000., dh->dataOrigin, dh->dataDescription, version);
     context.updateBytesSent(payload->GetSize());
     context.updateMessagesSent(1);
-    parts.AddPart(std::move(messageRef.header));
-    parts.AddPart(std::move(payload));
-    sender.send(parts, proxy.getOutputChannelIndex(messageRef.routeIndex));
+    batcher.add(messageRef.routeIndex, std::move(messageRef.header), std::move(payload));
   }
+  batcher.flush();
   static int64_t previousBytesSent = 0;
   auto disposeResources = [bs = context.bytesSent() - previousBytesSent](int taskId,
                                                                          std::array<ComputingQuotaOffer, 16>& offers,
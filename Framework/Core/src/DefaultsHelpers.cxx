@@ -35,6 +35,18 @@ unsigned int DefaultsHelpers::pipelineLength()
   }
 }
 
+bool DefaultsHelpers::preformattedHeaders()
+{
+  static bool enabled = getenv("DPL_PREFORMATTED_HEADERS") && atoi(getenv("DPL_PREFORMATTED_HEADERS"));
+  return enabled;
+}
+
+bool DefaultsHelpers::coalesceOutputs()
+{
+  static bool enabled = getenv("DPL_COALESCE_OUTPUTS") && atoi(getenv("DPL_COALESCE_OUTPUTS"));
+  return enabled;
+}
+
 static DeploymentMode getDeploymentMode_internal()
 {
   char* explicitMode = getenv("O2_DPL_DEPLOYMENT_MODE");
@@ -0,0 +1,61 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+#include "Framework/OutputHeaderTemplate.h"
+
+#include <fairmq/Message.h>
+#include <fairmq/TransportFactory.h>
+
+#include <cstring>
+#include <new>
+
+namespace o2::framework
+{
+
+using DataHeader = o2::header::DataHeader;
+
+OutputHeaderTemplate::OutputHeaderTemplate()
+{
+  auto* dh = new (mTemplate) DataHeader{};
+  dh->flagsNextHeader = 1;
+  auto* dph = new (mTemplate + sizeof(DataHeader)) DataProcessingHeader{0, 1, 0};
+  dph->flagsNextHeader = 0;
+}
+
+void OutputHeaderTemplate::writeTo(std::byte* buffer, Output const& spec, header::SerializationMethod method,
+                                   size_t payloadSize, TimingInfo const& timingInfo) const
+{
+  std::memcpy(buffer, mTemplate, size());
+  auto* dh = reinterpret_cast<DataHeader*>(buffer);
+  dh->dataOrigin = spec.origin;
+  dh->dataDescription = spec.description;
+  dh->subSpecification = spec.subSpec;
+  dh->payloadSize = payloadSize;
+  dh->payloadSerializationMethod = method;
+  dh->tfCounter = timingInfo.tfCounter;
+  dh->firstTForbit = timingInfo.firstTForbit;
+  dh->runNumber = timingInfo.runNumber;
+
+  auto* dph = reinterpret_cast<DataProcessingHeader*>(buffer + sizeof(DataHeader));
+  dph->startTime = timingInfo.timeslice;
+  dph->creation = timingInfo.creation;
+  static_cast<o2::header::BaseHeader*>(dph)->flagsDerivedHeader = timingInfo.keepAtEndOfStream ? DataProcessingHeader::KEEP_AT_EOS_FLAG : 0;
+}
+
+fair::mq::MessagePtr OutputHeaderTemplate::createMessage(fair::mq::TransportFactory& transport, Output const& spec,
+                                                         header::SerializationMethod method, size_t payloadSize,
+                                                         TimingInfo const& timingInfo) const
+{
+  auto message = transport.CreateMessage(size(), fair::mq::Alignment{64});
+  writeTo(static_cast<std::byte*>(message->GetData()), spec, method, payloadSize, timingInfo);
+  return message;
+}
+
+} // namespace o2::framework
@@ -0,0 +1,83 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+#include "Framework/OutputRouteIndex.h"
+#include "Framework/DataSpecUtils.h"
+
+#include <functional>
+
+namespace o2::framework
+{
+
+size_t OutputRouteIndex::MatcherHash::operator()(ConcreteDataMatcher const& matcher) const noexcept
+{
+  size_t seed = std::hash<uint32_t>{}(matcher.origin.itg[0]);
+  auto combine = [&seed](size_t value) {
+    seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+  };
+  combine(std::hash<uint64_t>{}(matcher.description.itg[0]));
+  combine(std::hash<uint64_t>{}(matcher.description.itg[1]));
+  combine(std::hash<uint32_t>{}(matcher.subSpec));
+  return seed;
+}
+
+void OutputRouteIndex::build(std::vector<OutputRoute> const& routes)
+{
+  mRoutes = &routes;
+  mCandidates.clear();
+  mWildcardRoutes.clear();
+
+  std::vector<int> allRoutes;
+  allRoutes.reserve(routes.size());
+  for (int ri = 0; ri < (int)routes.size(); ++ri) {
+    allRoutes.push_back(ri);
+    if (!DataSpecUtils::asOptionalConcreteDataMatcher(routes[ri].matcher)) {
+      mWildcardRoutes.push_back(ri);
+    }
+  }
+
+  for (auto& route : routes) {
+    auto concrete = DataSpecUtils::asOptionalConcreteDataMatcher(route.matcher);
+    if (!concrete || mCandidates.contains(*concrete)) {
+      continue;
+    }
+    mCandidates.emplace(*concrete, findCandidates(*concrete, allRoutes));
+  }
+}
+
+std::vector<int> OutputRouteIndex::findCandidates(ConcreteDataMatcher const& matcher, std::vector<int> const& routes) const
+{
+  std::vector<int> candidates;
+  for (auto ri : routes) {
+    if (DataSpecUtils::match((*mRoutes)[ri].matcher, matcher.origin, matcher.description, matcher.subSpec)) {
+      candidates.push_back(ri);
+    }
+  }
+  return candidates;
+}
+
+RouteIndex OutputRouteIndex::lookup(ConcreteDataMatcher const& matcher, size_t timeslice)
+{
+  auto it = mCandidates.find(matcher);
+  if (it == mCandidates.end()) {
+    // No concrete route for this data type, so only the wildcard ones
+    // can match. Remember the result for the next time.
+    it = mCandidates.emplace(matcher, findCandidates(matcher, mWildcardRoutes)).first;
+  }
+  for (auto ri : it->second) {
+    auto& route = (*mRoutes)[ri];
+    if ((timeslice % route.maxTimeslices) == route.timeslice) {
+      return RouteIndex{ri};
+    }
+  }
+  return RouteIndex{-1};
+}
+
+} // namespace o2::framework
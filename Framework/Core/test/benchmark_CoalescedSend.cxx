@@ -0,0 +1,128 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// Throughput of many small String or Arrow outputs sent by DataProcessor::doSend
+/// from a producer to a consumer on the same channel. Run it with and without
+/// DPL_COALESCE_OUTPUTS=1 to compare one send per output with a single multipart
+/// send per channel:
+///   o2-framework-core-benchmark-CoalescedSend --run -b --nOutputs 256 --output-type arrow
+///   DPL_COALESCE_OUTPUTS=1 o2-framework-core-benchmark-CoalescedSend --run -b --nOutputs 256 --output-type arrow
+
+#include "Framework/ConfigParamSpec.h"
+#include <vector>
+
+using namespace o2::framework;
+
+// we need to add workflow options before including Framework/runDataProcessing
+void customize(std::vector<ConfigParamSpec>& workflowOptions)
+{
+  workflowOptions.push_back(
+    ConfigParamSpec{
+      "nOutputs", VariantType::Int, 64, {"number of outputs of the producer per timeslice"}});
+  workflowOptions.push_back(
+    ConfigParamSpec{
+      "output-type", VariantType::String, "string", {"type of the outputs: string, arrow"}});
+  workflowOptions.push_back(
+    ConfigParamSpec{
+      "runningTime", VariantType::Int, 30, {"time to run the workflow"}});
+}
+
+#include "Framework/runDataProcessing.h"
+#include "Framework/ControlService.h"
+#include "Framework/CallbackService.h"
+#include "Framework/DataAllocator.h"
+#include "Framework/DefaultsHelpers.h"
+#include "Framework/EndOfStreamContext.h"
+#include "Framework/InputRecord.h"
+#include "Framework/InputRecordWalker.h"
+#include "Framework/TableBuilder.h"
+#include "Framework/Logger.h"
+#include "Headers/DataHeader.h"
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+using DataHeader = o2::header::DataHeader;
+using benchclock = std::chrono::high_resolution_clock;
+
+WorkflowSpec defineDataProcessing(ConfigContext const& config)
+{
+  const int nOutputs = config.options().get<int>("nOutputs");
+  const auto outputType = config.options().get<std::string>("output-type");
+  const int runningTime = config.options().get<int>("runningTime");
+  if (outputType != "string" && outputType != "arrow") {
+    throw std::runtime_error("invalid output type '" + outputType + "', expecting string or arrow");
+  }
+  const bool arrowOutputs = outputType == "arrow";
+
+  Outputs outputs;
+  for (int i = 0; i < nOutputs; i++) {
+    outputs.emplace_back(OutputSpec{"TST", "BENCH", static_cast<DataHeader::SubSpecificationType>(i)});
+  }
+
+  DataProcessorSpec producer{
+    "producer",
+    Inputs{},
+    outputs,
+    AlgorithmSpec{[nOutputs, arrowOutputs, runningTime](ProcessingContext& pc) {
+      static auto startTime = benchclock::now();
+      static bool finished = false;
+      if (finished) {
+        return;
+      }
+      for (int i = 0; i < nOutputs; i++) {
+        Output output{"TST", "BENCH", static_cast<DataHeader::SubSpecificationType>(i)};
+        if (arrowOutputs) {
+          auto table = pc.outputs().make<TableBuilder>(output);
+          auto rowWriter = table->persist<int>({"index"});
+          rowWriter(0, i);
+        } else {
+          pc.outputs().make<std::string>(output, "benchmark");
+        }
+      }
+      auto elapsedTime = std::chrono::duration_cast<std::chrono::seconds>(benchclock::now() - startTime);
+      if (elapsedTime.count() >= runningTime) {
+        finished = true;
+        pc.services().get<ControlService>().endOfStream();
+        pc.services().get<ControlService>().readyToQuit(QuitRequest::Me);
+      }
+    }}};
+
+  DataProcessorSpec consumer{
+    "consumer",
+    Inputs{{"input", ConcreteDataTypeMatcher{"TST", "BENCH"}}},
+    Outputs{},
+    AlgorithmSpec{adaptStateful([nOutputs, outputType](CallbackService& callbacks) {
+      struct Counters {
+        benchclock::time_point startTime = benchclock::now();
+        size_t nTimeslices = 0;
+        size_t nOutputs = 0;
+      };
+      auto counters = std::make_shared<Counters>();
+      callbacks.set<CallbackService::Id::EndOfStream>([counters, nOutputs, outputType](EndOfStreamContext&) {
+        auto totalTime = std::chrono::duration_cast<std::chrono::duration<double>>(benchclock::now() - counters->startTime).count();
+        LOGP(info, "{} {} outputs per timeslice (coalesced outputs: {}): {} timeslices in {:.1f} s, {:.1f} timeslices/s, {:.1f} outputs/s",
+             nOutputs, outputType, DefaultsHelpers::coalesceOutputs(), counters->nTimeslices, totalTime,
+             counters->nTimeslices / totalTime, counters->nOutputs / totalTime);
+      });
+      return adaptStateless([counters](InputRecord& inputs) {
+        for (auto const& ref : InputRecordWalker(inputs)) {
+          if (ref.payload != nullptr) {
+            ++counters->nOutputs;
+          }
+        }
+        ++counters->nTimeslices;
+      });
+    })}};
+
+  return WorkflowSpec{producer, consumer};
+}
@@ -0,0 +1,83 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+#include <benchmark/benchmark.h>
+
+#include "Framework/OutputRouteIndex.h"
+#include "Framework/DataSpecUtils.h"
+#include <array>
+#include <vector>
+
+using namespace o2::framework;
+
+// Routes of a producer with one output per (description, subSpec),
+// e.g. a TPC sector writer or a ITS / MFT decoder per link.
+static std::vector<OutputRoute> createRoutes(int nSubSpecs, int nPipelines)
+{
+  std::array<o2::header::DataDescription, 4> descriptions{"CLUSTERS", "CLUSREFS", "MCLABELS", "TRACKS"};
+  std::vector<OutputRoute> routes;
+  for (auto& description : descriptions) {
+    for (int subSpec = 0; subSpec < nSubSpecs; ++subSpec) {
+      for (int pipeline = 0; pipeline < nPipelines; ++pipeline) {
+        routes.push_back(OutputRoute{(size_t)pipeline, (size_t)nPipelines, OutputSpec{"TST", description, (uint32_t)subSpec}, "channel", nullptr});
+      }
+    }
+  }
+  return routes;
+}
+
+// The previous linear scan done in DataAllocator::matchDataHeader
+static void BM_OutputRouteLinearScan(benchmark::State& state)
+{
+  auto routes = createRoutes(state.range(0), 2);
+  std::vector<ConcreteDataMatcher> outputs;
+  for (auto& route : routes) {
+    outputs.push_back(*DataSpecUtils::asOptionalConcreteDataMatcher(route.matcher));
+  }
+  size_t timeslice = 0;
+  for (auto _ : state) {
+    for (auto& output : outputs) {
+      for (size_t ri = 0; ri < routes.size(); ++ri) {
+        auto& route = routes[ri];
+        if (DataSpecUtils::match(route.matcher, output.origin, output.description, output.subSpec) && ((timeslice % route.maxTimeslices) == route.timeslice)) {
+          benchmark::DoNotOptimize(ri);
+          break;
+        }
+      }
+    }
+    ++timeslice;
+  }
+  state.counters["messages/s"] = benchmark::Counter(state.iterations() * outputs.size(), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_OutputRouteLinearScan)->Arg(1)->Arg(36)->Arg(144);
+
+static void BM_OutputRouteIndex(benchmark::State& state)
+{
+  auto routes = createRoutes(state.range(0), 2);
+  std::vector<ConcreteDataMatcher> outputs;
+  for (auto& route : routes) {
+    outputs.push_back(*DataSpecUtils::asOptionalConcreteDataMatcher(route.matcher));
+  }
+  OutputRouteIndex index;
+  index.build(routes);
+  size_t timeslice = 0;
+  for (auto _ : state) {
+    for (auto& output : outputs) {
+      benchmark::DoNotOptimize(index.lookup(output, timeslice));
+    }
+    ++timeslice;
+  }
+  state.counters["messages/s"] = benchmark::Counter(state.iterations() * outputs.size(), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_OutputRouteIndex)->Arg(1)->Arg(36)->Arg(144);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,119 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// String, Arrow and raw outputs of the same timeslice going to the same consumer.
+/// The test is run with and without DPL_COALESCE_OUTPUTS=1, i.e. with the String
+/// and Arrow outputs sent one by one or as a single multipart message per channel,
+/// and the consumer checks that every input is received once with its content.
+
+#include "Framework/ConfigParamSpec.h"
+#include "Framework/runDataProcessing.h"
+#include "Framework/ControlService.h"
+#include "Framework/CallbackService.h"
+#include "Framework/DataAllocator.h"
+#include "Framework/DefaultsHelpers.h"
+#include "Framework/EndOfStreamContext.h"
+#include "Framework/InputRecord.h"
+#include "Framework/TableBuilder.h"
+#include "Framework/TableConsumer.h"
+#include "Framework/Logger.h"
+#include <arrow/array.h>
+#include <arrow/table.h>
+#include <fmt/format.h>
+#include <memory>
+#include <string>
+
+using namespace o2::framework;
+
+#define ASSERT_ERROR(condition)                                   \
+  if ((condition) == false) {                                     \
+    LOG(fatal) << R"(Test condition ")" #condition R"(" failed)"; \
+  }
+
+namespace
+{
+constexpr int NTimeslices = 10;
+constexpr int NParts = 4; // outputs of each kind per timeslice
+} // namespace
+
+WorkflowSpec defineDataProcessing(ConfigContext const&)
+{
+  Outputs outputs;
+  Inputs inputs;
+  for (int i = 0; i < NParts; i++) {
+    const auto subSpec = static_cast<o2::header::DataHeader::SubSpecificationType>(i);
+    outputs.emplace_back(OutputSpec{"TST", "STRING", subSpec});
+    outputs.emplace_back(OutputSpec{"TST", "TABLE", subSpec});
+    outputs.emplace_back(OutputSpec{"TST", "RAW", subSpec});
+    inputs.emplace_back(InputSpec{fmt::format("string{}", i), "TST", "STRING", subSpec});
+    inputs.emplace_back(InputSpec{fmt::format("table{}", i), "TST", "TABLE", subSpec});
+    inputs.emplace_back(InputSpec{fmt::format("raw{}", i), "TST", "RAW", subSpec});
+  }
+
+  DataProcessorSpec producer{
+    "producer",
+    Inputs{},
+    outputs,
+    AlgorithmSpec{[](ProcessingContext& pc) {
+      static int counter = 0;
+      if (counter == NTimeslices) {
+        return;
+      }
+      // interleave the outputs of the different contexts, the String and Arrow ones are
+      // coalesced when they are sent, after the processing
+      for (int i = 0; i < NParts; i++) {
+        const auto subSpec = static_cast<o2::header::DataHeader::SubSpecificationType>(i);
+        pc.outputs().make<std::string>(Output{"TST", "STRING", subSpec}, fmt::format("{}:{}", counter, i));
+        auto table = pc.outputs().make<TableBuilder>(Output{"TST", "TABLE", subSpec});
+        auto rowWriter = table->persist<int, int>({"counter", "part"});
+        for (int row = 0; row <= i; row++) {
+          rowWriter(0, counter, row);
+        }
+        pc.outputs().make<int>(Output{"TST", "RAW", subSpec}) = counter * NParts + i;
+      }
+      if (++counter == NTimeslices) {
+        pc.services().get<ControlService>().endOfStream();
+        pc.services().get<ControlService>().readyToQuit(QuitRequest::Me);
+      }
+    }}};
+
+  DataProcessorSpec consumer{
+    "consumer",
+    inputs,
+    Outputs{},
+    AlgorithmSpec{adaptStateful([](CallbackService& callbacks) {
+      auto nReceived = std::make_shared<int>(0);
+      callbacks.set<CallbackService::Id::EndOfStream>([nReceived](EndOfStreamContext&) {
+        ASSERT_ERROR(*nReceived == NTimeslices);
+        LOGP(info, "Received {} timeslices with {} String, Arrow and raw outputs each (coalesced outputs: {})", *nReceived, NParts, DefaultsHelpers::coalesceOutputs());
+      });
+      return adaptStateless([nReceived](InputRecord& inputs) {
+        // the timeslices may be processed in any order, all the inputs must belong to the same one
+        int counter = inputs.get<int>("raw0") / NParts;
+        for (int i = 0; i < NParts; i++) {
+          ASSERT_ERROR(inputs.get<int>(fmt::format("raw{}", i).c_str()) == counter * NParts + i);
+          ASSERT_ERROR(inputs.get<std::string>(fmt::format("string{}", i).c_str()) == fmt::format("{}:{}", counter, i));
+          auto table = inputs.get<TableConsumer>(fmt::format("table{}", i).c_str())->asArrowTable();
+          ASSERT_ERROR(table->num_rows() == i + 1);
+          ASSERT_ERROR(table->num_columns() == 2);
+          auto counters = std::static_pointer_cast<arrow::Int32Array>(table->column(0)->chunk(0));
+          auto parts = std::static_pointer_cast<arrow::Int32Array>(table->column(1)->chunk(0));
+          for (int row = 0; row <= i; row++) {
+            ASSERT_ERROR(counters->Value(row) == counter);
+            ASSERT_ERROR(parts->Value(row) == row);
+          }
+        }
+        ++(*nReceived);
+      });
+    })}};
+
+  return WorkflowSpec{producer, consumer};
+}
@@ -0,0 +1,111 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#include <catch_amalgamated.hpp>
+#include "Framework/OutputHeaderTemplate.h"
+#include "Headers/Stack.h"
+#include "MemoryResources/MemoryResources.h"
+
+#include <fairmq/TransportFactory.h>
+
+using namespace o2::framework;
+using DataHeader = o2::header::DataHeader;
+
+namespace
+{
+// The reference, as done in DataAllocator::headerMessageFromOutput
+o2::header::Stack referenceStack(Output const& spec, o2::header::SerializationMethod method, size_t payloadSize, TimingInfo const& timingInfo)
+{
+  DataHeader dh;
+  dh.dataOrigin = spec.origin;
+  dh.dataDescription = spec.description;
+  dh.subSpecification = spec.subSpec;
+  dh.payloadSize = payloadSize;
+  dh.payloadSerializationMethod = method;
+  dh.tfCounter = timingInfo.tfCounter;
+  dh.firstTForbit = timingInfo.firstTForbit;
+  dh.runNumber = timingInfo.runNumber;
+
+  DataProcessingHeader dph{timingInfo.timeslice, 1, timingInfo.creation};
+  static_cast<o2::header::BaseHeader&>(dph).flagsDerivedHeader |= timingInfo.keepAtEndOfStream ? DataProcessingHeader::KEEP_AT_EOS_FLAG : 0;
+  return o2::header::Stack{dh, dph};
+}
+
+void checkSameHeaders(std::byte const* expected, std::byte const* actual)
+{
+  REQUIRE(o2::header::Stack::headerStackSize(actual) == o2::header::Stack::headerStackSize(expected));
+  REQUIRE(o2::header::Stack::headerStackSize(actual) == OutputHeaderTemplate::size());
+
+  auto* dh = o2::header::get<DataHeader*>(actual);
+  auto* refDh = o2::header::get<DataHeader*>(expected);
+  REQUIRE(dh != nullptr);
+  REQUIRE(refDh != nullptr);
+  REQUIRE(*dh == *refDh);
+  REQUIRE(dh->flags == refDh->flags);
+  REQUIRE(dh->splitPayloadParts == refDh->splitPayloadParts);
+  REQUIRE(dh->splitPayloadIndex == refDh->splitPayloadIndex);
+  REQUIRE(dh->payloadSize == refDh->payloadSize);
+  REQUIRE(dh->tfCounter == refDh->tfCounter);
+  REQUIRE(dh->firstTForbit == refDh->firstTForbit);
+  REQUIRE(dh->runNumber == refDh->runNumber);
+
+  auto* dph = o2::header::get<DataProcessingHeader*>(actual);
+  auto* refDph = o2::header::get<DataProcessingHeader*>(expected);
+  REQUIRE(dph != nullptr);
+  REQUIRE(refDph != nullptr);
+  REQUIRE(dph->flags == refDph->flags);
+  REQUIRE(dph->headerVersion == refDph->headerVersion);
+  REQUIRE(dph->startTime == refDph->startTime);
+  REQUIRE(dph->duration == refDph->duration);
+  REQUIRE(dph->creation == refDph->creation);
+}
+} // namespace
+
+TEST_CASE("OutputHeaderTemplateMatchesStack")
+{
+  OutputHeaderTemplate headerTemplate;
+  TimingInfo timingInfo;
+  timingInfo.timeslice = 42;
+  timingInfo.tfCounter = 7;
+  timingInfo.firstTForbit = 256 * 32;
+  timingInfo.runNumber = 523897;
+  timingInfo.creation = 1700000000000;
+
+  for (bool keepAtEOS : {false, true}) {
+    timingInfo.keepAtEndOfStream = keepAtEOS;
+    for (auto method : {o2::header::gSerializationMethodNone, o2::header::gSerializationMethodROOT, o2::header::gSerializationMethodArrow}) {
+      Output spec{"TST", "RAWDATA", 0xdeadbeef};
+      auto reference = referenceStack(spec, method, 1234, timingInfo);
+      alignas(64) std::byte buffer[OutputHeaderTemplate::size()];
+      headerTemplate.writeTo(buffer, spec, method, 1234, timingInfo);
+      checkSameHeaders(reference.data(), buffer);
+    }
+  }
+}
+
+TEST_CASE("OutputHeaderTemplateIsReusable")
+{
+  OutputHeaderTemplate headerTemplate;
+  auto transport = fair::mq::TransportFactory::CreateTransportFactory("zeromq");
+  TimingInfo timingInfo;
+  // Each message gets its own copy of the template, patching a header
+  // must not leak into the next one.
+  for (size_t i = 0; i < 10; ++i) {
+    timingInfo.timeslice = i;
+    timingInfo.tfCounter = i + 1;
+    timingInfo.keepAtEndOfStream = i % 2;
+    Output spec{"TST", "A", static_cast<o2::header::DataHeader::SubSpecificationType>(i)};
+    auto message = headerTemplate.createMessage(*transport, spec, o2::header::gSerializationMethodNone, i * 8, timingInfo);
+    REQUIRE(message->GetSize() == OutputHeaderTemplate::size());
+    auto reference = referenceStack(spec, o2::header::gSerializationMethodNone, i * 8, timingInfo);
+    checkSameHeaders(reference.data(), static_cast<std::byte const*>(message->GetData()));
+  }
+}
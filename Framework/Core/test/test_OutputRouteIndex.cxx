@@ -0,0 +1,80 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#include <catch_amalgamated.hpp>
+#include "Framework/OutputRouteIndex.h"
+#include "Framework/DataSpecUtils.h"
+#include <array>
+
+using namespace o2::framework;
+
+namespace
+{
+// The reference implementation, as done in DataAllocator before.
+int linearLookup(std::vector<OutputRoute> const& routes, ConcreteDataMatcher const& matcher, size_t timeslice)
+{
+  for (int ri = 0; ri < (int)routes.size(); ++ri) {
+    auto& route = routes[ri];
+    if (DataSpecUtils::match(route.matcher, matcher.origin, matcher.description, matcher.subSpec) && ((timeslice % route.maxTimeslices) == route.timeslice)) {
+      return ri;
+    }
+  }
+  return -1;
+}
+} // namespace
+
+TEST_CASE("OutputRouteIndexConcrete")
+{
+  std::vector<OutputRoute> routes{
+    {0, 2, OutputSpec{"TPC", "CLUSTERS", 0}, "to_a_0", nullptr},
+    {1, 2, OutputSpec{"TPC", "CLUSTERS", 0}, "to_a_1", nullptr},
+    {0, 1, OutputSpec{"TPC", "CLUSTERS", 1}, "to_b", nullptr},
+    {0, 1, OutputSpec{"ITS", "COMPCLUSTERS", 0}, "to_c", nullptr},
+  };
+  OutputRouteIndex index;
+  REQUIRE(index.isBuilt() == false);
+  index.build(routes);
+  REQUIRE(index.isBuilt() == true);
+
+  CHECK(index.lookup({"TPC", "CLUSTERS", 0}, 0).value == 0);
+  CHECK(index.lookup({"TPC", "CLUSTERS", 0}, 1).value == 1);
+  CHECK(index.lookup({"TPC", "CLUSTERS", 0}, 4).value == 0);
+  CHECK(index.lookup({"TPC", "CLUSTERS", 1}, 3).value == 2);
+  CHECK(index.lookup({"ITS", "COMPCLUSTERS", 0}, 7).value == 3);
+  CHECK(index.lookup({"ITS", "COMPCLUSTERS", 1}, 0).value == -1);
+  CHECK(index.lookup({"MFT", "COMPCLUSTERS", 0}, 0).value == -1);
+}
+
+TEST_CASE("OutputRouteIndexWildcard")
+{
+  std::vector<OutputRoute> routes{
+    {0, 1, OutputSpec{"TPC", "RAWDATA"}, "wildcard_first", nullptr},
+    {0, 1, OutputSpec{"TPC", "RAWDATA", 3}, "concrete", nullptr},
+    {0, 1, OutputSpec{"TPC", "DIGITS", 3}, "concrete_first", nullptr},
+    {0, 1, OutputSpec{"TPC", "DIGITS"}, "wildcard", nullptr},
+  };
+  OutputRouteIndex index;
+  index.build(routes);
+
+  std::array<o2::header::DataDescription, 3> descriptions{"RAWDATA", "DIGITS", "CLUSTERS"};
+  for (uint32_t subSpec = 0; subSpec < 8; ++subSpec) {
+    for (auto& description : descriptions) {
+      ConcreteDataMatcher matcher{"TPC", description, subSpec};
+      // ask twice to exercise the memoised wildcard lookup
+      for (int i = 0; i < 2; ++i) {
+        CHECK(index.lookup(matcher, 0).value == linearLookup(routes, matcher, 0));
+      }
+    }
+  }
+  CHECK(index.lookup({"TPC", "RAWDATA", 3}, 0).value == 0);
+  CHECK(index.lookup({"TPC", "DIGITS", 3}, 0).value == 2);
+  CHECK(index.lookup({"TPC", "DIGITS", 5}, 0).value == 3);
+}
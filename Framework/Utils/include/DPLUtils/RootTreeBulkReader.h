@@ -0,0 +1,250 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+#ifndef FRAMEWORK_ROOTTREEBULKREADER_H
+#define FRAMEWORK_ROOTTREEBULKREADER_H
+
+/// @file   RootTreeBulkReader.h
+/// @brief  Reader of selected ROOT tree branches with a TTreeCache set up for them
+
+#include "Framework/Output.h"
+#include "Framework/ProcessingContext.h"
+#include "Framework/DataAllocator.h"
+#include "Framework/TypeTraits.h"
+#include "Framework/Traits.h"
+#include <TTree.h>
+#include <TBranch.h>
+#include <TClass.h>
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace o2::framework
+{
+
+/// @class RootTreeBulkReader
+/// @brief Reads registered branches of a TTree entry by entry, for reader devices publishing one entry per TF
+///
+/// All registered branches (with their sub-branches) are added to the TTreeCache of the tree and the
+/// cache learning phase is stopped on the first read, so that the baskets of an entry are fetched
+/// in a single vectored read. The files of intermediate reconstruction output contain one entry per TF,
+/// hence the default auto-cache, which learns the branches during the first 100 entries, never leaves its
+/// learning phase for them. Only the registered branches are read, other branches of the tree are ignored.
+///
+/// The tree can be a TChain, the branches and their cache entries are then looked up again in the
+/// tree of every new file of the chain.
+///
+/// The branches are streamed into objects owned by the reader, which keep their capacity from entry
+/// to entry. Vectors of messageable types are published by a single copy into uninitialized
+/// output message memory, other types are snapshot.
+///
+/// \par Usage:
+///
+///     RootTreeBulkReader reader(tree);
+///     reader.addBranch<std::vector<o2::its::TrackITS>>("ITSTrack");
+///     bool withMC = reader.addBranch<std::vector<o2::MCCompLabel>>("ITSTrackMCTruth", true); // optional branch
+///     // in the processing callback
+///     if (reader.next()) {
+///       reader.publish<std::vector<o2::its::TrackITS>>(pc, Output{"ITS", "TRACKS", 0}, "ITSTrack");
+///     }
+class RootTreeBulkReader
+{
+ public:
+  /// default size of the TTreeCache in bytes
+  static constexpr Long64_t DefaultCacheSize = 100 * 1024 * 1024;
+
+  RootTreeBulkReader(TTree* tree, Long64_t cacheSize = DefaultCacheSize) : mTree(tree)
+  {
+    if (!mTree) {
+      throw std::runtime_error("no input tree provided");
+    }
+    mTree->SetCacheSize(cacheSize);
+  }
+
+  /// register the branch to read, the type T must match the stored data type
+  /// @return false if an optional branch is missing in the tree
+  template <typename T>
+  bool addBranch(const std::string& name, bool optional = false)
+  {
+    auto* branch = mTree->GetBranch(name.c_str());
+    if (!branch) {
+      if (optional) {
+        return false;
+      }
+      throw std::runtime_error(std::string("can not find branch ") + name);
+    }
+    auto* storedclass = TClass::GetClass(branch->GetClassName());
+    auto* configuredclass = TClass::GetClass(typeid(T));
+    if (storedclass == nullptr || storedclass != configuredclass) {
+      throw std::runtime_error(std::string("Configured type ") +
+                               (configuredclass != nullptr ? configuredclass->GetName() : typeid(T).name()) +
+                               " does not match the stored data type " +
+                               (storedclass != nullptr ? storedclass->GetName() : "") +
+                               " in branch " + name);
+    }
+    auto holder = std::make_unique<BranchHolder<T>>();
+    holder->name = name;
+    holder->branch = branch;
+    mTree->SetBranchAddress(name.c_str(), &holder->objectPtr);
+    mTree->AddBranchToCache(name.c_str(), true);
+    mBranches.emplace_back(std::move(holder));
+    mCacheLearning = true;
+    mTreeNumber = mTree->GetTreeNumber();
+    return true;
+  }
+
+  /// check if the branch was registered
+  bool hasBranch(const std::string& name) const
+  {
+    return std::find_if(mBranches.begin(), mBranches.end(), [&name](const auto& b) { return b->name == name; }) != mBranches.end();
+  }
+
+  /// read given (global, for a chain) entry of all registered branches
+  /// @return false if the entry is not in the tree
+  bool readEntry(Long64_t entry)
+  {
+    if (entry < 0 || entry >= mTree->GetEntries()) {
+      return false;
+    }
+    auto localEntry = mTree->LoadTree(entry);
+    if (localEntry < 0) {
+      return false;
+    }
+    if (mTree->GetTreeNumber() != mTreeNumber) {
+      updateBranches();
+    }
+    if (mCacheLearning) {
+      mTree->StopCacheLearningPhase();
+      mCacheLearning = false;
+    }
+    for (auto& b : mBranches) {
+      auto nb = b->branch->GetEntry(localEntry);
+      if (nb < 0) {
+        throw std::runtime_error(std::string("failed to read entry ") + std::to_string(entry) + " of branch " + b->name);
+      }
+      mBytesRead += nb;
+    }
+    mReadEntry = entry;
+    return true;
+  }
+
+  /// read the entry following the last read one
+  bool next()
+  {
+    return readEntry(mReadEntry + 1);
+  }
+
+  /// object read from the branch at the last read entry
+  template <typename T>
+  const T& get(const std::string& name) const
+  {
+    return *getHolder<T>(name).objectPtr;
+  }
+
+  /// copy the content of vector branch to a (e.g. pmr) container
+  template <typename T, typename Container>
+  void fill(const std::string& name, Container& dest) const
+  {
+    const auto& src = get<T>(name);
+    dest.assign(src.begin(), src.end());
+  }
+
+  /// publish the object read from the branch at the last read entry
+  template <typename T>
+  void publish(ProcessingContext& pc, const Output& output, const std::string& name) const
+  {
+    const auto& src = get<T>(name);
+    if constexpr (isMessageableVector<T>()) {
+      auto& dest = pc.outputs().make<DataAllocator::UninitializedVector<typename T::value_type>>(output, src.size());
+      std::copy(src.begin(), src.end(), dest.begin());
+    } else {
+      pc.outputs().snapshot(output, src);
+    }
+  }
+
+  /// publish empty container to the output, e.g. when the optional branch is missing
+  template <typename T>
+  static void publishEmpty(ProcessingContext& pc, const Output& output)
+  {
+    pc.outputs().snapshot(output, T{});
+  }
+
+  Long64_t getReadEntry() const { return mReadEntry; }
+  Long64_t getNEntries() const { return mTree->GetEntries(); }
+  bool isLastEntry() const { return mReadEntry + 1 >= mTree->GetEntries(); }
+
+  /// total number of uncompressed bytes read from the registered branches
+  size_t getBytesRead() const { return mBytesRead; }
+
+  TTree* getTree() const { return mTree; }
+
+ private:
+  template <typename T>
+  static constexpr bool isMessageableVector()
+  {
+    if constexpr (is_specialization_v<T, std::vector>) {
+      return is_messageable<typename T::value_type>::value;
+    }
+    return false;
+  }
+
+  struct BranchHolderBase {
+    virtual ~BranchHolderBase() = default;
+    std::string name;
+    TBranch* branch = nullptr;
+  };
+
+  template <typename T>
+  struct BranchHolder : public BranchHolderBase {
+    T object;
+    T* objectPtr = &object;
+  };
+
+  /// the chain switched to a new tree: the branches (and their cache) of the previous one are gone
+  void updateBranches()
+  {
+    auto* tree = mTree->GetTree();
+    for (auto& b : mBranches) {
+      b->branch = tree->GetBranch(b->name.c_str());
+      if (!b->branch) {
+        throw std::runtime_error(std::string("can not find branch ") + b->name + " in tree " + std::to_string(mTree->GetTreeNumber()) + " of the chain");
+      }
+      mTree->AddBranchToCache(b->name.c_str(), true);
+    }
+    mCacheLearning = true;
+    mTreeNumber = mTree->GetTreeNumber();
+  }
+
+  template <typename T>
+  const BranchHolder<T>& getHolder(const std::string& name) const
+  {
+    auto it = std::find_if(mBranches.begin(), mBranches.end(), [&name](const auto& b) { return b->name == name; });
+    if (it == mBranches.end()) {
+      throw std::runtime_error(std::string("branch ") + name + " was not registered");
+    }
+    auto* holder = dynamic_cast<const BranchHolder<T>*>(it->get());
+    if (!holder) {
+      throw std::runtime_error(std::string("requested type does not match the type registered for branch ") + name);
+    }
+    return *holder;
+  }
+
+  TTree* mTree = nullptr;
+  std::vector<std::unique_ptr<BranchHolderBase>> mBranches;
+  Long64_t mReadEntry = -1;
+  Int_t mTreeNumber = -1; // number of the tree in the chain the branch pointers belong to
+  size_t mBytesRead = 0;
+  bool mCacheLearning = false;
+};
+
+} // namespace o2::framework
+#endif
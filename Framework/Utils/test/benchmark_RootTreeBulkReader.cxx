@@ -0,0 +1,179 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+#include <benchmark/benchmark.h>
+
+#include "DPLUtils/RootTreeBulkReader.h"
+#include "DataFormatsITS/TrackITS.h"
+#include "DataFormatsITSMFT/CompCluster.h"
+#include "DataFormatsITSMFT/ROFRecord.h"
+#include "MemoryResources/MemoryResources.h"
+#include <TFile.h>
+#include <TTree.h>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace o2::framework;
+
+// per TF sizes of the order of a Pb-Pb TF
+constexpr int NEntries = 4;
+constexpr int NROFs = 576;
+constexpr int NTracksPerTF = 100000;
+constexpr int NClustersPerTF = 2000000;
+
+const std::string TrackFileName = "benchmark_RootTreeBulkReader_tracks.root";
+const std::string ClusterFileName = "benchmark_RootTreeBulkReader_clusters.root";
+
+// write the tree with one entry per TF, as the track and cluster writers do
+class TestFiles
+{
+ public:
+  TestFiles()
+  {
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<float> uniform(-1.f, 1.f);
+    {
+      TFile file(TrackFileName.c_str(), "recreate");
+      TTree tree("o2sim", "o2sim");
+      std::vector<o2::its::TrackITS> tracks, *tracksPtr = &tracks;
+      std::vector<int> clusIdx, *clusIdxPtr = &clusIdx;
+      std::vector<o2::itsmft::ROFRecord> rofs(NROFs), *rofsPtr = &rofs;
+      tree.Branch("ITSTrack", &tracksPtr);
+      tree.Branch("ITSTrackClusIdx", &clusIdxPtr);
+      tree.Branch("ITSTracksROF", &rofsPtr);
+      for (int ient = 0; ient < NEntries; ient++) {
+        tracks.clear();
+        clusIdx.clear();
+        for (int i = 0; i < NTracksPerTF; i++) {
+          auto& trc = tracks.emplace_back(o2::track::TrackParCov(19.f, uniform(generator) * 3.14f, {uniform(generator) * 19.f, uniform(generator) * 20.f, uniform(generator) * 0.5f, uniform(generator), uniform(generator) * 5.f}, {}));
+          trc.setChi2(10.f + uniform(generator));
+          trc.setFirstClusterEntry(clusIdx.size());
+          for (int icl = 0; icl < 7; icl++) {
+            clusIdx.push_back(int(generator() % NClustersPerTF));
+          }
+        }
+        tree.Fill();
+      }
+      tree.Write();
+    }
+    {
+      TFile file(ClusterFileName.c_str(), "recreate");
+      TTree tree("o2sim", "o2sim");
+      std::vector<o2::itsmft::CompClusterExt> clusters, *clustersPtr = &clusters;
+      std::vector<unsigned char> patterns, *patternsPtr = &patterns;
+      std::vector<o2::itsmft::ROFRecord> rofs(NROFs), *rofsPtr = &rofs;
+      tree.Branch("ITSClusterComp", &clustersPtr);
+      tree.Branch("ITSClusterPatt", &patternsPtr);
+      tree.Branch("ITSClustersROF", &rofsPtr);
+      for (int ient = 0; ient < NEntries; ient++) {
+        clusters.clear();
+        patterns.clear();
+        for (int i = 0; i < NClustersPerTF; i++) {
+          clusters.emplace_back(generator() % 1024, generator() % 512, generator() % 4096, generator() % 24120);
+          if (i % 10 == 0) {
+            patterns.push_back(generator() % 256);
+          }
+        }
+        tree.Fill();
+      }
+      tree.Write();
+    }
+  }
+
+  ~TestFiles()
+  {
+    std::remove(TrackFileName.c_str());
+    std::remove(ClusterFileName.c_str());
+  }
+};
+
+TestFiles gFiles;
+
+// read all entries through the object streamers with TTree::GetEntry, as the reader devices did
+template <typename T0, typename T1, typename T2>
+static void readEntryByEntry(benchmark::State& state, const std::string& fileName, const std::string& br0, const std::string& br1, const std::string& br2)
+{
+  size_t nBytes = 0;
+  for (auto _ : state) {
+    std::unique_ptr<TFile> file(TFile::Open(fileName.c_str()));
+    auto* tree = (TTree*)file->Get("o2sim");
+    std::vector<T0> v0, *v0Ptr = &v0;
+    std::vector<T1> v1, *v1Ptr = &v1;
+    std::vector<T2> v2, *v2Ptr = &v2;
+    tree->SetBranchAddress(br0.c_str(), &v0Ptr);
+    tree->SetBranchAddress(br1.c_str(), &v1Ptr);
+    tree->SetBranchAddress(br2.c_str(), &v2Ptr);
+    for (int ient = 0; ient < tree->GetEntries(); ient++) {
+      tree->GetEntry(ient);
+      // copy to the output message
+      o2::pmr::vector<T0> out0(v0.begin(), v0.end());
+      o2::pmr::vector<T1> out1(v1.begin(), v1.end());
+      o2::pmr::vector<T2> out2(v2.begin(), v2.end());
+      nBytes += out0.size() * sizeof(T0) + out1.size() * sizeof(T1) + out2.size() * sizeof(T2);
+      benchmark::DoNotOptimize(out0.data());
+    }
+  }
+  state.SetBytesProcessed(nBytes);
+}
+
+// read all entries with the RootTreeBulkReader
+template <typename T0, typename T1, typename T2>
+static void readBulk(benchmark::State& state, const std::string& fileName, const std::string& br0, const std::string& br1, const std::string& br2)
+{
+  size_t nBytes = 0;
+  for (auto _ : state) {
+    std::unique_ptr<TFile> file(TFile::Open(fileName.c_str()));
+    RootTreeBulkReader reader((TTree*)file->Get("o2sim"));
+    reader.addBranch<std::vector<T0>>(br0);
+    reader.addBranch<std::vector<T1>>(br1);
+    reader.addBranch<std::vector<T2>>(br2);
+    while (reader.next()) {
+      o2::pmr::vector<T0> out0;
+      o2::pmr::vector<T1> out1;
+      o2::pmr::vector<T2> out2;
+      reader.fill<std::vector<T0>>(br0, out0);
+      reader.fill<std::vector<T1>>(br1, out1);
+      reader.fill<std::vector<T2>>(br2, out2);
+      nBytes += out0.size() * sizeof(T0) + out1.size() * sizeof(T1) + out2.size() * sizeof(T2);
+      benchmark::DoNotOptimize(out0.data());
+    }
+  }
+  state.SetBytesProcessed(nBytes);
+}
+
+static void BM_TrackTreeEntryByEntry(benchmark::State& state)
+{
+  readEntryByEntry<o2::its::TrackITS, int, o2::itsmft::ROFRecord>(state, TrackFileName, "ITSTrack", "ITSTrackClusIdx", "ITSTracksROF");
+}
+
+static void BM_TrackTreeBulk(benchmark::State& state)
+{
+  readBulk<o2::its::TrackITS, int, o2::itsmft::ROFRecord>(state, TrackFileName, "ITSTrack", "ITSTrackClusIdx", "ITSTracksROF");
+}
+
+static void BM_ClusterTreeEntryByEntry(benchmark::State& state)
+{
+  readEntryByEntry<o2::itsmft::CompClusterExt, unsigned char, o2::itsmft::ROFRecord>(state, ClusterFileName, "ITSClusterComp", "ITSClusterPatt", "ITSClustersROF");
+}
+
+static void BM_ClusterTreeBulk(benchmark::State& state)
+{
+  readBulk<o2::itsmft::CompClusterExt, unsigned char, o2::itsmft::ROFRecord>(state, ClusterFileName, "ITSClusterComp", "ITSClusterPatt", "ITSClustersROF");
+}
+
+BENCHMARK(BM_TrackTreeEntryByEntry)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TrackTreeBulk)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ClusterTreeEntryByEntry)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ClusterTreeBulk)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
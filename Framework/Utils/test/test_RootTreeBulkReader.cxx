@@ -0,0 +1,152 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#include <catch_amalgamated.hpp>
+#include "DPLUtils/RootTreeBulkReader.h"
+#include "MemoryResources/MemoryResources.h"
+#include <TChain.h>
+#include <TFile.h>
+#include <TTree.h>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace o2::framework;
+
+namespace
+{
+const char* TreeName = "o2sim";
+
+/// write a tree with entries of varying size, the content depends on the file index
+void writeTestFile(const std::string& filename, int fileIndex, int nEntries)
+{
+  TFile file(filename.c_str(), "recreate");
+  TTree tree(TreeName, TreeName);
+  std::vector<int> ints, *intsPtr = &ints;
+  std::vector<double> doubles, *doublesPtr = &doubles;
+  int counter = 0;
+  tree.Branch("ints", &intsPtr);
+  tree.Branch("doubles", &doublesPtr);
+  tree.Branch("counter", &counter);
+  for (int ient = 0; ient < nEntries; ient++) {
+    ints.clear();
+    doubles.clear();
+    for (int i = 0; i < 10 * (ient + 1) + fileIndex; i++) {
+      ints.push_back(1000 * fileIndex + 100 * ient + i);
+      doubles.push_back(0.5 * ints.back());
+    }
+    counter = 100 * fileIndex + ient;
+    tree.Fill();
+  }
+  tree.Write();
+}
+
+struct Entry {
+  std::vector<int> ints;
+  std::vector<double> doubles;
+};
+
+/// reference content of all entries of the files, read by TTree::GetEntry
+std::vector<Entry> readReference(const std::vector<std::string>& filenames)
+{
+  std::vector<Entry> entries;
+  for (const auto& filename : filenames) {
+    std::unique_ptr<TFile> file(TFile::Open(filename.c_str()));
+    REQUIRE(file != nullptr);
+    auto* tree = (TTree*)file->Get(TreeName);
+    REQUIRE(tree != nullptr);
+    std::vector<int>* ints = nullptr;
+    std::vector<double>* doubles = nullptr;
+    tree->SetBranchAddress("ints", &ints);
+    tree->SetBranchAddress("doubles", &doubles);
+    for (Long64_t ient = 0; ient < tree->GetEntries(); ient++) {
+      tree->GetEntry(ient);
+      entries.push_back({*ints, *doubles});
+    }
+    tree->ResetBranchAddresses();
+    delete ints;
+    delete doubles;
+  }
+  return entries;
+}
+
+void checkReader(RootTreeBulkReader& reader, const std::vector<Entry>& reference)
+{
+  REQUIRE(reader.addBranch<std::vector<int>>("ints"));
+  REQUIRE(reader.addBranch<std::vector<double>>("doubles"));
+  REQUIRE(reader.addBranch<std::vector<float>>("floats", true) == false);
+  REQUIRE(reader.hasBranch("ints"));
+  REQUIRE(reader.hasBranch("floats") == false);
+  REQUIRE(reader.getNEntries() == Long64_t(reference.size()));
+  size_t nRead = 0;
+  while (reader.next()) {
+    REQUIRE(nRead < reference.size());
+    const auto& ref = reference[nRead];
+    INFO("entry " << nRead);
+    CHECK(reader.get<std::vector<int>>("ints") == ref.ints);
+    o2::pmr::vector<double> doubles;
+    reader.fill<std::vector<double>>("doubles", doubles);
+    CHECK(std::vector<double>(doubles.begin(), doubles.end()) == ref.doubles);
+    CHECK(reader.getReadEntry() == Long64_t(nRead));
+    CHECK(reader.isLastEntry() == (nRead + 1 == reference.size()));
+    nRead++;
+  }
+  CHECK(nRead == reference.size());
+  CHECK_THROWS(reader.get<std::vector<float>>("ints"));
+  CHECK_THROWS(reader.get<std::vector<int>>("counter"));
+
+  // random access, going back across the file boundaries of a chain
+  for (Long64_t ient = reference.size() - 1; ient >= 0; ient -= 2) {
+    REQUIRE(reader.readEntry(ient));
+    INFO("entry " << ient);
+    CHECK(reader.get<std::vector<int>>("ints") == reference[ient].ints);
+    CHECK(reader.get<std::vector<double>>("doubles") == reference[ient].doubles);
+  }
+  CHECK(reader.readEntry(reference.size()) == false);
+  CHECK(reader.readEntry(-1) == false);
+}
+} // namespace
+
+TEST_CASE("test_RootTreeBulkReader")
+{
+  const std::string filename = "test_RootTreeBulkReader.root";
+  writeTestFile(filename, 0, 5);
+  auto reference = readReference({filename});
+  {
+    std::unique_ptr<TFile> file(TFile::Open(filename.c_str()));
+    RootTreeBulkReader reader((TTree*)file->Get(TreeName));
+    checkReader(reader, reference);
+    CHECK_THROWS(reader.addBranch<std::vector<float>>("ints"));
+    CHECK_THROWS(reader.addBranch<std::vector<int>>("missing"));
+  }
+  std::remove(filename.c_str());
+}
+
+TEST_CASE("test_RootTreeBulkReader_chain")
+{
+  const std::vector<std::string> filenames{"test_RootTreeBulkReader_0.root", "test_RootTreeBulkReader_1.root", "test_RootTreeBulkReader_2.root"};
+  for (size_t i = 0; i < filenames.size(); i++) {
+    writeTestFile(filenames[i], i + 1, 3 + i);
+  }
+  auto reference = readReference(filenames);
+  {
+    TChain chain(TreeName);
+    for (const auto& filename : filenames) {
+      chain.AddFile(filename.c_str());
+    }
+    RootTreeBulkReader reader(&chain);
+    checkReader(reader, reference);
+  }
+  for (const auto& filename : filenames) {
+    std::remove(filename.c_str());
+  }
+}
@@ -25,6 +25,7 @@
 #if !defined(__ROOTCLING__) && !defined(GPUCA_GPUCODE) && !defined(GPUCA_NO_VC)
 #include <Vc/Vc>
 #include <Vc/SimdArray>
+#include <type_traits>
 #endif
 
 class TFile;
@@ -360,6 +361,68 @@ class Spline2DSpec<DataT, YdimT, 0>
     }
   }
 
+#if !defined(GPUCA_GPUCODE)
+  /// Get interpolated values for n points {u1[i], u2[i]} using spline parameters Parameters, S[i * inpYdim + dim] is set for the point i.
+  /// The knots and the weights are obtained point by point, while the sums over the gathered parameters are done with SIMD
+  /// vectors for Vc::float_v::size() points at once. The arithmetics is the same as in interpolateU, the results agree
+  /// up to the rounding when the compiler fuses the multiplications and additions of interpolateU.
+  template <SafetyLevel SafeT = SafetyLevel::kSafe>
+  void interpolateUbatch(int32_t inpYdim, const DataT Parameters[], const DataT u1[], const DataT u2[], DataT S[], int32_t n) const
+  {
+    const auto nYdimTmp = SplineUtil::getNdim<YdimT>(inpYdim);
+    const int32_t nYdim = nYdimTmp.get();
+
+#if !defined(__ROOTCLING__) && !defined(GPUCA_NO_VC)
+    if constexpr (std::is_same<DataT, float>::value) {
+      typedef Vc::float_v V;
+      constexpr int32_t nLanes = V::size();
+      const int32_t nYdim4 = nYdim * 4;
+      const int32_t nu = mGridX1.getNumberOfKnots();
+      for (int32_t i0 = 0; i0 < n; i0 += nLanes) {
+        V a[8], b[8];
+        V::IndexType indA, indB;
+        for (int32_t lane = 0; lane < nLanes; lane++) {
+          const int32_t ip = (i0 + lane < n) ? i0 + lane : n - 1; // lanes beyond n repeat the last point
+          const DataT& u = u1[ip];
+          const DataT& v = u2[ip];
+          int32_t iu = mGridX1.template getLeftKnotIndexForU<SafeT>(u);
+          int32_t iv = mGridX2.template getLeftKnotIndexForU<SafeT>(v);
+          DataT dSl, dDl, dSr, dDr;
+          mGridX1.getUderivatives(mGridX1.template getKnot<SafetyLevel::kNotSafe>(iu), u, dSl, dDl, dSr, dDr);
+          DataT dSd, dDd, dSu, dDu;
+          mGridX2.getUderivatives(mGridX2.template getKnot<SafetyLevel::kNotSafe>(iv), v, dSd, dDd, dSu, dDu);
+          const DataT wa[8] = {dSl * dSd, dSl * dDd, dDl * dSd, dDl * dDd,
+                               dSr * dSd, dSr * dDd, dDr * dSd, dDr * dDd};
+          const DataT wb[8] = {dSl * dSu, dSl * dDu, dDl * dSu, dDl * dDu,
+                               dSr * dSu, dSr * dDu, dDr * dSu, dDr * dDu};
+          for (int32_t i = 0; i < 8; i++) {
+            a[i][lane] = wa[i];
+            b[i][lane] = wb[i];
+          }
+          indA[lane] = (nu * iv + iu) * nYdim4;
+          indB[lane] = indA[lane] + nYdim4 * nu;
+        }
+        for (int32_t dim = 0; dim < nYdim; dim++) {
+          V sum = V::Zero();
+          for (int32_t i = 0; i < 8; i++) {
+            const V parA(Parameters + nYdim * i + dim, indA);
+            const V parB(Parameters + nYdim * i + dim, indB);
+            sum += a[i] * parA + b[i] * parB;
+          }
+          for (int32_t lane = 0; lane < nLanes && i0 + lane < n; lane++) {
+            S[(i0 + lane) * nYdim + dim] = sum[lane];
+          }
+        }
+      }
+      return;
+    }
+#endif
+    for (int32_t ip = 0; ip < n; ip++) {
+      interpolateU<SafeT>(nYdim, Parameters, u1[ip], u2[ip], S + ip * nYdim);
+    }
+  }
+#endif
+
  protected:
   using TBase::mGridX1;
   using TBase::mGridX2;
@@ -444,12 +507,22 @@ class Spline2DSpec<DataT, YdimT, 1>
     TBase::template interpolateUold<SafeT>(YdimT, Parameters, u1, u2, S);
   }
 
+#if !defined(GPUCA_GPUCODE)
+  /// Get interpolated values of an YdimT-dimensional S(u1,u2) for n points, see Spline2DSpec<DataT, YdimT, 0>::interpolateUbatch
+  template <SafetyLevel SafeT = SafetyLevel::kSafe>
+  void interpolateUbatch(const DataT Parameters[], const DataT u1[], const DataT u2[], DataT S[], int32_t n) const
+  {
+    TBase::template interpolateUbatch<SafeT>(YdimT, Parameters, u1, u2, S, n);
+  }
+#endif
+
   using TBase::getNumberOfKnots;
 
   /// _______________  Suppress some parent class methods   ________________________
  private:
 #if !defined(GPUCA_GPUCODE)
   using TBase::recreate;
+  using TBase::interpolateUbatch;
 #endif
   using TBase::interpolateU;
 };
@@ -508,6 +581,9 @@ class Spline2DSpec<DataT, YdimT, 2>
   ///  _______  Expert tools: interpolation with given nYdim and external Parameters _______
 
   using TBase::interpolateU;
+#if !defined(GPUCA_GPUCODE)
+  using TBase::interpolateUbatch;
+#endif
 };
 
 /// ==================================================================================================
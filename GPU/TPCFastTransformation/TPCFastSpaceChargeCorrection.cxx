@@ -538,3 +538,71 @@ double TPCFastSpaceChargeCorrection::testInverse(bool prn)
 }
 
 #endif // GPUCA_GPUCODE
+
+#if !defined(GPUCA_GPUCODE)
+
+namespace
+{
+constexpr int32_t BatchSize = 256; // clusters converted to the grid coordinates and interpolated at once
+}
+
+void TPCFastSpaceChargeCorrection::getCorrectionBatch(int32_t slice, int32_t row, const float* u, const float* v, float* dx, float* du, float* dv, int32_t n) const
+{
+  const SplineType& spline = getSpline(slice, row);
+  const float* splineData = getSplineData(slice, row);
+  float gridU[BatchSize], gridV[BatchSize], dxuv[3 * BatchSize];
+  for (int32_t i0 = 0; i0 < n; i0 += BatchSize) {
+    const int32_t nb = CAMath::Min(BatchSize, n - i0);
+    for (int32_t i = 0; i < nb; i++) {
+      convUVtoGrid(slice, row, u[i0 + i], v[i0 + i], gridU[i], gridV[i]);
+    }
+    spline.interpolateUbatch(splineData, gridU, gridV, dxuv, nb);
+    for (int32_t i = 0; i < nb; i++) {
+      const float* d = dxuv + 3 * i;
+      bool ok = !(CAMath::Abs(d[0]) > 100 || CAMath::Abs(d[1]) > 100 || CAMath::Abs(d[2]) > 100);
+      dx[i0 + i] = ok ? d[0] : 0.f;
+      du[i0 + i] = ok ? d[1] : 0.f;
+      dv[i0 + i] = ok ? d[2] : 0.f;
+    }
+  }
+}
+
+void TPCFastSpaceChargeCorrection::getCorrectionInvCorrectedXBatch(int32_t slice, int32_t row, const float* corrU, const float* corrV, float* corrX, int32_t n) const
+{
+  const Spline2D<float, 1>& spline = reinterpret_cast<const Spline2D<float, 1>&>(getSpline(slice, row));
+  const float* splineData = getSplineData(slice, row, 1);
+  const float rowX = mGeo.getRowInfo(row).x;
+  float gridU[BatchSize], gridV[BatchSize], dx[BatchSize];
+  for (int32_t i0 = 0; i0 < n; i0 += BatchSize) {
+    const int32_t nb = CAMath::Min(BatchSize, n - i0);
+    for (int32_t i = 0; i < nb; i++) {
+      convCorrectedUVtoGrid(slice, row, corrU[i0 + i], corrV[i0 + i], gridU[i], gridV[i]);
+    }
+    spline.interpolateUbatch(splineData, gridU, gridV, dx, nb);
+    for (int32_t i = 0; i < nb; i++) {
+      corrX[i0 + i] = rowX + (CAMath::Abs(dx[i]) > 100 ? 0.f : dx[i]);
+    }
+  }
+}
+
+void TPCFastSpaceChargeCorrection::getCorrectionInvUVBatch(int32_t slice, int32_t row, const float* corrU, const float* corrV, float* nomU, float* nomV, int32_t n) const
+{
+  const Spline2D<float, 2>& spline = reinterpret_cast<const Spline2D<float, 2>&>(getSpline(slice, row));
+  const float* splineData = getSplineData(slice, row, 2);
+  float gridU[BatchSize], gridV[BatchSize], duv[2 * BatchSize];
+  for (int32_t i0 = 0; i0 < n; i0 += BatchSize) {
+    const int32_t nb = CAMath::Min(BatchSize, n - i0);
+    for (int32_t i = 0; i < nb; i++) {
+      convCorrectedUVtoGrid(slice, row, corrU[i0 + i], corrV[i0 + i], gridU[i], gridV[i]);
+    }
+    spline.interpolateUbatch(splineData, gridU, gridV, duv, nb);
+    for (int32_t i = 0; i < nb; i++) {
+      const float* d = duv + 2 * i;
+      bool ok = !(CAMath::Abs(d[0]) > 100 || CAMath::Abs(d[1]) > 100);
+      nomU[i0 + i] = corrU[i0 + i] - (ok ? d[0] : 0.f);
+      nomV[i0 + i] = corrV[i0 + i] - (ok ? d[1] : 0.f);
+    }
+  }
+}
+
+#endif // GPUCA_GPUCODE
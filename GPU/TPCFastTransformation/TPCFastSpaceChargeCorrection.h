@@ -160,6 +160,19 @@ class TPCFastSpaceChargeCorrection : public FlatObject
   /// inverse correction: Corrected U and V -> uncorrected U and V
   GPUd() void getCorrectionInvUV(int32_t slice, int32_t row, float corrU, float corrV, float& nomU, float& nomV) const;
 
+#if !defined(GPUCA_GPUCODE)
+  /// _______________ Batch versions for the CPU: n clusters of the same slice and row at once  _______________________
+  ///
+  /// same as getCorrection for every {u[i], v[i]}
+  void getCorrectionBatch(int32_t slice, int32_t row, const float* u, const float* v, float* dx, float* du, float* dv, int32_t n) const;
+
+  /// same as getCorrectionInvCorrectedX for every {corrU[i], corrV[i]}
+  void getCorrectionInvCorrectedXBatch(int32_t slice, int32_t row, const float* corrU, const float* corrV, float* corrX, int32_t n) const;
+
+  /// same as getCorrectionInvUV for every {corrU[i], corrV[i]}
+  void getCorrectionInvUVBatch(int32_t slice, int32_t row, const float* corrU, const float* corrV, float* nomU, float* nomV, int32_t n) const;
+#endif
+
   /// maximal possible drift length of the active area
   GPUd() float getMaxDriftLength(int32_t slice, int32_t row, float pad) const;
 
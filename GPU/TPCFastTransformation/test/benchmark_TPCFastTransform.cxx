@@ -0,0 +1,173 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+#include "TPCFastTransformGeo.h"
+#include "TPCFastSpaceChargeCorrection.h"
+
+using namespace o2::gpu;
+
+constexpr int NRows = 152, NSlices = 36;
+
+// approximate TPC geometry and a space charge correction with random spline parameters
+static const TPCFastSpaceChargeCorrection& getCorrection()
+{
+  static TPCFastTransformGeo geo;
+  static TPCFastSpaceChargeCorrection corr;
+  if (corr.isConstructed()) {
+    return corr;
+  }
+  geo.startConstruction(NRows);
+  geo.setTPCzLength(250.f, 250.f);
+  geo.setTPCalignmentZ(0.);
+  for (int iRow = 0; iRow < NRows; iRow++) {
+    geo.setTPCrow(iRow, 85.f + iRow * 1.05f, 66 + iRow / 2, 0.4f + 0.002f * iRow);
+  }
+  geo.finishConstruction();
+
+  corr.startConstruction(geo, 1);
+  for (int iRow = 0; iRow < NRows; iRow++) {
+    corr.setRowScenarioID(iRow, 0);
+  }
+  TPCFastSpaceChargeCorrection::SplineType spline;
+  spline.recreate(10, 20);
+  corr.setSplineScenario(0, spline);
+  corr.finishConstruction();
+  corr.setNoCorrection();
+
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<float> par(-1., 1.);
+  for (int slice = 0; slice < NSlices; slice++) {
+    for (int row = 0; row < NRows; row++) {
+      int nPar = corr.getSpline(slice, row).getNumberOfParameters();
+      int nParInv[3] = {nPar, nPar / 3, nPar * 2 / 3};
+      for (int is = 0; is < 3; is++) {
+        float* data = corr.getSplineData(slice, row, is);
+        for (int i = 0; i < nParInv[is]; i++) {
+          data[i] = par(generator);
+        }
+      }
+    }
+  }
+  return corr;
+}
+
+// clusters of one TF in SoA layout, sorted by slice and row as in the TPC cluster native access
+struct Clusters {
+  std::vector<float> u, v;
+  std::vector<int> first; // index of the first cluster of each slice/row, NSlices * NRows + 1 entries
+};
+
+static Clusters createClusters(int nClustersPerRow)
+{
+  const auto& corr = getCorrection();
+  const auto& geo = corr.getGeometry();
+  std::mt19937 generator(2);
+  std::uniform_real_distribution<float> su(0., 1.);
+  Clusters cl;
+  for (int slice = 0; slice < NSlices; slice++) {
+    for (int row = 0; row < NRows; row++) {
+      cl.first.push_back(cl.u.size());
+      for (int i = 0; i < nClustersPerRow; i++) {
+        float u, v;
+        geo.convScaledUVtoUV(slice, row, su(generator), su(generator), u, v);
+        cl.u.push_back(u);
+        cl.v.push_back(v);
+      }
+    }
+  }
+  cl.first.push_back(cl.u.size());
+  return cl;
+}
+
+static void BM_CorrectionSingle(benchmark::State& state)
+{
+  const auto& corr = getCorrection();
+  const auto cl = createClusters(state.range(0));
+  std::vector<float> dx(cl.u.size()), du(cl.u.size()), dv(cl.u.size());
+  for (auto _ : state) {
+    for (int slice = 0; slice < NSlices; slice++) {
+      for (int row = 0; row < NRows; row++) {
+        for (int i = cl.first[slice * NRows + row]; i < cl.first[slice * NRows + row + 1]; i++) {
+          corr.getCorrection(slice, row, cl.u[i], cl.v[i], dx[i], du[i], dv[i]);
+        }
+      }
+    }
+    benchmark::DoNotOptimize(dx.data());
+  }
+  state.counters["clusters"] = benchmark::Counter(state.iterations() * cl.u.size(), benchmark::Counter::kIsRate);
+}
+
+static void BM_CorrectionBatch(benchmark::State& state)
+{
+  const auto& corr = getCorrection();
+  const auto cl = createClusters(state.range(0));
+  std::vector<float> dx(cl.u.size()), du(cl.u.size()), dv(cl.u.size());
+  for (auto _ : state) {
+    for (int slice = 0; slice < NSlices; slice++) {
+      for (int row = 0; row < NRows; row++) {
+        int i = cl.first[slice * NRows + row], n = cl.first[slice * NRows + row + 1] - i;
+        corr.getCorrectionBatch(slice, row, &cl.u[i], &cl.v[i], &dx[i], &du[i], &dv[i], n);
+      }
+    }
+    benchmark::DoNotOptimize(dx.data());
+  }
+  state.counters["clusters"] = benchmark::Counter(state.iterations() * cl.u.size(), benchmark::Counter::kIsRate);
+}
+
+static void BM_InverseSingle(benchmark::State& state)
+{
+  const auto& corr = getCorrection();
+  const auto cl = createClusters(state.range(0));
+  std::vector<float> x(cl.u.size()), u(cl.u.size()), v(cl.u.size());
+  for (auto _ : state) {
+    for (int slice = 0; slice < NSlices; slice++) {
+      for (int row = 0; row < NRows; row++) {
+        for (int i = cl.first[slice * NRows + row]; i < cl.first[slice * NRows + row + 1]; i++) {
+          corr.getCorrectionInvCorrectedX(slice, row, cl.u[i], cl.v[i], x[i]);
+          corr.getCorrectionInvUV(slice, row, cl.u[i], cl.v[i], u[i], v[i]);
+        }
+      }
+    }
+    benchmark::DoNotOptimize(x.data());
+    benchmark::DoNotOptimize(u.data());
+  }
+  state.counters["clusters"] = benchmark::Counter(state.iterations() * cl.u.size(), benchmark::Counter::kIsRate);
+}
+
+static void BM_InverseBatch(benchmark::State& state)
+{
+  const auto& corr = getCorrection();
+  const auto cl = createClusters(state.range(0));
+  std::vector<float> x(cl.u.size()), u(cl.u.size()), v(cl.u.size());
+  for (auto _ : state) {
+    for (int slice = 0; slice < NSlices; slice++) {
+      for (int row = 0; row < NRows; row++) {
+        int i = cl.first[slice * NRows + row], n = cl.first[slice * NRows + row + 1] - i;
+        corr.getCorrectionInvCorrectedXBatch(slice, row, &cl.u[i], &cl.v[i], &x[i], n);
+        corr.getCorrectionInvUVBatch(slice, row, &cl.u[i], &cl.v[i], &u[i], &v[i], n);
+      }
+    }
+    benchmark::DoNotOptimize(x.data());
+    benchmark::DoNotOptimize(u.data());
+  }
+  state.counters["clusters"] = benchmark::Counter(state.iterations() * cl.u.size(), benchmark::Counter::kIsRate);
+}
+
+// arguments: number of clusters per slice row
+BENCHMARK(BM_CorrectionSingle)->Arg(10)->Arg(100);
+BENCHMARK(BM_CorrectionBatch)->Arg(10)->Arg(100);
+BENCHMARK(BM_InverseSingle)->Arg(10)->Arg(100);
+BENCHMARK(BM_InverseBatch)->Arg(10)->Arg(100);
+
+BENCHMARK_MAIN();
@@ -19,6 +19,10 @@
 #include <boost/test/unit_test.hpp>
 #include "Spline1D.h"
 #include "Spline2D.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
 
 namespace o2::gpu
 {
@@ -33,4 +37,32 @@ BOOST_AUTO_TEST_CASE(Spline_test1)
   int32_t err2 = o2::gpu::Spline2D<float>::test(0);
   BOOST_CHECK_MESSAGE(err2 == 0, "test of GPU/TPCFastTransform/Spline2D failed with the error code " << err2);
 }
+
+/// @brief Check that the batch interpolation agrees with the point-by-point one. The operations are the same,
+/// but the compiler may fuse the multiplications and additions of the scalar version, so they agree up to the rounding
+BOOST_AUTO_TEST_CASE(Spline_batch)
+{
+  o2::gpu::Spline2D<float, 3> spline(7, 9);
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<float> par(-1., 1.);
+  for (int32_t i = 0; i < spline.getNumberOfParameters(); i++) {
+    spline.getParameters()[i] = par(generator);
+  }
+  const int32_t n = 103; // not a multiple of the SIMD width
+  std::uniform_real_distribution<float> u1(-0.5, spline.getGridX1().getUmax() + 0.5);
+  std::uniform_real_distribution<float> u2(-0.5, spline.getGridX2().getUmax() + 0.5);
+  std::vector<float> u(n), v(n), s(3 * n);
+  for (int32_t i = 0; i < n; i++) {
+    u[i] = u1(generator);
+    v[i] = u2(generator);
+  }
+  spline.interpolateUbatch(spline.getParameters(), u.data(), v.data(), s.data(), n);
+  for (int32_t i = 0; i < n; i++) {
+    float s0[3];
+    spline.interpolateU(spline.getParameters(), u[i], v[i], s0);
+    for (int32_t dim = 0; dim < 3; dim++) {
+      BOOST_CHECK_SMALL(s[3 * i + dim] - s0[dim], 1.e-4f * std::max(1.f, std::abs(s0[dim])));
+    }
+  }
+}
 } // namespace o2::gpu
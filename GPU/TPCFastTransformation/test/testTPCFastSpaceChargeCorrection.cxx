@@ -0,0 +1,136 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file testTPCFastSpaceChargeCorrection.cxx
+/// \brief Compare the batch and the per-cluster space charge corrections
+
+#define BOOST_TEST_MODULE Test TPC Fast Space Charge Correction
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include "TPCFastTransformGeo.h"
+#include "TPCFastSpaceChargeCorrection.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace o2::gpu
+{
+
+constexpr int32_t NRows = 152, NSlices = 36;
+
+/// approximate TPC geometry and a space charge correction with random spline parameters
+void createCorrection(TPCFastTransformGeo& geo, TPCFastSpaceChargeCorrection& corr)
+{
+  geo.startConstruction(NRows);
+  geo.setTPCzLength(250.f, 250.f);
+  geo.setTPCalignmentZ(0.);
+  for (int32_t iRow = 0; iRow < NRows; iRow++) {
+    geo.setTPCrow(iRow, 85.f + iRow * 1.05f, 66 + iRow / 2, 0.4f + 0.002f * iRow);
+  }
+  geo.finishConstruction();
+
+  corr.startConstruction(geo, 1);
+  for (int32_t iRow = 0; iRow < NRows; iRow++) {
+    corr.setRowScenarioID(iRow, 0);
+  }
+  TPCFastSpaceChargeCorrection::SplineType spline;
+  spline.recreate(10, 20);
+  corr.setSplineScenario(0, spline);
+  corr.finishConstruction();
+  corr.setNoCorrection();
+
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<float> par(-1., 1.);
+  for (int32_t slice = 0; slice < NSlices; slice++) {
+    for (int32_t row = 0; row < NRows; row++) {
+      int32_t nPar = corr.getSpline(slice, row).getNumberOfParameters();
+      int32_t nParInv[3] = {nPar, nPar / 3, nPar * 2 / 3};
+      for (int32_t is = 0; is < 3; is++) {
+        float* data = corr.getSplineData(slice, row, is);
+        for (int32_t i = 0; i < nParInv[is]; i++) {
+          data[i] = par(generator);
+        }
+      }
+    }
+  }
+}
+
+/// the operations of the batch and the scalar interpolation are the same, but the compiler
+/// may fuse the multiplications and additions of the scalar one, so they agree up to the rounding
+void checkClose(float batch, float scalar)
+{
+  BOOST_CHECK_SMALL(batch - scalar, 1.e-4f * std::max(1.f, std::abs(scalar)));
+}
+
+/// compare the batch and the per-cluster corrections for the clusters {u[i], v[i]} of a slice row,
+/// return the number of clusters with the correction above the cut of 100 cm
+int32_t compareBatch(const TPCFastSpaceChargeCorrection& corr, int32_t slice, int32_t row, const std::vector<float>& u, const std::vector<float>& v)
+{
+  const int32_t n = u.size();
+  std::vector<float> dx(n), du(n), dv(n), corrX(n), nomU(n), nomV(n);
+  corr.getCorrectionBatch(slice, row, u.data(), v.data(), dx.data(), du.data(), dv.data(), n);
+  corr.getCorrectionInvCorrectedXBatch(slice, row, u.data(), v.data(), corrX.data(), n);
+  corr.getCorrectionInvUVBatch(slice, row, u.data(), v.data(), nomU.data(), nomV.data(), n);
+  int32_t nCut = 0;
+  for (int32_t i = 0; i < n; i++) {
+    float dx0, du0, dv0, corrX0, nomU0, nomV0;
+    corr.getCorrection(slice, row, u[i], v[i], dx0, du0, dv0);
+    corr.getCorrectionInvCorrectedX(slice, row, u[i], v[i], corrX0);
+    corr.getCorrectionInvUV(slice, row, u[i], v[i], nomU0, nomV0);
+    checkClose(dx[i], dx0);
+    checkClose(du[i], du0);
+    checkClose(dv[i], dv0);
+    checkClose(corrX[i], corrX0);
+    checkClose(nomU[i], nomU0);
+    checkClose(nomV[i], nomV0);
+    nCut += (dx0 == 0.f && du0 == 0.f && dv0 == 0.f);
+  }
+  return nCut;
+}
+
+BOOST_AUTO_TEST_CASE(TPCFastSpaceChargeCorrection_batch)
+{
+  TPCFastTransformGeo geo;
+  TPCFastSpaceChargeCorrection corr;
+  createCorrection(geo, corr);
+
+  // clusters inside the row area and around it, where the left knot is clamped to the edges of the grid,
+  // together with the corners of the row area and points far beyond them, where the extrapolated
+  // corrections can be above the cut
+  std::mt19937 generator(2);
+  std::uniform_real_distribution<float> su(-0.2, 1.2);
+  const float edges[] = {-0.5f, -0.1f, 0.f, 1.f, 1.1f, 1.5f};
+  std::vector<float> u, v;
+  int32_t nCut = 0;
+  for (int32_t slice = 0; slice < NSlices; slice++) {
+    for (int32_t row = 0; row < NRows; row++) {
+      // more clusters than processed at once in a few rows
+      const int32_t nClusters = (row % 50 == 0) ? 600 : 31;
+      u.clear();
+      v.clear();
+      for (float eu : edges) {
+        for (float ev : edges) {
+          geo.convScaledUVtoUV(slice, row, eu, ev, u.emplace_back(), v.emplace_back());
+        }
+      }
+      for (int32_t i = 0; i < nClusters; i++) {
+        geo.convScaledUVtoUV(slice, row, su(generator), su(generator), u.emplace_back(), v.emplace_back());
+      }
+      nCut += compareBatch(corr, slice, row, u, v);
+    }
+  }
+  BOOST_CHECK_GT(nCut, 0);
+}
+
+} // namespace o2::gpu
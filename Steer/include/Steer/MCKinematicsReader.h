@@ -18,6 +18,8 @@
 #include "SimulationDataFormat/MCEventHeader.h"
 #include "SimulationDataFormat/TrackReference.h"
 #include "SimulationDataFormat/MCTruthContainer.h"
+#include "SimulationDataFormat/MCKinematicsSidecar.h"
+#include <memory>
 #include <vector>
 
 class TChain;
@@ -126,6 +128,7 @@ class MCKinematicsReader
   void loadHeadersForSource(int source) const;
   void loadTrackRefsForSource(int source) const;
   void initIndexedTrackRefs(std::vector<o2::TrackReference>& refs, o2::dataformats::MCTruthContainer<o2::TrackReference>& indexedrefs) const;
+  void initSidecars(std::vector<std::string> const& prefixes);
 
   DigitizationContext const* mDigitizationContext = nullptr;
   bool mOwningDigiContext = false;
@@ -133,6 +136,9 @@ class MCKinematicsReader
   // chains for each source
   std::vector<TChain*> mInputChains;
 
+  // memory mapped flat kinematics for each source (nullptr if not available)
+  std::vector<std::unique_ptr<o2::dataformats::MCKinematicsSidecarReader>> mSidecars;
+
   // a vector of tracks foreach source and each collision
   mutable std::vector<std::vector<std::vector<o2::MCTrack>*>> mTracks;                                       // the in-memory track container
   mutable std::vector<std::vector<o2::dataformats::MCEventHeader>> mHeaders;                                 // the in-memory header container
@@ -151,6 +157,9 @@ inline MCTrack const* MCKinematicsReader::getTrack(o2::MCCompLabel const& label)
 
 inline MCTrack const* MCKinematicsReader::getTrack(int source, int event, int track) const
 {
+  if (auto sidecar = mSidecars[source].get()) {
+    return sidecar->getTrack(event, track);
+  }
   return &getTracks(source, event)[track];
 }
 
@@ -211,6 +220,9 @@ inline size_t MCKinematicsReader::getNSources() const
 
 inline size_t MCKinematicsReader::getNEvents(int source) const
 {
+  if (auto sidecar = mSidecars[source].get()) {
+    return sidecar->getNEvents();
+  }
   if (mTracks[source].size() == 0) {
     initTracksForSource(source);
   }
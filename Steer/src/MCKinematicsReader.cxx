@@ -50,8 +50,24 @@ void MCKinematicsReader::initIndexedTrackRefs(std::vector<o2::TrackReference>& r
   }
 }
 
+void MCKinematicsReader::initSidecars(std::vector<std::string> const& prefixes)
+{
+  mSidecars.resize(prefixes.size());
+  for (int source = 0; source < prefixes.size(); ++source) {
+    auto sidecar = std::make_unique<o2::dataformats::MCKinematicsSidecarReader>();
+    if (sidecar->open(o2::base::NameConf::getMCKinematicsSidecarFileName(prefixes[source]))) {
+      LOG(info) << "Reading kinematics of source " << source << " from memory mapped file";
+      mSidecars[source] = std::move(sidecar);
+    }
+  }
+}
+
 void MCKinematicsReader::initTracksForSource(int source) const
 {
+  if (auto sidecar = mSidecars[source].get()) {
+    mTracks[source].resize(sidecar->getNEvents(), nullptr);
+    return;
+  }
   auto chain = mInputChains[source];
   if (chain) {
     // todo: get name from NameConfig
@@ -62,6 +78,11 @@ void MCKinematicsReader::initTracksForSource(int source) const
 
 void MCKinematicsReader::loadTracksForSourceAndEvent(int source, int event) const
 {
+  if (auto sidecar = mSidecars[source].get()) {
+    auto tracks = sidecar->getTracks(event);
+    mTracks[source][event] = new std::vector<o2::MCTrack>(tracks.begin(), tracks.end());
+    return;
+  }
   auto chain = mInputChains[source];
   if (chain) {
     // todo: get name from NameConfig
@@ -149,6 +170,7 @@ bool MCKinematicsReader::initFromDigitContext(o2::steer::DigitizationContext con
   mTracks.resize(mInputChains.size());
   mHeaders.resize(mInputChains.size());
   mIndexedTrackRefs.resize(mInputChains.size());
+  initSidecars(mDigitizationContext->getSimPrefixes());
 
   // actual loading will be done only if someone asks
   // the first time for a particular source ...
@@ -182,6 +204,7 @@ bool MCKinematicsReader::initFromKinematics(std::string_view name)
   mTracks.resize(1);
   mHeaders.resize(1);
   mIndexedTrackRefs.resize(1);
+  initSidecars({std::string(name)});
   mInitialized = true;
 
   return true;
@@ -23,6 +23,7 @@
 #include <SimulationDataFormat/MCEventHeader.h>
 #include <DetectorsBase/Stack.h>
 #include <SimulationDataFormat/PrimaryChunk.h>
+#include <SimulationDataFormat/MCKinematicsSidecar.h>
 #include <DetectorsCommonDataFormats/DetID.h>
 #include <DetectorsCommonDataFormats/DetectorNameConf.h>
 #include <gsl/gsl>
@@ -66,6 +67,9 @@
 #include <mutex>
 #include <filesystem>
 #include <functional>
+#include <atomic>
+#include <array>
+#include <thread>
 
 #include "SimPublishChannelHelper.h"
 
@@ -119,6 +123,7 @@ class O2HitMerger : public fair::mq::Device
   ~O2HitMerger() override
   {
     FairSystemInfo sysinfo;
+    printMergeTimeSummary();
     LOG(info) << "TIME-STAMP " << mTimer.RealTime() << "\t";
     mTimer.Continue();
     LOG(info) << "MEM-STAMP " << sysinfo.GetCurrentMemory() / (1024. * 1024) << " "
@@ -142,6 +147,7 @@ class O2HitMerger : public fair::mq::Device
     mAsService = o2::conf::SimConfig::Instance().asService();
     mForwardKine = o2::conf::SimConfig::Instance().forwardKine();
     mWriteToDisc = o2::conf::SimConfig::Instance().writeToDisc();
+    mWriteKineSidecar = o2::conf::SimConfig::Instance().writeKineSidecar();
 
     mOutFileName = outfilename.c_str();
     if (mWriteToDisc) {
@@ -152,6 +158,8 @@ class O2HitMerger : public fair::mq::Device
       mMCHeaderOnlyOutFile = new TFile(o2::base::NameConf::getMCHeadersFileName(o2::conf::SimConfig::Instance().getOutPrefix().c_str()).c_str(), "RECREATE");
       mMCHeaderTree = new TTree("o2sim", "o2sim");
       mMCHeaderTree->SetDirectory(mMCHeaderOnlyOutFile);
+
+      initKineSidecar(o2::conf::SimConfig::Instance().getOutPrefix());
     }
     // detectors init only once
     if (mDetectorInstances.size() == 0) {
@@ -170,6 +178,12 @@ class O2HitMerger : public fair::mq::Device
       LOG(warning) << "DID NOT FIND ENVIRONMENT VARIABLE TO INIT PIPE";
     }
 
+    // number of threads for the concurrent merging of the detector outputs
+    if (auto nthreadsenv = getenv("ALICE_O2SIMMERGER_NTHREADS")) {
+      mNMergerThreads = std::max(1, atoi(nthreadsenv));
+    }
+    LOG(info) << "Merging detector outputs with " << mNMergerThreads << " thread(s)";
+
     // if no data to expect we shut down the device NOW since it would otherwise hang
     if (mNExpectedEvents == 0) {
       if (mAsService) {
@@ -235,6 +249,8 @@ class O2HitMerger : public fair::mq::Device
       mMCHeaderOnlyOutFile = new TFile(o2::base::NameConf::getMCHeadersFileName(reconfig.outputPrefix).c_str(), "RECREATE");
       mMCHeaderTree = new TTree("o2sim", "o2sim");
       mMCHeaderTree->SetDirectory(mMCHeaderOnlyOutFile);
+
+      initKineSidecar(reconfig.outputPrefix);
     }
     // reinit detectorInstance files (also make sure they are closed before continuing)
     initHitFiles(reconfig.outputPrefix);
@@ -518,6 +534,8 @@ class O2HitMerger : public fair::mq::Device
       targetbr->SetAddress(&filladdr);
       targetbr->Fill();
       targetbr->ResetAddress();
+      // the same tracks as flat data (event index = entry in the kinematics tree)
+      mKineSidecar.addEvent(*filladdr);
     }
     // forwarding the track data to other consumers (pub/sub)
     if (mForwardKine) {
@@ -609,6 +627,19 @@ class O2HitMerger : public fair::mq::Device
     ref.setTrackID(cId + ioffset);
   }
 
+  void initKineSidecar(std::string const& prefix)
+  {
+    auto filename = o2::base::NameConf::getMCKinematicsSidecarFileName(prefix);
+    if (mWriteKineSidecar) {
+      mKineSidecar.open(filename);
+    } else {
+      // a file from a previous production would not match the new kinematics
+      mKineSidecar.close();
+      std::error_code ec;
+      std::filesystem::remove(filename, ec);
+    }
+  }
+
   void initHitTreeAndOutFile(std::string prefix, int detID)
   {
     using o2::detectors::DetID;
@@ -628,6 +659,72 @@ class O2HitMerger : public fair::mq::Device
     }
   }
 
+  // Executes the given merge tasks on up to mNMergerThreads threads and fills
+  // the wall time spent in each of them (in seconds).
+  // Every task has to operate on its own output file / tree.
+  void runMergeTasks(std::vector<std::function<void()>> const& tasks, std::vector<double>& times)
+  {
+    times.assign(tasks.size(), 0.);
+    auto runTask = [&tasks, &times](int i) {
+      TStopwatch timer;
+      timer.Start();
+      tasks[i]();
+      times[i] = timer.RealTime();
+    };
+    const int nthreads = std::min<int>(mNMergerThreads, tasks.size());
+    if (nthreads <= 1) {
+      for (int i = 0; i < tasks.size(); ++i) {
+        runTask(i);
+      }
+      return;
+    }
+    std::atomic<int> next{0};
+    auto worker = [&next, &tasks, &runTask]() {
+      for (int i = next++; i < tasks.size(); i = next++) {
+        runTask(i);
+      }
+    };
+    std::vector<std::thread> threads;
+    for (int t = 1; t < nthreads; ++t) {
+      threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  // Reports the merge latency per detector (id -1 is the kinematics) for one event
+  // and accumulates it for the summary at the end of the run
+  void accountMergeTimes(int eventID, std::vector<int> const& detIDs, std::vector<double> const& times)
+  {
+    std::stringstream str;
+    for (int i = 0; i < detIDs.size(); ++i) {
+      auto& stat = mMergeTimeStats[detIDs[i] + 1];
+      stat.total += times[i];
+      stat.max = std::max(stat.max, times[i]);
+      stat.nevents++;
+      str << " " << mergeStatName(detIDs[i]) << " " << times[i];
+    }
+    LOG(info) << "Merge latency (s) for event " << eventID << ":" << str.str();
+  }
+
+  static const char* mergeStatName(int detID)
+  {
+    return detID < 0 ? "Kine" : o2::detectors::DetID::getName(detID);
+  }
+
+  void printMergeTimeSummary() const
+  {
+    for (int i = 0; i < mMergeTimeStats.size(); ++i) {
+      auto& stat = mMergeTimeStats[i];
+      if (stat.nevents > 0) {
+        LOG(info) << "MERGE-LATENCY " << mergeStatName(i - 1) << " events " << stat.nevents
+                  << " mean " << stat.total / stat.nevents << " max " << stat.max << " s";
+      }
+    }
+  }
+
   // This method goes over the buffers containing data for a given event; potentially merges
   // them and flushes into the actual output file.
   // The method can be called asynchronously to data collection
@@ -765,43 +862,58 @@ class O2HitMerger : public fair::mq::Device
         eventheader->putInfo("prims_total", prims);
       };
 
-      reorderAndMergeMCTracks(flusheventID, mOutTree, nprimaries, subevOrdered, mcheaderhook, eventheader);
-
-      if (mOutTree) {
-        // adjusting and merging track references
-        remapTrackIdsAndMerge<std::vector<o2::TrackReference>>("TrackRefs", flusheventID, *mOutTree, trackoffsets, nprimaries, subevOrdered, mTrackRefBuffer);
-
-        // write MC event headers
-        {
-          auto headerbr = o2::base::getOrMakeBranch(*mOutTree, "MCEventHeader.", &eventheader);
-          headerbr->SetAddress(&eventheader);
-          headerbr->Fill();
-          headerbr->ResetAddress();
-        }
+      // The kinematics and each of the detectors write into their own file, so that
+      // the merge steps are independent and can be executed concurrently.
+      std::vector<std::function<void()>> mergeTasks;
+      std::vector<int> mergeTaskDetIDs; // detector id of each task; -1 for the kinematics
+      std::vector<double> mergeTaskTimes;
+
+      mergeTasks.emplace_back([&]() {
+        reorderAndMergeMCTracks(flusheventID, mOutTree, nprimaries, subevOrdered, mcheaderhook, eventheader);
+
+        if (mOutTree) {
+          // adjusting and merging track references
+          remapTrackIdsAndMerge<std::vector<o2::TrackReference>>("TrackRefs", flusheventID, *mOutTree, trackoffsets, nprimaries, subevOrdered, mTrackRefBuffer);
+
+          // write MC event headers
+          {
+            auto headerbr = o2::base::getOrMakeBranch(*mOutTree, "MCEventHeader.", &eventheader);
+            headerbr->SetAddress(&eventheader);
+            headerbr->Fill();
+            headerbr->ResetAddress();
+          }
 
-        {
-          auto headerbr = o2::base::getOrMakeBranch(*mMCHeaderTree, "MCEventHeader.", &eventheader);
-          headerbr->SetAddress(&eventheader);
-          headerbr->Fill();
-          headerbr->ResetAddress();
+          {
+            auto headerbr = o2::base::getOrMakeBranch(*mMCHeaderTree, "MCEventHeader.", &eventheader);
+            headerbr->SetAddress(&eventheader);
+            headerbr->Fill();
+            headerbr->ResetAddress();
+          }
         }
-      }
+      });
+      mergeTaskDetIDs.push_back(-1);
 
       // c) do the merge procedure for all hits ... delegate this to detector specific functions
       // since they know about types; number of branches; etc.
       // this will also fix the trackIDs inside the hits
       for (int id = 0; id < mDetectorInstances.size(); ++id) {
-        auto& det = mDetectorInstances[id];
+        auto det = mDetectorInstances[id].get();
         if (det) {
           auto hittree = mDetectorToTTreeMap[id];
           if (hittree) {
-            det->mergeHitEntriesAndFlush(flusheventID, *hittree, trackoffsets, nprimaries, subevOrdered);
-            hittree->SetEntries(hittree->GetEntries() + 1);
-            LOG(info) << "flushing tree to file " << hittree->GetDirectory()->GetFile()->GetName();
+            mergeTasks.emplace_back([&, det, hittree]() {
+              det->mergeHitEntriesAndFlush(flusheventID, *hittree, trackoffsets, nprimaries, subevOrdered);
+              hittree->SetEntries(hittree->GetEntries() + 1);
+              LOG(info) << "flushing tree to file " << hittree->GetDirectory()->GetFile()->GetName();
+            });
+            mergeTaskDetIDs.push_back(id);
           }
         }
       }
 
+      runMergeTasks(mergeTasks, mergeTaskTimes);
+      accountMergeTimes(flusheventID, mergeTaskDetIDs, mergeTaskTimes);
+
       // increase the entry count in the tree
       if (mOutTree) {
         mOutTree->SetEntries(mOutTree->GetEntries() + 1);
@@ -820,16 +932,23 @@ class O2HitMerger : public fair::mq::Device
     } // end while
     if (mWriteToDisc && mOutFile) {
       LOG(info) << "Writing TTrees";
-      mOutFile->Write("", TObject::kOverwrite);
+      std::vector<std::function<void()>> writeTasks;
+      writeTasks.emplace_back([this]() {
+        mOutFile->Write("", TObject::kOverwrite);
+        if (mMCHeaderOnlyOutFile) {
+          mMCHeaderOnlyOutFile->Write("", TObject::kOverwrite);
+        }
+        mKineSidecar.flush();
+      });
       for (int id = 0; id < mDetectorInstances.size(); ++id) {
         auto& det = mDetectorInstances[id];
-        if (det && mDetectorOutFiles[id]) {
-          mDetectorOutFiles[id]->Write("", TObject::kOverwrite);
+        auto file = mDetectorOutFiles[id];
+        if (det && file) {
+          writeTasks.emplace_back([file]() { file->Write("", TObject::kOverwrite); });
         }
       }
-      if (mMCHeaderOnlyOutFile) {
-        mMCHeaderOnlyOutFile->Write("", TObject::kOverwrite);
-      }
+      std::vector<double> writeTimes;
+      runMergeTasks(writeTasks, writeTimes);
     }
     return true;
   }
@@ -862,12 +981,24 @@ class O2HitMerger : public fair::mq::Device
   int mNextFlushID = 1;     //! EventID to be flushed next
   TStopwatch mTimer;
 
-  bool mAsService = false;  //! if run in deamonized mode
-  bool mForwardKine = true; //! if we forward kinematics (tracks, eventheaders) on some output channel
-  bool mWriteToDisc = true; //! if we want to write simulation products to disc
+  bool mAsService = false;        //! if run in deamonized mode
+  bool mForwardKine = true;       //! if we forward kinematics (tracks, eventheaders) on some output channel
+  bool mWriteToDisc = true;       //! if we want to write simulation products to disc
+  bool mWriteKineSidecar = false; //! if we want to write the kinematics also as flat file
+
+  o2::dataformats::MCKinematicsSidecarWriter mKineSidecar; //! flat copy of the kinematics for memory mapped reading
 
   int mPipeToDriver = -1;
 
+  int mNMergerThreads = 1; //! number of threads used to merge the detectors of one event concurrently
+
+  struct MergeTimeStat {
+    double total = 0.;
+    double max = 0.;
+    int nevents = 0;
+  };
+  std::array<MergeTimeStat, o2::detectors::DetID::nDetectors + 1> mMergeTimeStats; //! merge latency per detector; first entry for kinematics
+
   std::vector<std::unique_ptr<o2::base::Detector>> mDetectorInstances; //!
 
   // output folder configuration
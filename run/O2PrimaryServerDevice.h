@@ -40,11 +40,16 @@
 #include <fstream>
 #include <iostream>
 #include <atomic>
+#include <condition_variable>
+#include <map>
+#include <mutex>
 #include "PrimaryServerState.h"
 #include "SimPublishChannelHelper.h"
 #include <chrono>
 #include <CCDB/BasicCCDBManager.h>
 #include <TRandom3.h>
+#include <SimConfig/InteractionDiamondParam.h>
+#include <DataFormatsCalibration/MeanVertexObject.h>
 
 namespace o2
 {
@@ -67,6 +72,7 @@ class O2PrimaryServerDevice final : public fair::mq::Device
   ~O2PrimaryServerDevice() final
   {
     try {
+      stopGeneratorWorkers();
       if (mGeneratorThread.joinable()) {
         mGeneratorThread.join();
       }
@@ -93,6 +99,21 @@ class O2PrimaryServerDevice final : public fair::mq::Device
       TGeoGlobalMagField::Instance()->Lock();
     }
 
+    // with several generation threads, each has its own (uncached) generator instance
+    mNGenThreads = conf.getNGenThreads();
+    if (mNGenThreads > 1 && !supportsParallelGeneration(conf)) {
+      LOG(warn) << "Generator " << conf.getGenerator() << " (trigger " << conf.getTrigger() << ") does not support reproducible parallel event generation; using a single generator instance";
+      mNGenThreads = 1;
+    }
+    if (mNGenThreads > 1) {
+      initGeneratorWorkers();
+      LOG(info) << "Generator initialization took " << timer.CpuTime() << "s";
+      if (mMaxEvents > 0) {
+        launchGeneratorWorkers();
+      }
+      return;
+    }
+
     // look if we find a cached instances of Pythia8 or external generators in order to avoid
     // (long) initialization times.
     // This is evidently a bit weak, as generators might need reconfiguration (to be treated later).
@@ -139,7 +160,17 @@ class O2PrimaryServerDevice final : public fair::mq::Device
     }
     mPrimGen->SetEvent(&mEventHeader);
 
-    // A good moment to couple to collision context
+    initCollisionContext();
+
+    LOG(info) << "Generator initialization took " << timer.CpuTime() << "s";
+    if (mMaxEvents > 0) {
+      generateEvent(); // generate a first event
+    }
+  }
+
+  // couples the event generation to the collision context (if given)
+  void initCollisionContext()
+  {
     auto collContextFileName_PrefixPair = mSimConfig.getCollContextFilenameAndEventPrefix();
     auto collContextFileName = collContextFileName_PrefixPair.first;
     if (collContextFileName.size() > 0) {
@@ -158,11 +189,127 @@ class O2PrimaryServerDevice final : public fair::mq::Device
         mEventID_to_CollID = mCollissionContext->getCollisionIndicesForSource(source);
       }
     }
+  }
 
-    LOG(info) << "Generator initialization took " << timer.CpuTime() << "s";
-    if (mMaxEvents > 0) {
-      generateEvent(); // generate a first event
+  static bool supportsParallelGeneration(o2::conf::SimConfig const& conf)
+  {
+    // The generator instances run concurrently and must not draw from the global (not thread-safe)
+    // gRandom: only generators owning their random engine qualify. Pythia8 takes its seed from gRandom
+    // during the (serial) initialization only; pythia8hi draws the ZDC free spectators from gRandom.
+    // Generators reading events sequentially from a file would deliver the same events in every instance.
+    bool ownsRandomEngine = false;
+    for (auto name : {"pythia8", "pythia8pp", "pythia8hf", "pythia8powheg"}) {
+      if (conf.getGenerator().compare(name) == 0) {
+        ownsRandomEngine = true;
+      }
+    }
+    // an external trigger may use gRandom as well
+    bool ownTrigger = conf.getTrigger().empty() || conf.getTrigger().compare("particle") == 0;
+    return ownsRandomEngine && ownTrigger && conf.getEmbedIntoFileName().empty();
+  }
+
+  // seed derived from the initial seed which is unique for a given event (or generator instance)
+  uint32_t deriveSeed(uint64_t index) const
+  {
+    // splitmix64 finalizer; 0 is avoided since it means "random seed" for TRandom3
+    uint64_t z = mInitialSeed + 0x9e3779b97f4a7c15ULL * (index + 1);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    z ^= z >> 31;
+    return std::max<uint32_t>(1, z);
+  }
+
+  // creates one independently seeded generator instance per generation thread
+  void initGeneratorWorkers()
+  {
+    stopGeneratorWorkers();
+    mGeneratorWorkers.clear();
+    const auto& conf = mSimConfig;
+    auto& ccdbmgr = o2::ccdb::BasicCCDBManager::instance();
+    auto vtxMode = conf.getVertexMode();
+    using o2::conf::VertexMode;
+    if (vtxMode == VertexMode::kCCDB) {
+      mMeanVertex = std::make_unique<o2::dataformats::MeanVertexObject>(*ccdbmgr.getForTimeStamp<o2::dataformats::MeanVertexObject>("GLO/Calib/MeanVertex", conf.getTimestamp()));
+    } else if (vtxMode == VertexMode::kDiamondParam) {
+      auto const& param = o2::eventgen::InteractionDiamondParam::Instance();
+      mMeanVertex = std::make_unique<o2::dataformats::MeanVertexObject>(param.position[0], param.position[1], param.position[2], param.width[0], param.width[1], param.width[2], param.slopeX, param.slopeY);
+    } else {
+      mMeanVertex = std::make_unique<o2::dataformats::MeanVertexObject>(0, 0, 0, 0, 0, 0, 0, 0);
+    }
+
+    for (int w = 0; w < mNGenThreads; ++w) {
+      auto worker = std::make_unique<GeneratorWorker>();
+      worker->stack = std::make_unique<o2::data::Stack>();
+      worker->stack->setExternalMode(true);
+      worker->generator = std::make_unique<o2::eventgen::PrimaryGenerator>();
+      // generators (e.g. Pythia8) take their seed from gRandom during the initialization
+      gRandom->SetSeed(deriveSeed(std::numeric_limits<uint32_t>::max() - w));
+      o2::eventgen::GeneratorFactory::setPrimaryGenerator(conf, worker->generator.get());
+      worker->generator->setVertexMode(vtxMode, mMeanVertex.get());
+      worker->generator->Init();
+      worker->generator->SetEvent(&worker->header);
+      mGeneratorWorkers.emplace_back(std::move(worker));
     }
+    gRandom->SetSeed(mInitialSeed);
+
+    initCollisionContext();
+  }
+
+  // starts the threads generating the events; event k (counting from 1) is generated
+  // by worker (k - 1) % mNGenThreads, with a vertex sampled from a per-event seed
+  void launchGeneratorWorkers()
+  {
+    mStopGeneratorWorkers = false;
+    mGeneratedEvents.clear();
+    for (int w = 0; w < mGeneratorWorkers.size(); ++w) {
+      mGeneratorWorkers[w]->thread = std::thread([this, w]() {
+        auto& worker = *mGeneratorWorkers[w];
+        for (int event = w + 1; event <= mMaxEvents; event += mNGenThreads) {
+          {
+            // do not run ahead of the consumer by more than a few events per worker
+            std::unique_lock<std::mutex> lock(mGeneratedMutex);
+            mGeneratedCondition.wait(lock, [this, event]() { return mStopGeneratorWorkers || event - mEventCounter <= 2 * mNGenThreads; });
+            if (mStopGeneratorWorkers) {
+              return;
+            }
+          }
+          TRandom3 rng(deriveSeed(event));
+          generateEventWith(*worker.generator, *worker.stack, event - 1, &rng);
+          GeneratedEvent generated{worker.stack->getPrimaries(), worker.header};
+          {
+            std::lock_guard<std::mutex> lock(mGeneratedMutex);
+            mGeneratedEvents.emplace(event, std::move(generated));
+          }
+          mGeneratedCondition.notify_all();
+        }
+      });
+    }
+    stateTransition(O2PrimaryServerState::ReadyToServe, "GENEVENT");
+  }
+
+  void stopGeneratorWorkers()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mGeneratedMutex);
+      mStopGeneratorWorkers = true;
+    }
+    mGeneratedCondition.notify_all();
+    for (auto& worker : mGeneratorWorkers) {
+      if (worker->thread.joinable()) {
+        worker->thread.join();
+      }
+    }
+    mGeneratedEvents.clear();
+  }
+
+  // blocks until the event with the given number (counting from 1) is generated and takes it
+  void takeGeneratedEvent(int event)
+  {
+    std::unique_lock<std::mutex> lock(mGeneratedMutex);
+    mGeneratedCondition.wait(lock, [this, event]() { return mGeneratedEvents.find(event) != mGeneratedEvents.end(); });
+    auto iter = mGeneratedEvents.find(event);
+    mCurrentEvent = std::move(iter->second);
+    mGeneratedEvents.erase(iter);
   }
 
   // function generating one event
@@ -173,6 +320,16 @@ class O2PrimaryServerDevice final : public fair::mq::Device
     if (changeState) {
       stateTransition(O2PrimaryServerState::WaitingEvent, "GENEVENT");
     }
+    generateEventWith(*mPrimGen, *mStack, mEventCounter);
+    if (changeState) {
+      stateTransition(O2PrimaryServerState::ReadyToServe, "GENEVENT");
+    }
+  }
+
+  // generates the event with the given index (counting from 0) with a generator into the stack;
+  // if a random generator is given, it is used to sample the interaction vertex
+  void generateEventWith(o2::eventgen::PrimaryGenerator& generator, o2::data::Stack& stack, int eventIndex, TRandom* vertexRng = nullptr)
+  {
     TStopwatch timer;
     timer.Start();
     try {
@@ -180,19 +337,20 @@ class O2PrimaryServerDevice final : public fair::mq::Device
       int retry_counter = 0;
       const int MAX_RETRY = 100;
       do {
-        mStack->Reset();
+        stack.Reset();
         // see if we the vertex comes from the collision context
-        if (mCollissionContext) {
+        if (mCollissionContext && mCollissionContext->getInteractionVertices().size() > 0) {
           const auto& vertices = mCollissionContext->getInteractionVertices();
-          if (vertices.size() > 0) {
-            auto collisionindex = mEventID_to_CollID.at(mEventCounter);
-            auto& vertex = vertices.at(collisionindex);
-            LOG(info) << "Setting vertex " << vertex << " for event " << mEventCounter << " for prefix " << mSimConfig.getOutPrefix();
-            mPrimGen->setExternalVertexForNextEvent(vertex.X(), vertex.Y(), vertex.Z());
-          }
+          auto collisionindex = mEventID_to_CollID.at(eventIndex);
+          auto& vertex = vertices.at(collisionindex);
+          LOG(info) << "Setting vertex " << vertex << " for event " << eventIndex << " for prefix " << mSimConfig.getOutPrefix();
+          generator.setExternalVertexForNextEvent(vertex.X(), vertex.Y(), vertex.Z());
+        } else if (vertexRng) {
+          auto vertex = mMeanVertex->sample(*vertexRng);
+          generator.setExternalVertexForNextEvent(vertex.X(), vertex.Y(), vertex.Z());
         }
-        mPrimGen->GenerateEvent(mStack);
-        if (mStack->getPrimaries().size() > 0) {
+        generator.GenerateEvent(&stack);
+        if (stack.getPrimaries().size() > 0) {
           valid = true;
         } else {
           retry_counter++;
@@ -208,10 +366,7 @@ class O2PrimaryServerDevice final : public fair::mq::Device
     }
     timer.Stop();
     LOG(info) << "Event generation took " << timer.CpuTime() << "s"
-              << " and produced " << mStack->getPrimaries().size() << " primaries ";
-    if (changeState) {
-      stateTransition(O2PrimaryServerState::ReadyToServe, "GENEVENT");
-    }
+              << " and produced " << stack.getPrimaries().size() << " primaries ";
   }
 
   // launches a thread that listens for status requests from outside asynchronously
@@ -381,6 +536,7 @@ class O2PrimaryServerDevice final : public fair::mq::Device
     mSimConfig.getConfigData().mTrigger = reconfig.trigger;
     mSimConfig.getConfigData().mExtKinFileName = reconfig.extKinfileName;
 
+    stopGeneratorWorkers();
     mEventCounter = 0;
     mPartCounter = 0;
     mNeedNewEvent = true;
@@ -514,12 +670,19 @@ class O2PrimaryServerDevice final : public fair::mq::Device
           LOG(info) << "Waiting for event generation do become fully available";
           usleep(100);
         }
+        if (mNGenThreads > 1) {
+          takeGeneratedEvent(mEventCounter + 1);
+        }
         mNeedNewEvent = false;
         mPartCounter = 0;
-        mEventCounter++;
+        {
+          std::lock_guard<std::mutex> lock(mGeneratedMutex);
+          mEventCounter++;
+        }
+        mGeneratedCondition.notify_all();
       }
 
-      auto& prims = mStack->getPrimaries();
+      auto& prims = mNGenThreads > 1 ? mCurrentEvent.primaries : mStack->getPrimaries();
       auto numberofparts = (int)std::ceil(prims.size() / (1. * mChunkGranularity));
       // number of parts should be at least 1 (even if empty)
       numberofparts = std::max(1, numberofparts);
@@ -537,7 +700,7 @@ class O2PrimaryServerDevice final : public fair::mq::Device
       const uint64_t drawnSeed = (uint64_t)(static_cast<double>(std::numeric_limits<uint32_t>::max()) * mSeedGenerator.Rndm());
       i.seed = mUseFixedChunkSeed ? mFixedChunkSeed : drawnSeed;
       i.index = m.mParticles.size();
-      i.mMCEventHeader = mEventHeader;
+      i.mMCEventHeader = mNGenThreads > 1 ? mCurrentEvent.header : mEventHeader;
       m.mSubEventInfo = i;
 
       int endindex = prims.size() - mPartCounter * mChunkGranularity;
@@ -568,7 +731,7 @@ class O2PrimaryServerDevice final : public fair::mq::Device
       if (mPartCounter == numberofparts) {
         mNeedNewEvent = true;
         // start generation of a new event
-        if (mEventCounter < mMaxEvents) {
+        if (mEventCounter < mMaxEvents && mNGenThreads == 1) {
           mGeneratorThread = std::thread(&O2PrimaryServerDevice::generateEvent, this);
         }
       }
@@ -690,6 +853,26 @@ class O2PrimaryServerDevice final : public fair::mq::Device
   std::unordered_map<int, int> mEventID_to_CollID;              //!
 
   TRandom3 mSeedGenerator; //! specific random generator for seed generation for work chunks
+
+  // event-parallel generation with several generator instances
+  struct GeneratedEvent {
+    std::vector<TParticle> primaries;
+    o2::dataformats::MCEventHeader header;
+  };
+  struct GeneratorWorker {
+    std::unique_ptr<o2::eventgen::PrimaryGenerator> generator;
+    std::unique_ptr<o2::data::Stack> stack;
+    o2::dataformats::MCEventHeader header;
+    std::thread thread;
+  };
+  int mNGenThreads = 1;                                            //! number of generator instances / threads
+  std::vector<std::unique_ptr<GeneratorWorker>> mGeneratorWorkers; //!
+  std::unique_ptr<o2::dataformats::MeanVertexObject> mMeanVertex;  //! vertex distribution sampled for each event
+  std::map<int, GeneratedEvent> mGeneratedEvents;                  //! generated events not yet served, by event number
+  GeneratedEvent mCurrentEvent;                                    //! the event currently served
+  std::mutex mGeneratedMutex;                                      //! protects mGeneratedEvents, mEventCounter for the workers
+  std::condition_variable mGeneratedCondition;                     //!
+  bool mStopGeneratorWorkers = false;                              //!
 };
 
 } // namespace devices
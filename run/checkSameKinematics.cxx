@@ -0,0 +1,57 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+// Executable to check that two simulations (e.g. with the same seed) produced identical events
+// Compares the kinematics of the primary particles event by event
+
+#include "SimulationDataFormat/MCTrack.h"
+#include "Steer/MCKinematicsReader.h"
+#include <fairlogger/Logger.h>
+
+int main(int argc, char** argv)
+{
+  if (argc < 3) {
+    LOG(error) << "Usage: " << argv[0] << " <prefix1> <prefix2>";
+    return 1;
+  }
+  o2::steer::MCKinematicsReader reader1(argv[1], o2::steer::MCKinematicsReader::Mode::kMCKine);
+  o2::steer::MCKinematicsReader reader2(argv[2], o2::steer::MCKinematicsReader::Mode::kMCKine);
+
+  if (reader1.getNEvents(0) == 0 || reader1.getNEvents(0) != reader2.getNEvents(0)) {
+    LOG(error) << "Number of events differ or are 0: " << reader1.getNEvents(0) << " vs " << reader2.getNEvents(0);
+    return 1;
+  }
+  int nDiffer = 0;
+  for (int eventID = 0; eventID < reader1.getNEvents(0); ++eventID) {
+    const auto& tracks1 = reader1.getTracks(eventID);
+    const auto& tracks2 = reader2.getTracks(eventID);
+    if (tracks1.size() != tracks2.size()) {
+      LOG(error) << "Event " << eventID << " has " << tracks1.size() << " vs " << tracks2.size() << " tracks";
+      nDiffer++;
+      continue;
+    }
+    for (size_t i = 0; i < tracks1.size(); ++i) {
+      const auto& t1 = tracks1[i];
+      const auto& t2 = tracks2[i];
+      if (t1.GetPdgCode() != t2.GetPdgCode() || t1.Px() != t2.Px() || t1.Py() != t2.Py() || t1.Pz() != t2.Pz() ||
+          t1.GetStartVertexCoordinatesX() != t2.GetStartVertexCoordinatesX() ||
+          t1.GetStartVertexCoordinatesY() != t2.GetStartVertexCoordinatesY() ||
+          t1.GetStartVertexCoordinatesZ() != t2.GetStartVertexCoordinatesZ()) {
+        LOG(error) << "Event " << eventID << " differs at track " << i << ": pdg " << t1.GetPdgCode() << " vs " << t2.GetPdgCode()
+                   << ", pz " << t1.Pz() << " vs " << t2.Pz();
+        nDiffer++;
+        break;
+      }
+    }
+  }
+  LOG(info) << "Compared " << reader1.getNEvents(0) << " events, " << nDiffer << " differ";
+  return nDiffer == 0 ? 0 : 1;
+}